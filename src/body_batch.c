@@ -0,0 +1,89 @@
+#include "body_batch.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+static body* body_at(body* first, size_t stride, int slot) {
+    return (body*)((char*)first + (size_t)slot * stride);
+}
+
+/*
+ * Four bodies per step: their (x, y, vx, vy) rows are transposed into
+ * columns, stepped with the same mul-then-add as the scalar tail and
+ * transposed back. Stores are per row so frozen slots keep their bodies.
+ */
+void body_batch_integrate(
+    body* first,
+    size_t stride,
+    const int* slots,
+    const uint8_t* frozen,
+    int n,
+    float dt,
+    float* prev_x,
+    float* prev_y
+) {
+    int k = 0;
+    if (!first || !slots || n <= 0) {
+        return;
+    }
+#if defined(__SSE2__) || defined(_M_X64)
+    {
+        const __m128 vdt = _mm_set1_ps(dt);
+        for (; k + 4 <= n; k += 4) {
+            body* b[4];
+            __m128 r0;
+            __m128 r1;
+            __m128 r2;
+            __m128 r3;
+            __m128 ax;
+            __m128 ay;
+            for (int j = 0; j < 4; ++j) {
+                b[j] = body_at(first, stride, slots[k + j]);
+            }
+            r0 = _mm_loadu_ps(&b[0]->x);
+            r1 = _mm_loadu_ps(&b[1]->x);
+            r2 = _mm_loadu_ps(&b[2]->x);
+            r3 = _mm_loadu_ps(&b[3]->x);
+            ax = _mm_set_ps(b[3]->ax, b[2]->ax, b[1]->ax, b[0]->ax);
+            ay = _mm_set_ps(b[3]->ay, b[2]->ay, b[1]->ay, b[0]->ay);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            if (prev_x && prev_y) {
+                _mm_storeu_ps(&prev_x[k], r0);
+                _mm_storeu_ps(&prev_y[k], r1);
+            }
+            r2 = _mm_add_ps(r2, _mm_mul_ps(ax, vdt));
+            r3 = _mm_add_ps(r3, _mm_mul_ps(ay, vdt));
+            r0 = _mm_add_ps(r0, _mm_mul_ps(r2, vdt));
+            r1 = _mm_add_ps(r1, _mm_mul_ps(r3, vdt));
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            if (!frozen || !frozen[k + 0]) {
+                _mm_storeu_ps(&b[0]->x, r0);
+            }
+            if (!frozen || !frozen[k + 1]) {
+                _mm_storeu_ps(&b[1]->x, r1);
+            }
+            if (!frozen || !frozen[k + 2]) {
+                _mm_storeu_ps(&b[2]->x, r2);
+            }
+            if (!frozen || !frozen[k + 3]) {
+                _mm_storeu_ps(&b[3]->x, r3);
+            }
+        }
+    }
+#endif
+    for (; k < n; ++k) {
+        body* b = body_at(first, stride, slots[k]);
+        if (prev_x && prev_y) {
+            prev_x[k] = b->x;
+            prev_y[k] = b->y;
+        }
+        if (frozen && frozen[k]) {
+            continue;
+        }
+        b->vx += b->ax * dt;
+        b->vy += b->ay * dt;
+        b->x += b->vx * dt;
+        b->y += b->vy * dt;
+    }
+}
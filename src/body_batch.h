@@ -0,0 +1,27 @@
+#ifndef V_TYPE_BODY_BATCH_H
+#define V_TYPE_BODY_BATCH_H
+
+#include "game.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * One explicit Euler step (v += a*dt, then p += v*dt) for the bodies of a
+ * struct array, picked by slot: the body of slot s lives at
+ * (char*)first + s * stride. Slots with frozen[k] set are left untouched
+ * (frozen may be NULL). When prev_x/prev_y are given, they receive each
+ * body's position before the step. Results match integrate_body bit for bit.
+ */
+void body_batch_integrate(
+    body* first,
+    size_t stride,
+    const int* slots,
+    const uint8_t* frozen,
+    int n,
+    float dt,
+    float* prev_x,
+    float* prev_y
+);
+
+#endif
@@ -384,12 +384,47 @@ int boss_build_parts(
     return count;
 }
 
+static void boss_index_part(boss_controller_runtime* ctrl, int enemy_index) {
+    int at;
+    if (!ctrl || ctrl->part_count >= BOSS_MAX_PARTS) {
+        return;
+    }
+    at = ctrl->part_count;
+    while (at > 0 && ctrl->part_slots[at - 1] >= enemy_index) {
+        if (ctrl->part_slots[at - 1] == enemy_index) {
+            return;
+        }
+        at -= 1;
+    }
+    for (int k = ctrl->part_count; k > at; --k) {
+        ctrl->part_slots[k] = ctrl->part_slots[k - 1];
+    }
+    ctrl->part_slots[at] = (int16_t)enemy_index;
+    ctrl->part_count += 1;
+}
+
+static void boss_prune_part_index(game_state* g, int owner_index) {
+    boss_controller_runtime* ctrl = &g->boss_controllers[owner_index];
+    int kept = 0;
+    for (int k = 0; k < ctrl->part_count; ++k) {
+        const int i = ctrl->part_slots[k];
+        if (!g->boss_attachments[i].active || g->boss_attachments[i].owner_index != owner_index) {
+            continue;
+        }
+        ctrl->part_slots[kept++] = (int16_t)i;
+    }
+    ctrl->part_count = kept;
+}
+
 static int boss_count_alive_parts_by_role(const game_state* g, int owner_index, int role) {
+    const boss_controller_runtime* ctrl;
     int count = 0;
     if (!g || owner_index < 0 || owner_index >= MAX_ENEMIES) {
         return 0;
     }
-    for (int i = 0; i < MAX_ENEMIES; ++i) {
+    ctrl = &g->boss_controllers[owner_index];
+    for (int k = 0; k < ctrl->part_count; ++k) {
+        const int i = ctrl->part_slots[k];
         if (!g->enemies[i].active || !g->boss_attachments[i].active) {
             continue;
         }
@@ -402,10 +437,13 @@ static int boss_count_alive_parts_by_role(const game_state* g, int owner_index,
 }
 
 static int boss_find_alive_child(const game_state* g, int owner_index) {
+    const boss_controller_runtime* ctrl;
     if (!g || owner_index < 0 || owner_index >= MAX_ENEMIES) {
         return -1;
     }
-    for (int i = 0; i < MAX_ENEMIES; ++i) {
+    ctrl = &g->boss_controllers[owner_index];
+    for (int k = 0; k < ctrl->part_count; ++k) {
+        const int i = ctrl->part_slots[k];
         if (!g->enemies[i].active || !g->boss_attachments[i].active) {
             continue;
         }
@@ -423,13 +461,15 @@ static int boss_collect_emitters(
     boss_emitter_point* out_emitters,
     int out_cap
 ) {
+    const boss_controller_runtime* ctrl;
     int count = 0;
     if (!g || !out_emitters || out_cap <= 0 || owner_index < 0 || owner_index >= MAX_ENEMIES) {
         return 0;
     }
-    for (int i = 0; i < MAX_ENEMIES; ++i) {
+    ctrl = &g->boss_controllers[owner_index];
+    for (int k = 0; k < ctrl->part_count; ++k) {
+        const int i = ctrl->part_slots[k];
         const boss_enemy_attachment* attachment = &g->boss_attachments[i];
-        const boss_controller_runtime* ctrl;
         const enemy* part;
         float world_rot;
         float c;
@@ -440,7 +480,6 @@ static int boss_collect_emitters(
         if (attachment->owner_index != owner_index || attachment->role != role || attachment->emitter_count <= 0) {
             continue;
         }
-        ctrl = &g->boss_controllers[owner_index];
         part = &g->enemies[i];
         world_rot = attachment->local_rot + boss_controller_roll(ctrl);
         c = cosf(world_rot);
@@ -459,21 +498,20 @@ static int boss_collect_emitters(
 }
 
 static void boss_tick_attachment_state(game_state* g, int owner_index, float dt) {
+    const boss_controller_runtime* ctrl;
     if (!g || owner_index < 0 || owner_index >= MAX_ENEMIES) {
         return;
     }
-    for (int i = 0; i < MAX_ENEMIES; ++i) {
+    if (g->boss_attachments[owner_index].active) {
+        g->enemies[owner_index].boss_telegraph = fmaxf(0.0f, g->enemies[owner_index].boss_telegraph - dt * 3.8f);
+    }
+    boss_prune_part_index(g, owner_index);
+    ctrl = &g->boss_controllers[owner_index];
+    for (int k = 0; k < ctrl->part_count; ++k) {
+        const int i = ctrl->part_slots[k];
         boss_enemy_attachment* attachment = &g->boss_attachments[i];
         enemy* part = &g->enemies[i];
-        if (!attachment->active) {
-            continue;
-        }
-        if (i == owner_index || attachment->owner_index == owner_index) {
-            part->boss_telegraph = fmaxf(0.0f, part->boss_telegraph - dt * 3.8f);
-        }
-        if (attachment->owner_index != owner_index) {
-            continue;
-        }
+        part->boss_telegraph = fmaxf(0.0f, part->boss_telegraph - dt * 3.8f);
         for (int emitter_index = 0; emitter_index < attachment->emitter_count; ++emitter_index) {
             attachment->emitter_cooldown_s[emitter_index] =
                 fmaxf(0.0f, attachment->emitter_cooldown_s[emitter_index] - dt);
@@ -565,7 +603,8 @@ static void boss_mark_whole_boss(game_state* g, int owner_index, float owner_str
         g->enemies[owner_index].boss_telegraph =
             fmaxf(g->enemies[owner_index].boss_telegraph, owner_strength);
     }
-    for (int i = 0; i < MAX_ENEMIES; ++i) {
+    for (int k = 0; k < g->boss_controllers[owner_index].part_count; ++k) {
+        const int i = g->boss_controllers[owner_index].part_slots[k];
         if (!g->boss_attachments[i].active || !g->enemies[i].active) {
             continue;
         }
@@ -733,7 +772,8 @@ static void boss_emit_phase_cue(game_state* g, int owner_index, int phase) {
         g->enemies[owner_index].boss_telegraph = 1.0f;
     }
     boss_mark_whole_boss(g, owner_index, 1.0f, 0.30f);
-    for (int i = 0; i < MAX_ENEMIES; ++i) {
+    for (int k = 0; k < g->boss_controllers[owner_index].part_count; ++k) {
+        const int i = g->boss_controllers[owner_index].part_slots[k];
         boss_enemy_attachment* attachment = &g->boss_attachments[i];
         enemy* part = &g->enemies[i];
         if (!attachment->active || !part->active || attachment->owner_index != owner_index) {
@@ -784,7 +824,8 @@ static void boss_apply_phase(game_state* g, int owner_index, int phase) {
     ctrl->support_cooldown_s = boss_support_cooldown_s(ctrl) * 0.7f;
     ctrl->movement_target_x = ctrl->anchor_x;
     ctrl->movement_target_y = ctrl->anchor_y;
-    for (int i = 0; i < MAX_ENEMIES; ++i) {
+    for (int k = 0; k < ctrl->part_count; ++k) {
+        const int i = ctrl->part_slots[k];
         boss_enemy_attachment* attachment = &g->boss_attachments[i];
         if (!attachment->active || attachment->owner_index != owner_index) {
             continue;
@@ -1272,7 +1313,8 @@ static void boss_begin_destruction(game_state* g, int owner_index) {
     ctrl->burst_gap_s = 999.0f;
     ctrl->telegraph_time_s = 0.0f;
     ctrl->telegraph_total_s = 0.0f;
-    for (int i = 0; i < MAX_ENEMIES; ++i) {
+    for (int k = 0; k < ctrl->part_count; ++k) {
+        const int i = ctrl->part_slots[k];
         boss_enemy_attachment* attachment = &g->boss_attachments[i];
         if (!attachment->active || attachment->owner_index != owner_index) {
             continue;
@@ -1538,6 +1580,7 @@ void boss_configure_part(
     }
     if (g->boss_controllers[owner_index].active) {
         g->boss_controllers[owner_index].live_part_count += 1;
+        boss_index_part(&g->boss_controllers[owner_index], enemy_index);
     }
 }
 
@@ -1647,7 +1690,8 @@ int boss_update_enemy(game_state* g, int enemy_index, float dt) {
         boss_reconcile_phase(g, enemy_index);
         boss_update_attacks(g, enemy_index, dt);
     }
-    for (int i = 0; i < MAX_ENEMIES; ++i) {
+    for (int k = 0; k < ctrl->part_count; ++k) {
+        const int i = ctrl->part_slots[k];
         if (g->boss_attachments[i].active && g->boss_attachments[i].owner_index == enemy_index && g->enemies[i].active) {
             boss_snap_part_to_owner(g, i, dt);
         }
@@ -1713,7 +1757,8 @@ void boss_on_enemy_damaged(game_state* g, int enemy_index, int damage_applied, i
     if (attachment->owner_index >= 0 && attachment->owner_index < MAX_ENEMIES && g->enemies[attachment->owner_index].active) {
         g->enemies[attachment->owner_index].boss_telegraph =
             fmaxf(g->enemies[attachment->owner_index].boss_telegraph, destroyed ? 0.85f : 0.60f);
-        for (int i = 0; i < MAX_ENEMIES; ++i) {
+        for (int k = 0; k < g->boss_controllers[attachment->owner_index].part_count; ++k) {
+            const int i = g->boss_controllers[attachment->owner_index].part_slots[k];
             if (!g->boss_attachments[i].active || !g->enemies[i].active) {
                 continue;
             }
@@ -1760,7 +1805,8 @@ void boss_on_enemy_destroyed(game_state* g, int enemy_index) {
         if (g->boss_controllers[enemy_index].gates_exit && g->gating_bosses_remaining > 0) {
             g->gating_bosses_remaining -= 1;
         }
-        for (int i = 0; i < MAX_ENEMIES; ++i) {
+        for (int k = 0; k < g->boss_controllers[enemy_index].part_count; ++k) {
+            const int i = g->boss_controllers[enemy_index].part_slots[k];
             if (!g->boss_attachments[i].active || g->boss_attachments[i].owner_index != enemy_index) {
                 continue;
             }
@@ -1,5 +1,7 @@
 #include "enemy.h"
+#include "body_batch.h"
 #include "boss.h"
+#include "worker_pool.h"
 
 #include <math.h>
 #include <stdio.h>
@@ -69,16 +71,16 @@ static void spawn_curated_boss_controller(
     float su
 );
 
-static float frand01(void) {
-    return (float)rand() / (float)RAND_MAX;
+static float frand01(game_state* g) {
+    return game_rng_float01(&g->rng);
 }
 
-static float frands1(void) {
-    return frand01() * 2.0f - 1.0f;
+static float frands1(game_state* g) {
+    return frand01(g) * 2.0f - 1.0f;
 }
 
-static float frand_range(float lo, float hi) {
-    return lo + (hi - lo) * frand01();
+static float frand_range(game_state* g, float lo, float hi) {
+    return lo + (hi - lo) * frand01(g);
 }
 
 static float hash01_u32(uint32_t x) {
@@ -264,7 +266,7 @@ static void eel_tail_anchor(const enemy* e, float* out_x, float* out_y) {
     *out_y = e->b.y - fy * head_back;
 }
 
-static void eel_seed_spine(enemy* e, int uses_cylinder, float period) {
+static void eel_seed_spine(const enemy* e, enemy_eel_spine* spine, int uses_cylinder, float period) {
     float anchor_x;
     float anchor_y;
     float fx = 1.0f;
@@ -272,7 +274,7 @@ static void eel_seed_spine(enemy* e, int uses_cylinder, float period) {
     float body_len;
     float seg_len;
     int n;
-    if (!e) {
+    if (!e || !spine) {
         return;
     }
     n = EEL_SPINE_POINTS;
@@ -283,51 +285,51 @@ static void eel_seed_spine(enemy* e, int uses_cylinder, float period) {
     eel_basis(e, &fx, &fy, NULL, NULL);
     body_len = (e->eel_body_length > 1.0f) ? e->eel_body_length : fmaxf(e->radius * 6.0f, 24.0f);
     seg_len = body_len / (float)(n - 1);
-    e->eel_spine_count = n;
+    spine->count = n;
     for (int i = 0; i < n; ++i) {
         const float along = (float)i * seg_len;
-        e->eel_spine_x[i] = anchor_x - fx * along;
-        e->eel_spine_y[i] = anchor_y - fy * along;
+        spine->x[i] = anchor_x - fx * along;
+        spine->y[i] = anchor_y - fy * along;
     }
     if (uses_cylinder && period > 1.0e-5f) {
         for (int i = 0; i < n; ++i) {
-            e->eel_spine_x[i] = wrap_position_near(e->eel_spine_x[i], anchor_x, period);
+            spine->x[i] = wrap_position_near(spine->x[i], anchor_x, period);
         }
     }
 }
 
-static void eel_update_spine(enemy* e, float dt, int uses_cylinder, float period) {
+static void eel_update_spine(const enemy* e, enemy_eel_spine* spine, float dt, int uses_cylinder, float period) {
     float anchor_x;
     float anchor_y;
     float body_len;
     float seg_len;
     int n;
-    if (!e) {
+    if (!e || !spine) {
         return;
     }
-    n = clampi(e->eel_spine_count, 0, EEL_SPINE_POINTS);
+    n = clampi(spine->count, 0, EEL_SPINE_POINTS);
     if (n < 2) {
-        eel_seed_spine(e, uses_cylinder, period);
-        n = clampi(e->eel_spine_count, 0, EEL_SPINE_POINTS);
+        eel_seed_spine(e, spine, uses_cylinder, period);
+        n = clampi(spine->count, 0, EEL_SPINE_POINTS);
         if (n < 2) {
             return;
         }
     }
     eel_tail_anchor(e, &anchor_x, &anchor_y);
     if (uses_cylinder && period > 1.0e-5f) {
-        anchor_x = wrap_position_near(anchor_x, e->eel_spine_x[0], period);
+        anchor_x = wrap_position_near(anchor_x, spine->x[0], period);
     }
-    e->eel_spine_x[0] = anchor_x;
-    e->eel_spine_y[0] = anchor_y;
+    spine->x[0] = anchor_x;
+    spine->y[0] = anchor_y;
 
     body_len = (e->eel_body_length > 1.0f) ? e->eel_body_length : fmaxf(e->radius * 6.0f, 24.0f);
     seg_len = body_len / (float)(n - 1);
 
     for (int i = 1; i < n; ++i) {
-        float prev_x = e->eel_spine_x[i - 1];
-        float prev_y = e->eel_spine_y[i - 1];
-        float cur_x = e->eel_spine_x[i];
-        float cur_y = e->eel_spine_y[i];
+        float prev_x = spine->x[i - 1];
+        float prev_y = spine->y[i - 1];
+        float cur_x = spine->x[i];
+        float cur_y = spine->y[i];
         float dx;
         float dy;
         float d;
@@ -356,18 +358,19 @@ static void eel_update_spine(enemy* e, float dt, int uses_cylinder, float period
             cur_x = prev_x - seg_len;
             cur_y = prev_y;
         }
-        e->eel_spine_x[i] = cur_x;
-        e->eel_spine_y[i] = cur_y;
+        spine->x[i] = cur_x;
+        spine->y[i] = cur_y;
     }
     if (uses_cylinder && period > 1.0e-5f) {
         for (int i = 0; i < n; ++i) {
-            e->eel_spine_x[i] = wrap_position_near(e->eel_spine_x[i], e->b.x, period);
+            spine->x[i] = wrap_position_near(spine->x[i], e->b.x, period);
         }
     }
 }
 
 static void eel_sample_body_point(
     const enemy* e,
+    const enemy_eel_spine* spine,
     float u01,
     float* out_x,
     float* out_y
@@ -388,14 +391,14 @@ static void eel_sample_body_point(
     if (!e || !out_x || !out_y) {
         return;
     }
-    spine_n = clampi(e->eel_spine_count, 0, EEL_SPINE_POINTS);
+    spine_n = spine ? clampi(spine->count, 0, EEL_SPINE_POINTS) : 0;
     if (spine_n >= 2) {
         const float u_spine = clampf(u01, 0.0f, 1.0f) * (float)(spine_n - 1);
         const int i0 = clampi((int)floorf(u_spine), 0, spine_n - 1);
         const int i1 = (i0 < spine_n - 1) ? (i0 + 1) : i0;
         const float t_spine = u_spine - (float)i0;
-        *out_x = lerpf(e->eel_spine_x[i0], e->eel_spine_x[i1], t_spine);
-        *out_y = lerpf(e->eel_spine_y[i0], e->eel_spine_y[i1], t_spine);
+        *out_x = lerpf(spine->x[i0], spine->x[i1], t_spine);
+        *out_y = lerpf(spine->y[i0], spine->y[i1], t_spine);
         return;
     }
     eel_basis(e, &fx, &fy, &nx, &ny);
@@ -484,6 +487,31 @@ static int structure_blocks_enemy(const leveldef_structure_instance* st) {
     return st->layer == 0;
 }
 
+void enemy_rebuild_structure_index(game_state* g) {
+    const leveldef_level* lvl;
+    if (!g) {
+        return;
+    }
+    lvl = game_current_leveldef(g);
+    structure_index_begin(&g->enemy_structure_index);
+    if (!lvl || g->render_style == LEVEL_RENDER_CYLINDER) {
+        return;
+    }
+    for (int i = 0; i < lvl->structure_count && i < LEVELDEF_MAX_STRUCTURES; ++i) {
+        const leveldef_structure_instance* st = &lvl->structures[i];
+        float min_x;
+        float min_y;
+        float max_x;
+        float max_y;
+        if (!structure_blocks_enemy(st)) {
+            continue;
+        }
+        structure_aabb_world_enemy(g, st, &min_x, &min_y, &max_x, &max_y);
+        (void)structure_index_add(&g->enemy_structure_index, min_x, min_y, max_x, max_y);
+    }
+    structure_index_finish(&g->enemy_structure_index);
+}
+
 static int swarm_structure_collision_response(
     const game_state* g,
     float x,
@@ -493,7 +521,9 @@ static int swarm_structure_collision_response(
     float* out_ny,
     float* out_penetration
 ) {
-    const leveldef_level* lvl;
+    const structure_index* si;
+    int cand[STRUCTURE_INDEX_CAP];
+    int n;
     float best_pen = 0.0f;
     float best_nx = 0.0f;
     float best_ny = 0.0f;
@@ -504,16 +534,14 @@ static int swarm_structure_collision_response(
     if (g->render_style == LEVEL_RENDER_CYLINDER) {
         return 0;
     }
-    lvl = game_current_leveldef(g);
-    if (!lvl || lvl->structure_count <= 0) {
-        return 0;
-    }
-    for (int i = 0; i < lvl->structure_count && i < LEVELDEF_MAX_STRUCTURES; ++i) {
-        const leveldef_structure_instance* st = &lvl->structures[i];
-        float min_x;
-        float min_y;
-        float max_x;
-        float max_y;
+    si = &g->enemy_structure_index;
+    n = structure_index_query_x(si, x - radius, x + radius, cand, STRUCTURE_INDEX_CAP);
+    for (int k = 0; k < n; ++k) {
+        const int i = cand[k];
+        const float min_x = si->min_x[i];
+        const float min_y = si->min_y[i];
+        const float max_x = si->max_x[i];
+        const float max_y = si->max_y[i];
         float nearest_x;
         float nearest_y;
         float dx;
@@ -522,10 +550,6 @@ static int swarm_structure_collision_response(
         float nx;
         float ny;
         float pen;
-        if (!structure_blocks_enemy(st)) {
-            continue;
-        }
-        structure_aabb_world_enemy(g, st, &min_x, &min_y, &max_x, &max_y);
         nearest_x = fmaxf(min_x, fminf(x, max_x));
         nearest_y = fmaxf(min_y, fminf(y, max_y));
         dx = x - nearest_x;
@@ -630,57 +654,76 @@ static void game_push_audio_event(game_state* g, game_audio_event_type type, flo
     e->y = y;
 }
 
-static particle* alloc_particle(game_state* g) {
-    for (size_t i = 0; i < MAX_PARTICLES; ++i) {
-        if (!g->particles[i].active) {
-            particle* p = &g->particles[i];
-            memset(p, 0, sizeof(*p));
-            p->active = 1;
-            g->active_particles += 1;
-            return p;
-        }
+static particle* alloc_particle(game_state* g, particle* spawn) {
+    if (g->particles.count >= g->caps.particles) {
+        return NULL;
     }
-    return NULL;
+    memset(spawn, 0, sizeof(*spawn));
+    return spawn;
+}
+
+static void kill_bullet(game_state* g, bullet* b) {
+    b->active = 0;
+    slot_pool_release(&g->bullet_pool, (int)(b - g->bullets));
+}
+
+static void kill_enemy_bullet(game_state* g, enemy_bullet* b) {
+    b->active = 0;
+    slot_pool_release(&g->enemy_bullet_pool, (int)(b - g->enemy_bullets));
+}
+
+static void kill_debris(game_state* g, enemy_debris* d) {
+    d->active = 0;
+    slot_pool_release(&g->debris_pool, (int)(d - g->debris));
+}
+
+static void kill_eel_arc(game_state* g, eel_arc_effect* arc) {
+    arc->active = 0;
+    slot_pool_release(&g->eel_arc_pool, (int)(arc - g->eel_arcs));
 }
 
 static void emit_explosion(game_state* g, float x, float y, float bias_vx, float bias_vy, int count, float su) {
     game_push_audio_event(g, GAME_AUDIO_EVENT_EXPLOSION, x, y);
     {
-        particle* f = alloc_particle(g);
+        particle spawn;
+        particle* f = alloc_particle(g, &spawn);
         if (f) {
             f->type = PARTICLE_FLASH;
             f->b.x = x;
             f->b.y = y;
             f->age_s = 0.0f;
-            f->life_s = 0.20f + frand01() * 0.08f;
-            f->size = (10.0f + frand01() * 7.0f) * su;
+            f->life_s = 0.20f + frand01(g) * 0.08f;
+            f->size = (10.0f + frand01(g) * 7.0f) * su;
             f->r = 1.0f;
             f->g = 0.96f;
             f->bcol = 0.72f;
             f->a = 1.0f;
+            game_push_particle(g, f);
         }
     }
     for (int i = 0; i < count; ++i) {
-        particle* p = alloc_particle(g);
+        particle spawn;
+        particle* p = alloc_particle(g, &spawn);
         if (!p) {
             return;
         }
-        const float a = frand01() * 6.2831853f;
-        const float spd = (70.0f + frand01() * 300.0f) * su;
-        p->type = (frand01() < 0.65f) ? PARTICLE_POINT : PARTICLE_GEOM;
-        p->b.x = x + frands1() * 6.0f * su;
-        p->b.y = y + frands1() * 6.0f * su;
+        const float a = frand01(g) * 6.2831853f;
+        const float spd = (70.0f + frand01(g) * 300.0f) * su;
+        p->type = (frand01(g) < 0.65f) ? PARTICLE_POINT : PARTICLE_GEOM;
+        p->b.x = x + frands1(g) * 6.0f * su;
+        p->b.y = y + frands1(g) * 6.0f * su;
         p->b.vx = cosf(a) * spd + bias_vx * 0.4f;
         p->b.vy = sinf(a) * spd + bias_vy * 0.4f;
         p->age_s = 0.0f;
-        p->life_s = 0.55f + frand01() * 0.85f;
-        p->size = (2.7f + frand01() * 6.2f) * su;
-        p->spin = frand01() * 6.2831853f;
-        p->spin_rate = frands1() * 9.0f;
-        p->r = 0.95f + frand01() * 0.05f;
-        p->g = 0.55f + frand01() * 0.45f;
-        p->bcol = 0.25f + frand01() * 0.40f;
+        p->life_s = 0.55f + frand01(g) * 0.85f;
+        p->size = (2.7f + frand01(g) * 6.2f) * su;
+        p->spin = frand01(g) * 6.2831853f;
+        p->spin_rate = frands1(g) * 9.0f;
+        p->r = 0.95f + frand01(g) * 0.05f;
+        p->g = 0.55f + frand01(g) * 0.45f;
+        p->bcol = 0.25f + frand01(g) * 0.40f;
         p->a = 1.0f;
+        game_push_particle(g, p);
     }
 }
 
@@ -734,7 +777,7 @@ static void emit_manta_turbulence(game_state* g, const enemy* e, float dt, float
     float want = emit_rate * fmaxf(dt, 0.0f);
     int emit_count = (int)want;
     want -= (float)emit_count;
-    if (frand01() < want) {
+    if (frand01(g) < want) {
         emit_count += 1;
     }
     if (emit_count > 3) {
@@ -753,7 +796,7 @@ static void emit_manta_turbulence(game_state* g, const enemy* e, float dt, float
 
     for (int pi = 0; pi < emit_count; ++pi) {
         /* Bias toward the trailing half, where the traveling wave reads strongest. */
-        const float r = frand01();
+        const float r = frand01(g);
         float u = 0.12f + 0.84f * (1.0f - powf(r, 1.7f));
         u = clampf(u, 0.06f, 0.94f);
 
@@ -783,14 +826,15 @@ static void emit_manta_turbulence(game_state* g, const enemy* e, float dt, float
 
         /* Skip weak wave regions so the turbulence clusters into a readable ripple. */
         const float wave_abs = fabsf(wave_n);
-        if (frand01() > clampf(wave_abs * 1.35f, 0.15f, 1.0f)) {
+        if (frand01(g) > clampf(wave_abs * 1.35f, 0.15f, 1.0f)) {
             continue;
         }
 
         const float edge_x = e->b.x + fx * f;
         const float edge_y = e->b.y + outer_n;
 
-        particle* p = alloc_particle(g);
+        particle spawn;
+        particle* p = alloc_particle(g, &spawn);
         if (!p) {
             return;
         }
@@ -800,22 +844,23 @@ static void emit_manta_turbulence(game_state* g, const enemy* e, float dt, float
         const float up_spd = (20.0f + 90.0f * strength) * su * ((flap_vel >= 0.0f) ? 1.0f : -1.0f);
         /* Use FLASH so GPU heat stays "hot" (avoids the global orange heat-tint that point/geom get at heat=0). */
         p->type = PARTICLE_FLASH;
-        p->b.x = edge_x - fx * (3.0f + frand01() * 3.5f) * su + frands1() * 2.0f * su;
-        p->b.y = edge_y + frands1() * 2.5f * su;
-        p->b.vx = -fx * back_spd + frands1() * 40.0f * su + e->b.vx * 0.30f;
-        p->b.vy = up_spd + frands1() * 40.0f * su;
+        p->b.x = edge_x - fx * (3.0f + frand01(g) * 3.5f) * su + frands1(g) * 2.0f * su;
+        p->b.y = edge_y + frands1(g) * 2.5f * su;
+        p->b.vx = -fx * back_spd + frands1(g) * 40.0f * su + e->b.vx * 0.30f;
+        p->b.vy = up_spd + frands1(g) * 40.0f * su;
         p->b.ax = -p->b.vx * 4.2f;
         p->b.ay = -p->b.vy * 4.2f;
         p->age_s = 0.0f;
-        p->life_s = 0.11f + frand01() * 0.12f;
-        p->size = (1.2f + frand01() * 1.9f) * su;
-        p->spin = frand01() * 6.2831853f;
-        p->spin_rate = frands1() * 10.0f;
+        p->life_s = 0.11f + frand01(g) * 0.12f;
+        p->size = (1.2f + frand01(g) * 1.9f) * su;
+        p->spin = frand01(g) * 6.2831853f;
+        p->spin_rate = frands1(g) * 10.0f;
         /* Blue-green water shimmer; shader heat tint warms slightly. */
         p->r = 0.30f;
         p->g = 0.92f;
         p->bcol = 1.00f;
         p->a = 0.08f + 0.12f * strength;
+        game_push_particle(g, p);
     }
 }
 
@@ -878,25 +923,22 @@ static void emit_enemy_debris(game_state* g, const enemy* e, float impact_vx, fl
         return;
     }
     for (int seg = 0; seg < 4; ++seg) {
-        for (size_t i = 0; i < MAX_ENEMY_DEBRIS; ++i) {
+        const int i = slot_pool_alloc(&g->debris_pool, g->caps.debris);
+        if (i >= 0) {
             enemy_debris* d = &g->debris[i];
-            if (d->active) {
-                continue;
-            }
             d->active = 1;
             d->half_len = e->radius * 0.52f;
             d->angle = atan2f(ty[seg] - ny[seg], tx[seg] - nx[seg]);
-            d->spin_rate = frands1() * (6.0f + 6.0f * frand01());
+            d->spin_rate = frands1(g) * (6.0f + 6.0f * frand01(g));
             d->b.x = e->b.x + (nx[seg] + tx[seg]) * 0.5f * e->radius;
             d->b.y = e->b.y + (ny[seg] + ty[seg]) * 0.5f * e->radius;
-            d->b.vx = e->b.vx * 0.18f + impact_vx * (0.10f + 0.08f * frand01()) + frands1() * 46.0f;
-            d->b.vy = e->b.vy * 0.10f + impact_vy * 0.08f + frands1() * 34.0f + 22.0f;
+            d->b.vx = e->b.vx * 0.18f + impact_vx * (0.10f + 0.08f * frand01(g)) + frands1(g) * 46.0f;
+            d->b.vy = e->b.vy * 0.10f + impact_vy * 0.08f + frands1(g) * 34.0f + 22.0f;
             d->b.ax = -d->b.vx * 0.16f;
             d->b.ay = -260.0f;
             d->age_s = 0.0f;
-            d->life_s = 2.2f + frand01() * 1.0f;
+            d->life_s = 2.2f + frand01(g) * 1.0f;
             d->alpha = 1.0f;
-            break;
         }
     }
 }
@@ -1003,28 +1045,27 @@ static enemy_bullet* spawn_enemy_bullet(
     float ttl_s,
     float radius
 ) {
-    for (size_t i = 0; i < MAX_ENEMY_BULLETS; ++i) {
-        if (g->enemy_bullets[i].active) {
-            continue;
-        }
-        enemy_bullet* b = &g->enemy_bullets[i];
-        b->active = 1;
-        b->ttl_s = ttl_s;
-        b->radius = radius;
-        b->b.x = e->b.x + dir_x * (e->radius + 8.0f);
-        b->b.y = e->b.y + dir_y * (e->radius + 8.0f);
-        b->b.vx = dir_x * speed + e->b.vx * 0.22f;
-        b->b.vy = dir_y * speed + e->b.vy * 0.22f;
-        b->b.ax = 0.0f;
-        b->b.ay = 0.0f;
-        return b;
+    const int i = slot_pool_alloc(&g->enemy_bullet_pool, g->caps.enemy_bullets);
+    enemy_bullet* b;
+    if (i < 0) {
+        return NULL;
     }
-    return NULL;
+    b = &g->enemy_bullets[i];
+    b->active = 1;
+    b->ttl_s = ttl_s;
+    b->radius = radius;
+    b->b.x = e->b.x + dir_x * (e->radius + 8.0f);
+    b->b.y = e->b.y + dir_y * (e->radius + 8.0f);
+    b->b.vx = dir_x * speed + e->b.vx * 0.22f;
+    b->b.vy = dir_y * speed + e->b.vy * 0.22f;
+    b->b.ax = 0.0f;
+    b->b.ay = 0.0f;
+    return b;
 }
 
-static void enemy_reset_fire_cooldown(const enemy_weapon_def* w, const enemy_fire_tuning* t, enemy* e) {
+static void enemy_reset_fire_cooldown(game_state* g, const enemy_weapon_def* w, const enemy_fire_tuning* t, enemy* e) {
     const float scale = t ? t->cooldown_scale : 1.0f;
-    e->fire_cooldown_s = frand_range(w->cooldown_min_s, w->cooldown_max_s) * scale * frand_range(0.92f, 1.08f);
+    e->fire_cooldown_s = frand_range(g, w->cooldown_min_s, w->cooldown_max_s) * scale * frand_range(g, 0.92f, 1.08f);
     if (e->fire_cooldown_s < 0.04f) {
         e->fire_cooldown_s = 0.04f;
     }
@@ -1051,14 +1092,14 @@ static void enemy_assign_combat_loadout(game_state* g, enemy* e, const leveldef_
         /* Swarm units are always armed; firing chance is evaluated per fire attempt. */
         e->armed = 1;
         e->fire_prob = fire_p;
-        e->weapon_id = (frand01() < spread_p) ? ENEMY_WEAPON_SPREAD : ENEMY_WEAPON_PULSE;
+        e->weapon_id = (frand01(g) < spread_p) ? ENEMY_WEAPON_SPREAD : ENEMY_WEAPON_PULSE;
     } else if (e->archetype == ENEMY_ARCH_KAMIKAZE) {
         float kamikaze_fire_p = t.armed_probability[arch] * 0.02f;
         if (curated) {
             kamikaze_fire_p *= curated->kamikaze.fire_prob_mul;
         }
         kamikaze_fire_p = clampf(kamikaze_fire_p, 0.0f, 1.0f);
-        e->armed = (frand01() < kamikaze_fire_p) ? 1 : 0;
+        e->armed = (frand01(g) < kamikaze_fire_p) ? 1 : 0;
         e->fire_prob = 1.0f;
         e->weapon_id = ENEMY_WEAPON_BURST;
     } else {
@@ -1067,7 +1108,7 @@ static void enemy_assign_combat_loadout(game_state* g, enemy* e, const leveldef_
             formation_fire_p *= curated->formation.fire_prob_mul;
         }
         formation_fire_p = clampf(formation_fire_p, 0.0f, 1.0f);
-        e->armed = (frand01() < formation_fire_p) ? 1 : 0;
+        e->armed = (frand01(g) < formation_fire_p) ? 1 : 0;
         e->fire_prob = 1.0f;
         e->weapon_id = ENEMY_WEAPON_PULSE;
     }
@@ -1087,20 +1128,22 @@ static void enemy_assign_combat_loadout(game_state* g, enemy* e, const leveldef_
             .aim_lead_s = combat->weapon[e->weapon_id].aim_lead_s
         };
         enemy_apply_curated_projectile_tuning(g, e, &w, &t);
-        enemy_reset_fire_cooldown(&w, &t, e);
+        enemy_reset_fire_cooldown(g, &w, &t, e);
     }
 }
 
 static enemy* spawn_enemy_common(game_state* g, float su) {
-    for (size_t i = 0; i < MAX_ENEMIES; ++i) {
+    for (int i = 0; i < g->caps.enemies; ++i) {
         if (g->enemies[i].active) {
             continue;
         }
         enemy* e = &g->enemies[i];
         memset(e, 0, sizeof(*e));
-        boss_reset_enemy_runtime(g, (int)i);
+        boss_reset_enemy_runtime(g, i);
+        g->swarm_hash_valid = 0;
         e->active = 1;
-        e->radius = (12.0f + frand01() * 8.0f) * su;
+        e->serial = ++g->enemy_serial_alloc;
+        e->radius = (12.0f + frand01(g) * 8.0f) * su;
         e->max_speed = 270.0f * su;
         e->accel = 6.0f;
         e->lane_dir = -1.0f;
@@ -1136,7 +1179,8 @@ static enemy* spawn_enemy_common(game_state* g, float su) {
         e->eel_weapon_fire_rate = 0.0f;
         e->eel_weapon_duration_s = 0.0f;
         e->eel_weapon_damage_interval_s = 0.0f;
-        e->eel_spine_count = 0;
+        g->eel_spines[i].count = 0;
+        g->enemy_lod_debt_s[i] = 0.0f;
         return e;
     }
     return NULL;
@@ -1147,7 +1191,7 @@ static int enemy_free_slot_count(const game_state* g) {
     if (!g) {
         return 0;
     }
-    for (size_t i = 0; i < MAX_ENEMIES; ++i) {
+    for (int i = 0; i < g->caps.enemies; ++i) {
         if (!g->enemies[i].active) {
             free_count += 1;
         }
@@ -1162,7 +1206,7 @@ static void spawn_curated_boss_controller(
     float su
 ) {
     const boss_blueprint* blueprint;
-    boss_part_blueprint built_parts[16];
+    boss_part_blueprint built_parts[BOSS_MAX_PARTS];
     int built_count;
     enemy* controller;
     int boss_id;
@@ -1264,7 +1308,7 @@ static void enforce_auto_spawn_side(game_state* g, enemy* e, int bidirectional_s
     {
         const float min_x = g->camera_x + g->world_w * 0.56f;
         if (e->b.x < min_x) {
-            e->b.x = min_x + frand01() * (g->world_w * 0.16f);
+            e->b.x = min_x + frand01(g) * (g->world_w * 0.16f);
         }
     }
 }
@@ -1303,7 +1347,7 @@ static void spawn_wave_sine_snake(game_state* g, const leveldef_db* db, const le
     if (w->count <= 0) {
         return;
     }
-    const float spawn_side = bidirectional_spawns ? ((frand01() < 0.5f) ? -1.0f : 1.0f) : 1.0f;
+    const float spawn_side = bidirectional_spawns ? ((frand01(g) < 0.5f) ? -1.0f : 1.0f) : 1.0f;
     for (int i = 0; i < w->count; ++i) {
         enemy* e = spawn_enemy_common(g, su);
         if (!e) {
@@ -1335,7 +1379,7 @@ static void spawn_wave_v_formation(game_state* g, const leveldef_db* db, const l
     if (w->count <= 0) {
         return;
     }
-    const float spawn_side = bidirectional_spawns ? ((frand01() < 0.5f) ? -1.0f : 1.0f) : 1.0f;
+    const float spawn_side = bidirectional_spawns ? ((frand01(g) < 0.5f) ? -1.0f : 1.0f) : 1.0f;
     const int mid = w->count / 2;
     for (int i = 0; i < w->count; ++i) {
         enemy* e = spawn_enemy_common(g, su);
@@ -1357,7 +1401,7 @@ static void spawn_wave_v_formation(game_state* g, const leveldef_db* db, const l
         e->form_phase = (float)i * w->phase_step;
         e->form_amp = w->form_amp * su;
         e->form_freq = w->form_freq;
-        e->break_delay_s = w->break_delay_min + frand01() * w->break_delay_rand;
+        e->break_delay_s = w->break_delay_min + frand01(g) * w->break_delay_rand;
         e->max_speed = w->max_speed * su;
         e->accel = w->accel;
         enemy_adjust_spawn_clear(g, e, su);
@@ -1367,6 +1411,7 @@ static void spawn_wave_v_formation(game_state* g, const leveldef_db* db, const l
 static void spawn_wave_swarm_profile(
     game_state* g,
     const leveldef_db* db,
+    const leveldef_level* lvl,
     int wave_id,
     int profile_id,
     int boid_style,
@@ -1375,10 +1420,12 @@ static void spawn_wave_swarm_profile(
     float su
 ) {
     const leveldef_boid_profile* p = leveldef_get_boid_profile(db, profile_id);
+    int count;
     if (!p) {
         return;
     }
-    for (int i = 0; i < p->count; ++i) {
+    count = (lvl && lvl->swarm_count > 0) ? lvl->swarm_count : p->count;
+    for (int i = 0; i < count; ++i) {
         enemy* e = spawn_enemy_common(g, su);
         if (!e) {
             break;
@@ -1391,16 +1438,16 @@ static void spawn_wave_swarm_profile(
         apply_boid_visual_style(e, boid_style, wave_id, i);
         if (bidirectional_spawns) {
             const float spawn_side = (goal_dir < 0.0f) ? 1.0f : -1.0f;
-            e->b.x = g->camera_x + spawn_side * (g->world_w * p->spawn_x01 + frand01() * p->spawn_x_span * su);
+            e->b.x = g->camera_x + spawn_side * (g->world_w * p->spawn_x01 + frand01(g) * p->spawn_x_span * su);
         } else {
-            e->b.x = g->camera_x + g->world_w * p->spawn_x01 + frand01() * p->spawn_x_span * su;
+            e->b.x = g->camera_x + g->world_w * p->spawn_x01 + frand01(g) * p->spawn_x_span * su;
         }
         enforce_auto_spawn_side(g, e, bidirectional_spawns);
-        e->b.y = g->world_h * p->spawn_y01 + frands1() * p->spawn_y_span * su;
+        e->b.y = g->world_h * p->spawn_y01 + frands1(g) * p->spawn_y_span * su;
         e->home_y = g->world_h * p->spawn_y01;
         e->max_speed = p->max_speed * su;
         e->accel = p->accel;
-        e->radius = (p->radius_min + frand01() * (p->radius_max - p->radius_min)) * su;
+        e->radius = (p->radius_min + frand01(g) * (p->radius_max - p->radius_min)) * su;
         e->swarm_sep_w = p->sep_w;
         e->swarm_ali_w = p->ali_w;
         e->swarm_coh_w = p->coh_w;
@@ -1542,7 +1589,7 @@ static void spawn_wave_kamikaze(game_state* g, const leveldef_db* db, const leve
         return;
     }
     {
-        const float spawn_side = bidirectional_spawns ? ((frand01() < 0.5f) ? -1.0f : 1.0f) : 1.0f;
+        const float spawn_side = bidirectional_spawns ? ((frand01(g) < 0.5f) ? -1.0f : 1.0f) : 1.0f;
         for (int i = 0; i < w->count; ++i) {
             enemy* e = spawn_enemy_common(g, su);
             if (!e) {
@@ -1558,19 +1605,19 @@ static void spawn_wave_kamikaze(game_state* g, const leveldef_db* db, const leve
             enforce_auto_spawn_side(g, e, bidirectional_spawns);
             {
                 const float margin = w->y_margin * su;
-                e->b.y = margin + frand01() * fmaxf(g->world_h - 2.0f * margin, 1.0f);
+                e->b.y = margin + frand01(g) * fmaxf(g->world_h - 2.0f * margin, 1.0f);
             }
             e->max_speed = w->max_speed * su;
             e->accel = w->accel;
             {
                 const float r_span = fmaxf(w->radius_max - w->radius_min, 0.0f);
-                const float r01 = (r_span > 1e-4f) ? frand01() : 0.5f;
+                const float r01 = (r_span > 1e-4f) ? frand01(g) : 0.5f;
                 e->radius = (w->radius_min + r01 * r_span) * su;
                 e->kamikaze_thrust_scale = lerpf(1.00f, 1.50f, r01);
                 e->kamikaze_glide_scale = lerpf(1.00f, 1.70f, r01);
             }
             e->ai_timer_s = 0.0f;
-            e->break_delay_s = 0.90f + frand01() * 0.65f;
+            e->break_delay_s = 0.90f + frand01(g) * 0.65f;
             e->facing_x = lane_dir_toward_player_x(g, e->b.x, 0, 0.0f);
             e->facing_y = 0.0f;
             e->kamikaze_tail = 0.18f;
@@ -1634,12 +1681,12 @@ void enemy_spawn_boss_support_wave(game_state* g, int owner_index, int phase, ui
                 enemy_assign_combat_loadout(g, e, db);
                 e->wave_id = wave_id;
                 e->slot_index = i;
-                e->b.x = owner->b.x + owner->radius * 0.16f + frands1() * owner->radius * 0.24f;
-                e->b.y = owner->b.y + frands1() * owner->radius * 0.34f;
+                e->b.x = owner->b.x + owner->radius * 0.16f + frands1(g) * owner->radius * 0.24f;
+                e->b.y = owner->b.y + frands1(g) * owner->radius * 0.34f;
                 e->home_y = e->b.y;
                 e->max_speed = p->max_speed * su * 1.08f;
                 e->accel = p->accel * 1.10f;
-                e->radius = (p->radius_min + frand01() * fmaxf(p->radius_max - p->radius_min, 0.0f)) * su * 0.92f;
+                e->radius = (p->radius_min + frand01(g) * fmaxf(p->radius_max - p->radius_min, 0.0f)) * su * 0.92f;
                 e->swarm_sep_r = p->sep_r * su;
                 e->swarm_ali_r = p->ali_r * su;
                 e->swarm_coh_r = p->coh_r * su;
@@ -1675,20 +1722,20 @@ void enemy_spawn_boss_support_wave(game_state* g, int owner_index, int phase, ui
         e->slot_index = boid_count + i;
         apply_kamikaze_visual_style(e, (phase >= 2) ? KAMIKAZE_STYLE_PHOENIX : KAMIKAZE_STYLE_CLASSIC, wave_id, i);
         e->b.x = owner->b.x + owner->radius * 0.26f + slot * fmaxf(72.0f * su, owner->radius * 0.12f);
-        e->b.y = owner->b.y + frands1() * owner->radius * 0.28f;
+        e->b.y = owner->b.y + frands1(g) * owner->radius * 0.28f;
         e->max_speed = lvl->kamikaze.max_speed * su * 1.18f;
         e->accel = lvl->kamikaze.accel * 1.12f;
         {
             const float r_span = fmaxf(lvl->kamikaze.radius_max - lvl->kamikaze.radius_min, 0.0f);
-            const float r01 = (r_span > 1.0e-4f) ? frand01() : 0.5f;
+            const float r01 = (r_span > 1.0e-4f) ? frand01(g) : 0.5f;
             e->radius = (lvl->kamikaze.radius_min + r01 * r_span) * su * 0.92f;
             e->kamikaze_thrust_scale = lerpf(1.00f, 1.50f, r01);
             e->kamikaze_glide_scale = lerpf(1.00f, 1.70f, r01);
         }
         e->ai_timer_s = 0.0f;
-        e->break_delay_s = 0.32f + frand01() * 0.24f;
+        e->break_delay_s = 0.32f + frand01(g) * 0.24f;
         e->facing_x = lane_dir_toward_player_x(g, e->b.x, 0, 0.0f);
-        e->facing_y = frands1() * 0.08f;
+        e->facing_y = frands1(g) * 0.08f;
         normalize2(&e->facing_x, &e->facing_y);
         e->kamikaze_tail = 0.18f;
         e->kamikaze_thrust = 0.0f;
@@ -1745,12 +1792,12 @@ void enemy_spawn_curated_enemy(
             enemy_assign_combat_loadout(g, e, db);
             e->wave_id = wave_id;
             e->slot_index = i;
-            e->b.x = g->world_w * ce->x01 + frands1() * 14.0f * su;
-            e->b.y = g->world_h * ce->y01 + frands1() * 20.0f * su;
+            e->b.x = g->world_w * ce->x01 + frands1(g) * 14.0f * su;
+            e->b.y = g->world_h * ce->y01 + frands1(g) * 20.0f * su;
             e->home_y = g->world_h * ce->y01;
             e->max_speed = ((ce->b > 0.0f && !legacy_default_override) ? ce->b : p->max_speed) * su;
             e->accel = ((ce->c > 0.0f && !legacy_default_override) ? ce->c : p->accel);
-            e->radius = (p->radius_min + frand01() * fmaxf(p->radius_max - p->radius_min, 0.0f)) * su;
+            e->radius = (p->radius_min + frand01(g) * fmaxf(p->radius_max - p->radius_min, 0.0f)) * su;
             if (is_regular_boid) {
                 const float size_scale = boid_size_scale_from_value(ce->e);
                 e->radius *= size_scale;
@@ -1835,10 +1882,10 @@ void enemy_spawn_curated_enemy(
                 e->swarm_min_speed = e->eel_min_speed;
                 e->swarm_turn_rate_rad = e->eel_turn_rate_rad;
                 e->facing_x = lane_dir_toward_player_x(g, e->b.x, uses_cylinder, period);
-                e->facing_y = frands1() * 0.18f;
+                e->facing_y = frands1(g) * 0.18f;
                 normalize2(&e->facing_x, &e->facing_y);
                 e->eel_heading_rad = atan2f(e->facing_y, e->facing_x);
-                eel_seed_spine(e, uses_cylinder, period);
+                eel_seed_spine(e, &g->eel_spines[e - g->enemies], uses_cylinder, period);
                 e->armed = 1;
                 e->weapon_id = ENEMY_WEAPON_BURST;
                 e->fire_cooldown_s = 0.18f + 0.95f * hash01_u32(seed ^ 0xD41u);
@@ -1858,15 +1905,15 @@ void enemy_spawn_curated_enemy(
         e->wave_id = wave_id;
         e->slot_index = i;
         e->b.x = g->world_w * ce->x01 + (float)i * 18.0f * su;
-        e->b.y = g->world_h * ce->y01 + frands1() * 10.0f * su;
+        e->b.y = g->world_h * ce->y01 + frands1(g) * 10.0f * su;
 
         if (ce->kind == 4) {
             const float slot = (float)i - 0.5f * (float)(count - 1);
             const float base_x = g->world_w * ce->x01;
             const float base_y = g->world_h * ce->y01;
             const float spread_x = fmaxf(24.0f * su, g->world_w * 0.030f);
-            const float jitter_x = (frand01() - 0.5f) * fmaxf(10.0f * su, g->world_w * 0.010f);
-            const float jitter_y = (frand01() - 0.5f) * fmaxf(26.0f * su, g->world_h * 0.060f);
+            const float jitter_x = (frand01(g) - 0.5f) * fmaxf(10.0f * su, g->world_w * 0.010f);
+            const float jitter_y = (frand01(g) - 0.5f) * fmaxf(26.0f * su, g->world_h * 0.060f);
             e->archetype = ENEMY_ARCH_KAMIKAZE;
             e->state = ENEMY_STATE_KAMIKAZE_COIL;
             enemy_assign_combat_loadout(g, e, db);
@@ -1886,13 +1933,13 @@ void enemy_spawn_curated_enemy(
             }
             {
                 const float r_span = fmaxf(lvl->kamikaze.radius_max - lvl->kamikaze.radius_min, 0.0f);
-                const float r01 = (r_span > 1e-4f) ? frand01() : 0.5f;
+                const float r01 = (r_span > 1e-4f) ? frand01(g) : 0.5f;
                 e->radius = (lvl->kamikaze.radius_min + r01 * r_span) * su;
                 e->kamikaze_thrust_scale = lerpf(1.00f, 1.50f, r01);
                 e->kamikaze_glide_scale = lerpf(1.00f, 1.70f, r01);
             }
             e->ai_timer_s = 0.0f;
-            e->break_delay_s = 0.85f + frand01() * 0.60f;
+            e->break_delay_s = 0.85f + frand01(g) * 0.60f;
             e->facing_x = lane_dir_toward_player_x(g, e->b.x, uses_cylinder, period);
             e->facing_y = 0.0f;
             e->kamikaze_tail = 0.18f;
@@ -1948,8 +1995,8 @@ void enemy_spawn_curated_enemy(
                 e->form_freq = 0.0f;
                 e->max_speed = 240.0f * su;
                 e->accel = 1.9f;
-                e->fire_cooldown_s = 1.0f + frand01() * 0.8f;
-                e->missile_cooldown_s = 2.8f + frand01() * 2.0f;
+                e->fire_cooldown_s = 1.0f + frand01(g) * 0.8f;
+                e->missile_cooldown_s = 2.8f + frand01(g) * 2.0f;
                 if (curated) {
                     e->missile_cooldown_s *= curated->manta.missile_cooldown_mul;
                 }
@@ -1986,11 +2033,11 @@ void enemy_spawn_next_wave(
             }
             announce_wave(g, p->wave_name);
             {
-                const float dir = bidirectional_spawns ? ((frand01() < 0.5f) ? -1.0f : 1.0f) : 1.0f;
-                spawn_wave_swarm_profile(g, db, wave_id, profile_id, BOID_STYLE_CLASSIC, dir, bidirectional_spawns, su);
-                if (bidirectional_spawns && g->wave_index >= 4 && frand01() < lvl->cylinder_double_swarm_chance) {
+                const float dir = bidirectional_spawns ? ((frand01(g) < 0.5f) ? -1.0f : 1.0f) : 1.0f;
+                spawn_wave_swarm_profile(g, db, lvl, wave_id, profile_id, BOID_STYLE_CLASSIC, dir, bidirectional_spawns, su);
+                if (bidirectional_spawns && g->wave_index >= 4 && frand01(g) < lvl->cylinder_double_swarm_chance) {
                     const int wave_id_2 = ++g->wave_id_alloc;
-                    spawn_wave_swarm_profile(g, db, wave_id_2, profile_id, BOID_STYLE_CLASSIC, -dir, bidirectional_spawns, su);
+                    spawn_wave_swarm_profile(g, db, lvl, wave_id_2, profile_id, BOID_STYLE_CLASSIC, -dir, bidirectional_spawns, su);
                 }
             }
         }
@@ -2059,11 +2106,11 @@ void enemy_spawn_next_wave(
             const char* wave_name = profile ? profile->wave_name : "boid swarm cluster";
             announce_wave(g, wave_name);
             {
-                const float dir = bidirectional_spawns ? ((frand01() < 0.5f) ? -1.0f : 1.0f) : 1.0f;
-                spawn_wave_swarm_profile(g, db, wave_id, profile_id, BOID_STYLE_CLASSIC, dir, bidirectional_spawns, su);
-                if (bidirectional_spawns && g->wave_index >= 4 && frand01() < lvl->cylinder_double_swarm_chance) {
+                const float dir = bidirectional_spawns ? ((frand01(g) < 0.5f) ? -1.0f : 1.0f) : 1.0f;
+                spawn_wave_swarm_profile(g, db, lvl, wave_id, profile_id, BOID_STYLE_CLASSIC, dir, bidirectional_spawns, su);
+                if (bidirectional_spawns && g->wave_index >= 4 && frand01(g) < lvl->cylinder_double_swarm_chance) {
                     const int wave_id_2 = ++g->wave_id_alloc;
-                    spawn_wave_swarm_profile(g, db, wave_id_2, profile_id, BOID_STYLE_CLASSIC, -dir, bidirectional_spawns, su);
+                    spawn_wave_swarm_profile(g, db, lvl, wave_id_2, profile_id, BOID_STYLE_CLASSIC, -dir, bidirectional_spawns, su);
                 }
             }
         } else if (pattern == LEVELDEF_WAVE_ASTEROID_STORM) {
@@ -2085,7 +2132,7 @@ static void enemy_fire_projectiles(game_state* g, const enemy* e, const enemy_we
     float dy = ty - e->b.y;
     normalize2(&dx, &dy);
     {
-        const float err_rad = frands1() * t->aim_error_deg * (3.14159265359f / 180.0f);
+        const float err_rad = frands1(g) * t->aim_error_deg * (3.14159265359f / 180.0f);
         const float c0 = cosf(err_rad);
         const float s0 = sinf(err_rad);
         const float base_x = dx * c0 - dy * s0;
@@ -2120,16 +2167,12 @@ static int alloc_eel_arc_slot(game_state* g) {
     if (!g) {
         return -1;
     }
-    for (int i = 0; i < MAX_EEL_ARCS; ++i) {
-        if (!g->eel_arcs[i].active) {
-            return i;
-        }
-    }
-    return -1;
+    return slot_pool_alloc(&g->eel_arc_pool, MAX_EEL_ARCS);
 }
 
 static void eel_arc_source_and_dir(
     const enemy* e,
+    const enemy_eel_spine* spine,
     const eel_arc_effect* arc,
     float* out_sx,
     float* out_sy,
@@ -2169,8 +2212,8 @@ static void eel_arc_source_and_dir(
         float tx;
         float ty;
         const float u0 = arc ? arc->start_u : 0.0f;
-        eel_sample_body_point(e, u0, &sx, &sy);
-        eel_sample_body_point(e, clampf(u0 + 0.03f, 0.0f, 1.0f), &tx, &ty);
+        eel_sample_body_point(e, spine, u0, &sx, &sy);
+        eel_sample_body_point(e, spine, clampf(u0 + 0.03f, 0.0f, 1.0f), &tx, &ty);
         dir_x = tx - sx;
         dir_y = ty - sy;
         normalize2(&dir_x, &dir_y);
@@ -2184,7 +2227,42 @@ static void eel_arc_source_and_dir(
     }
 }
 
-static void eel_arc_build_points(const enemy* e, eel_arc_effect* arc) {
+static float eel_arc_jag_at(const eel_arc_effect* arc, int i, float age_s) {
+    const float u = (float)i / (float)(EEL_ARC_MAX_POINTS - 1);
+    const float stem = 1.0f - u;
+    const float t0 = u * 7.2f + age_s * (1.8f + 0.35f * arc->strike_slot) + arc->start_u * 2.9f;
+    const float t1 = u * 14.5f + age_s * (2.5f + 0.24f * arc->strike_slot) + 9.1f;
+    const float n0 = noise_signed_1d(arc->seed ^ 0x9e37u, t0);
+    const float n1 = noise_signed_1d(arc->seed ^ 0x68c9u, t1);
+    const float wobble = sinf(age_s * (2.8f + 0.8f * arc->start_u) - u * 4.7f + n0 * 1.7f);
+    return (n0 * 0.72f + n1 * 0.20f + wobble * 0.08f) * arc->range * (0.036f + 0.018f * stem) * stem;
+}
+
+/*
+ * The noise behind the jag only moves at the jitter rate, so it is sampled
+ * at jitter keys and blended in between; stepping to the next key reuses the
+ * samples of the previous one.
+ */
+static float eel_arc_refresh_jag(eel_arc_effect* arc) {
+    const int key = (int)floorf(arc->age_s / EEL_ARC_JITTER_INTERVAL_S);
+    const float key_s = (float)key * EEL_ARC_JITTER_INTERVAL_S;
+    if (key != arc->jag_key) {
+        if (arc->jag_key >= 0 && key == arc->jag_key + 1) {
+            memcpy(arc->jag_a, arc->jag_b, sizeof(arc->jag_a));
+        } else {
+            for (int i = 0; i < EEL_ARC_MAX_POINTS; ++i) {
+                arc->jag_a[i] = eel_arc_jag_at(arc, i, key_s);
+            }
+        }
+        for (int i = 0; i < EEL_ARC_MAX_POINTS; ++i) {
+            arc->jag_b[i] = eel_arc_jag_at(arc, i, key_s + EEL_ARC_JITTER_INTERVAL_S);
+        }
+        arc->jag_key = key;
+    }
+    return clampf((arc->age_s - key_s) / EEL_ARC_JITTER_INTERVAL_S, 0.0f, 1.0f);
+}
+
+static void eel_arc_build_points(const enemy* e, const enemy_eel_spine* spine, eel_arc_effect* arc) {
     const int seg_n = EEL_ARC_MAX_POINTS - 1;
     float sx;
     float sy;
@@ -2199,11 +2277,12 @@ static void eel_arc_build_points(const enemy* e, eel_arc_effect* arc) {
     float focus_x;
     float focus_y;
     float focus_range;
+    float jag_t;
     if (!e || !arc || seg_n < 1) {
         return;
     }
 
-    eel_arc_source_and_dir(e, arc, &sx, &sy, &dir_x, &dir_y);
+    eel_arc_source_and_dir(e, spine, arc, &sx, &sy, &dir_x, &dir_y);
     side_x = -dir_y;
     side_y = dir_x;
 
@@ -2227,19 +2306,14 @@ static void eel_arc_build_points(const enemy* e, eel_arc_effect* arc) {
     } else {
         normalize2(&focus_x, &focus_y);
     }
+    jag_t = eel_arc_refresh_jag(arc);
     arc->point_count = EEL_ARC_MAX_POINTS;
     for (int i = 0; i <= seg_n; ++i) {
         const float u = (float)i / (float)seg_n;
-        const float stem = 1.0f - u;
         const float u_pow = u * u;
         const float converge = 0.88f * u_pow;
         const float focus_u = smoothstepf(0.60f, 1.0f, u);
-        const float t0 = u * 7.2f + arc->age_s * (1.8f + 0.35f * arc->strike_slot) + arc->start_u * 2.9f;
-        const float t1 = u * 14.5f + arc->age_s * (2.5f + 0.24f * arc->strike_slot) + 9.1f;
-        const float n0 = noise_signed_1d(arc->seed ^ 0x9e37u, t0);
-        const float n1 = noise_signed_1d(arc->seed ^ 0x68c9u, t1);
-        const float wobble = sinf(arc->age_s * (2.8f + 0.8f * arc->start_u) - u * 4.7f + n0 * 1.7f);
-        const float jag = (n0 * 0.72f + n1 * 0.20f + wobble * 0.08f) * arc->range * (0.036f + 0.018f * stem) * stem;
+        const float jag = lerpf(arc->jag_a[i], arc->jag_b[i], jag_t);
         const float base_len = arc->range * u;
         const float focus_len = focus_range * u;
         float px = lerpf(sx + ray_x * base_len, sx + focus_x * focus_len, converge);
@@ -2256,7 +2330,7 @@ static void eel_arc_build_points(const enemy* e, eel_arc_effect* arc) {
 static void emit_eel_arc_sparks(game_state* g, const enemy* e, const eel_arc_effect* arc, float su) {
     const int source_count = 2;
     const int tip_count = 2;
-    const int extra_seg_ok_threshold = (int)(MAX_PARTICLES * 0.70f);
+    const int extra_seg_ok_threshold = (int)((float)g->caps.particles * 0.70f);
     const int seg_n = arc ? (arc->point_count - 1) : 0;
     float sx;
     float sy;
@@ -2305,82 +2379,88 @@ static void emit_eel_arc_sparks(game_state* g, const enemy* e, const eel_arc_eff
         seg_y /= seg_len;
         seg_nx = -seg_y;
         seg_ny = seg_x;
-        if (g->active_particles < extra_seg_ok_threshold && frand01() < 0.45f) {
+        if (g->particles.count < extra_seg_ok_threshold && frand01(g) < 0.45f) {
             emit_n = 2;
         }
         for (int ei = 0; ei < emit_n; ++ei) {
-            const float t = ((float)ei + 0.22f + frand01() * 0.56f) / (float)emit_n;
+            const float t = ((float)ei + 0.22f + frand01(g) * 0.56f) / (float)emit_n;
             const float line_u = ((float)si + t) / fmaxf((float)seg_n, 1.0f);
-            const float tan_spd = (22.0f + 72.0f * frand01()) * su;
-            const float nor_spd = frands1() * 44.0f * su;
-            particle* p = alloc_particle(g);
+            const float tan_spd = (22.0f + 72.0f * frand01(g)) * su;
+            const float nor_spd = frands1(g) * 44.0f * su;
+            particle spawn;
+            particle* p = alloc_particle(g, &spawn);
             if (!p) {
                 return;
             }
             p->type = PARTICLE_FLASH;
-            p->b.x = ax + (bx - ax) * t + seg_nx * frands1() * 2.0f * su;
-            p->b.y = ay + (by - ay) * t + seg_ny * frands1() * 2.0f * su;
+            p->b.x = ax + (bx - ax) * t + seg_nx * frands1(g) * 2.0f * su;
+            p->b.y = ay + (by - ay) * t + seg_ny * frands1(g) * 2.0f * su;
             p->b.vx = e->b.vx * 0.16f + seg_x * tan_spd + seg_nx * nor_spd;
             p->b.vy = e->b.vy * 0.16f + seg_y * tan_spd + seg_ny * nor_spd;
-            p->b.ax = -p->b.vx * (3.4f + frand01() * 1.8f);
-            p->b.ay = -p->b.vy * (3.4f + frand01() * 1.8f);
+            p->b.ax = -p->b.vx * (3.4f + frand01(g) * 1.8f);
+            p->b.ay = -p->b.vy * (3.4f + frand01(g) * 1.8f);
             p->age_s = 0.0f;
-            p->life_s = 0.14f + frand01() * 0.14f;
-            p->size = (1.5f + frand01() * 2.2f) * su;
-            p->spin = frand01() * 6.2831853f;
-            p->spin_rate = frands1() * 9.0f;
-            p->r = 0.38f + 0.18f * line_u + frand01() * 0.08f;
-            p->g = 0.86f + frand01() * 0.14f;
+            p->life_s = 0.14f + frand01(g) * 0.14f;
+            p->size = (1.5f + frand01(g) * 2.2f) * su;
+            p->spin = frand01(g) * 6.2831853f;
+            p->spin_rate = frands1(g) * 9.0f;
+            p->r = 0.38f + 0.18f * line_u + frand01(g) * 0.08f;
+            p->g = 0.86f + frand01(g) * 0.14f;
             p->bcol = 1.00f;
-            p->a = 0.20f + 0.16f * frand01();
+            p->a = 0.20f + 0.16f * frand01(g);
+            game_push_particle(g, p);
         }
     }
 
     for (int i = 0; i < source_count; ++i) {
-        const float fwd = (18.0f + 60.0f * frand01()) * su;
-        particle* p = alloc_particle(g);
+        const float fwd = (18.0f + 60.0f * frand01(g)) * su;
+        particle spawn;
+        particle* p = alloc_particle(g, &spawn);
         if (!p) {
             return;
         }
         p->type = PARTICLE_FLASH;
-        p->b.x = sx + dir_x * (1.4f + frand01() * 5.2f) * su + side_x * frands1() * 2.8f * su;
-        p->b.y = sy + dir_y * (1.4f + frand01() * 5.2f) * su + side_y * frands1() * 2.8f * su;
-        p->b.vx = e->b.vx * 0.22f + dir_x * fwd + side_x * frands1() * 58.0f * su;
-        p->b.vy = e->b.vy * 0.22f + dir_y * fwd + side_y * frands1() * 58.0f * su;
-        p->b.ax = -p->b.vx * (3.8f + frand01() * 1.8f);
-        p->b.ay = -p->b.vy * (3.8f + frand01() * 1.8f);
+        p->b.x = sx + dir_x * (1.4f + frand01(g) * 5.2f) * su + side_x * frands1(g) * 2.8f * su;
+        p->b.y = sy + dir_y * (1.4f + frand01(g) * 5.2f) * su + side_y * frands1(g) * 2.8f * su;
+        p->b.vx = e->b.vx * 0.22f + dir_x * fwd + side_x * frands1(g) * 58.0f * su;
+        p->b.vy = e->b.vy * 0.22f + dir_y * fwd + side_y * frands1(g) * 58.0f * su;
+        p->b.ax = -p->b.vx * (3.8f + frand01(g) * 1.8f);
+        p->b.ay = -p->b.vy * (3.8f + frand01(g) * 1.8f);
         p->age_s = 0.0f;
-        p->life_s = 0.13f + frand01() * 0.12f;
-        p->size = (1.5f + frand01() * 2.2f) * su;
-        p->spin = frand01() * 6.2831853f;
-        p->spin_rate = frands1() * 10.0f;
-        p->r = 0.36f + frand01() * 0.20f;
-        p->g = 0.86f + frand01() * 0.14f;
+        p->life_s = 0.13f + frand01(g) * 0.12f;
+        p->size = (1.5f + frand01(g) * 2.2f) * su;
+        p->spin = frand01(g) * 6.2831853f;
+        p->spin_rate = frands1(g) * 10.0f;
+        p->r = 0.36f + frand01(g) * 0.20f;
+        p->g = 0.86f + frand01(g) * 0.14f;
         p->bcol = 1.00f;
-        p->a = 0.20f + 0.16f * frand01();
+        p->a = 0.20f + 0.16f * frand01(g);
+        game_push_particle(g, p);
     }
     for (int i = 0; i < tip_count; ++i) {
-        const float out = (34.0f + 82.0f * frand01()) * su;
-        particle* p = alloc_particle(g);
+        const float out = (34.0f + 82.0f * frand01(g)) * su;
+        particle spawn;
+        particle* p = alloc_particle(g, &spawn);
         if (!p) {
             return;
         }
         p->type = PARTICLE_FLASH;
-        p->b.x = tip_x + side_x * frands1() * 3.1f * su;
-        p->b.y = tip_y + side_y * frands1() * 3.1f * su;
-        p->b.vx = e->b.vx * 0.14f + dir_x * out + side_x * frands1() * 46.0f * su;
-        p->b.vy = e->b.vy * 0.14f + dir_y * out + side_y * frands1() * 46.0f * su;
-        p->b.ax = -p->b.vx * (3.8f + frand01() * 1.8f);
-        p->b.ay = -p->b.vy * (3.8f + frand01() * 1.8f);
+        p->b.x = tip_x + side_x * frands1(g) * 3.1f * su;
+        p->b.y = tip_y + side_y * frands1(g) * 3.1f * su;
+        p->b.vx = e->b.vx * 0.14f + dir_x * out + side_x * frands1(g) * 46.0f * su;
+        p->b.vy = e->b.vy * 0.14f + dir_y * out + side_y * frands1(g) * 46.0f * su;
+        p->b.ax = -p->b.vx * (3.8f + frand01(g) * 1.8f);
+        p->b.ay = -p->b.vy * (3.8f + frand01(g) * 1.8f);
         p->age_s = 0.0f;
-        p->life_s = 0.12f + frand01() * 0.10f;
-        p->size = (1.3f + frand01() * 1.9f) * su;
-        p->spin = frand01() * 6.2831853f;
-        p->spin_rate = frands1() * 8.0f;
-        p->r = 0.44f + frand01() * 0.18f;
-        p->g = 0.90f + frand01() * 0.10f;
+        p->life_s = 0.12f + frand01(g) * 0.10f;
+        p->size = (1.3f + frand01(g) * 1.9f) * su;
+        p->spin = frand01(g) * 6.2831853f;
+        p->spin_rate = frands1(g) * 8.0f;
+        p->r = 0.44f + frand01(g) * 0.18f;
+        p->g = 0.90f + frand01(g) * 0.10f;
         p->bcol = 1.00f;
-        p->a = 0.18f + 0.14f * frand01();
+        p->a = 0.18f + 0.14f * frand01(g);
+        game_push_particle(g, p);
     }
 }
 
@@ -2406,13 +2486,15 @@ void enemy_spawn_eel_arc_burst(
 ) {
     const float range = (e->eel_weapon_range > 1.0f) ? e->eel_weapon_range : fmaxf(96.0f, e->radius * 8.4f);
     const float life = (e->eel_weapon_duration_s > 0.2f) ? e->eel_weapon_duration_s : 2.2f;
+    const enemy_eel_spine* spine;
     if (!g || !e || !e->active) {
         return;
     }
+    spine = (owner_index >= 0 && owner_index < MAX_ENEMIES) ? &g->eel_spines[owner_index] : NULL;
     ray_count = clampi(ray_count, 1, 8);
     for (int i = 0; i < ray_count; ++i) {
         const int slot = alloc_eel_arc_slot(g);
-        const uint32_t seed = e->visual_seed ^ (uint32_t)(i * 0x517cu) ^ (uint32_t)(rand() & 0xffff);
+        const uint32_t seed = e->visual_seed ^ (uint32_t)(i * 0x517cu) ^ (game_rng_next_u32(&g->rng) & 0xffffu);
         eel_arc_effect* arc;
         if (slot < 0) {
             break;
@@ -2437,7 +2519,8 @@ void enemy_spawn_eel_arc_burst(
         arc->pulse_emit_on = 0;
         arc->pulse_sound_anchor = (i == 0) ? 1 : 0;
         arc->strike_slot = i;
-        eel_arc_build_points(e, arc);
+        arc->jag_key = -1;
+        eel_arc_build_points(e, spine, arc);
     }
 }
 
@@ -2453,19 +2536,16 @@ static void update_eel_arc_effects(
     if (!g) {
         return;
     }
-    for (int i = 0; i < MAX_EEL_ARCS; ++i) {
+    for (int i = slot_pool_next(&g->eel_arc_pool, 0); i >= 0; i = slot_pool_next(&g->eel_arc_pool, i + 1)) {
         eel_arc_effect* arc = &g->eel_arcs[i];
         enemy* owner = NULL;
-        if (!arc->active) {
-            continue;
-        }
         if (arc->owner_index >= 0 && arc->owner_index < MAX_ENEMIES) {
             owner = &g->enemies[arc->owner_index];
         }
         if (!owner || !owner->active ||
             (!arc->omnidirectional && owner->visual_kind != ENEMY_VISUAL_EEL) ||
             owner->wave_id != arc->owner_wave_id || owner->slot_index != arc->owner_slot_index) {
-            arc->active = 0;
+            kill_eel_arc(g, arc);
             continue;
         }
 
@@ -2474,7 +2554,7 @@ static void update_eel_arc_effects(
             arc->damage_timer_s -= dt;
         }
         if (arc->age_s >= arc->life_s) {
-            arc->active = 0;
+            kill_eel_arc(g, arc);
             continue;
         }
         active_n += 1;
@@ -2494,7 +2574,7 @@ static void update_eel_arc_effects(
                 arc->pulse_emit_on = 0;
                 continue;
             }
-            eel_arc_source_and_dir(owner, arc, &sx, &sy, &dir_x, &dir_y);
+            eel_arc_source_and_dir(owner, &g->eel_spines[arc->owner_index], arc, &sx, &sy, &dir_x, &dir_y);
             dx = uses_cylinder ? wrap_delta(sx, g->player.b.x, period) : (sx - g->player.b.x);
             dy = sy - g->player.b.y;
             if (pulse_just_started) {
@@ -2561,7 +2641,7 @@ static void update_eel_arc_effects(
             if (!arc->pulse_emit_on) {
                 continue;
             }
-            eel_arc_build_points(owner, arc);
+            eel_arc_build_points(owner, &g->eel_spines[arc->owner_index], arc);
             if (pulse_just_started) {
                 emit_eel_arc_sparks(g, owner, arc, su);
             }
@@ -2685,7 +2765,7 @@ static void enemy_try_fire(game_state* g, enemy* e, float dt, float su, const le
         }
         if (e->fire_cooldown_s > 0.0f || !in_front || !in_fire_region || d2 > range * range) {
             if (e->fire_cooldown_s <= 0.0f) {
-                e->fire_cooldown_s = 0.06f + frand01() * 0.14f;
+                e->fire_cooldown_s = 0.06f + frand01(g) * 0.14f;
             }
             return;
         }
@@ -2697,12 +2777,12 @@ static void enemy_try_fire(game_state* g, enemy* e, float dt, float su, const le
             const float indiv_weight = 0.80f + 0.40f * hash01_u32(e->visual_seed ^ 0x73Bu);
             const float p_mul = curated ? fmaxf(curated->eel.fire_prob_mul, 0.0f) : 1.0f;
             const float p_try = clampf(p_try_base * dist_weight * indiv_weight * p_mul, 0.0f, 0.92f);
-            if (frand01() < p_try) {
+            if (frand01(g) < p_try) {
                 const int owner_index = (int)(e - g->enemies);
                 enemy_spawn_eel_arc_burst(g, e, owner_index, 0, 3, 0.0f);
-                e->fire_cooldown_s = 0.42f + frand01() * 0.68f;
+                e->fire_cooldown_s = 0.42f + frand01(g) * 0.68f;
             } else {
-                e->fire_cooldown_s = 0.08f + frand01() * 0.22f;
+                e->fire_cooldown_s = 0.08f + frand01(g) * 0.22f;
             }
         }
         return;
@@ -2731,7 +2811,7 @@ static void enemy_try_fire(game_state* g, enemy* e, float dt, float su, const le
             }
             e->missile_charge_s = 0.0f;
             e->missile_charge_duration_s = 0.0f;
-            e->missile_cooldown_s = frand_range(4.8f, 8.2f);
+            e->missile_cooldown_s = frand_range(g, 4.8f, 8.2f);
             if (curated) {
                 e->missile_cooldown_s *= curated->manta.missile_cooldown_mul;
             }
@@ -2765,7 +2845,7 @@ static void enemy_try_fire(game_state* g, enemy* e, float dt, float su, const le
                 (fabsf(dy_player) <= g->world_h * 0.5f);
         }
         if (!in_fire_region) {
-            enemy_reset_fire_cooldown(w, &t, e);
+            enemy_reset_fire_cooldown(g, w, &t, e);
             return;
         }
     }
@@ -2776,7 +2856,7 @@ static void enemy_try_fire(game_state* g, enemy* e, float dt, float su, const le
             g->player.b.x,
             g->player.b.y,
             fmaxf(2.0f, e->radius * 0.22f))) {
-        enemy_reset_fire_cooldown(w, &t, e);
+        enemy_reset_fire_cooldown(g, w, &t, e);
         return;
     }
 
@@ -2786,7 +2866,7 @@ static void enemy_try_fire(game_state* g, enemy* e, float dt, float su, const le
         const float d2 = dx * dx + dy * dy;
         const float rmin = t.fire_range_min;
         if (d2 < rmin * rmin) {
-            enemy_reset_fire_cooldown(w, &t, e);
+            enemy_reset_fire_cooldown(g, w, &t, e);
             return;
         }
     }
@@ -2800,12 +2880,12 @@ static void enemy_try_fire(game_state* g, enemy* e, float dt, float su, const le
             const float end_r = g->world_w * 0.52f;
             if (d2 >= start_r * start_r && d2 <= end_r * end_r) {
                 const float p_fire = curated ? clampf(curated->manta.fire_prob_mul, 0.0f, 1.0f) : 1.0f;
-                if (frand01() <= p_fire) {
+                if (frand01(g) <= p_fire) {
                     const float charge_mul = curated ? curated->manta.missile_charge_mul : 1.0f;
                     const float cooldown_mul = curated ? curated->manta.missile_cooldown_mul : 1.0f;
-                    e->missile_charge_duration_s = frand_range(0.55f, 0.95f) * charge_mul;
+                    e->missile_charge_duration_s = frand_range(g, 0.55f, 0.95f) * charge_mul;
                     e->missile_charge_s = 0.0f;
-                    e->missile_cooldown_s = frand_range(4.8f, 8.2f) * cooldown_mul;
+                    e->missile_cooldown_s = frand_range(g, 4.8f, 8.2f) * cooldown_mul;
                     e->fire_cooldown_s = fmaxf(e->fire_cooldown_s, 0.45f);
                     return;
                 }
@@ -2815,16 +2895,16 @@ static void enemy_try_fire(game_state* g, enemy* e, float dt, float su, const le
 
     if (e->archetype == ENEMY_ARCH_SWARM) {
         const float p_fire = clampf(e->fire_prob, 0.0f, 1.0f);
-        if (frand01() > p_fire) {
-            enemy_reset_fire_cooldown(w, &t, e);
+        if (frand01(g) > p_fire) {
+            enemy_reset_fire_cooldown(g, w, &t, e);
             return;
         }
     }
 
     if (e->visual_kind == ENEMY_VISUAL_MANTA) {
         const float p_fire = curated ? clampf(curated->manta.fire_prob_mul, 0.0f, 1.0f) : 1.0f;
-        if (frand01() > p_fire) {
-            enemy_reset_fire_cooldown(w, &t, e);
+        if (frand01(g) > p_fire) {
+            enemy_reset_fire_cooldown(g, w, &t, e);
             return;
         }
     }
@@ -2832,7 +2912,7 @@ static void enemy_try_fire(game_state* g, enemy* e, float dt, float su, const le
     enemy_fire_projectiles(g, e, w, &t, uses_cylinder, period);
     e->burst_shots_left = w->burst_count - 1;
     e->burst_gap_timer_s = (e->burst_shots_left > 0) ? w->burst_gap_s : 0.0f;
-    enemy_reset_fire_cooldown(w, &t, e);
+    enemy_reset_fire_cooldown(g, w, &t, e);
 }
 
 static void update_enemy_formation(game_state* g, enemy* e, float dt, float su, int uses_cylinder, float period) {
@@ -2899,10 +2979,10 @@ static void update_enemy_formation(game_state* g, enemy* e, float dt, float su,
                     const float mean_interval_s = 2.7f;
                     if (e->ai_timer_s > warmup_s) {
                         const float p_dt = 1.0f - expf(-fmaxf(dt, 0.0f) / mean_interval_s);
-                        if (frand01() < p_dt) {
+                        if (frand01(g) < p_dt) {
                             e->state = ENEMY_STATE_BREAK_ATTACK;
                             e->ai_timer_s = 0.0f;
-                            e->break_delay_s = 1.6f + frand01() * 1.1f;
+                            e->break_delay_s = 1.6f + frand01(g) * 1.1f;
                         }
                     }
                 }
@@ -3174,7 +3254,7 @@ static void update_enemy_kamikaze(game_state* g, enemy* e, float dt, int uses_cy
         if (!uses_cylinder && fabsf(g->player.b.x - e->b.x) > g->world_w * 0.95f) {
             e->state = ENEMY_STATE_KAMIKAZE_COIL;
             e->ai_timer_s = 0.0f;
-            e->break_delay_s = 0.35f + frand01() * 0.25f;
+            e->break_delay_s = 0.35f + frand01(g) * 0.25f;
             e->facing_x = dir_x;
             e->facing_y = dir_y;
             e->kamikaze_tail = fminf(e->kamikaze_tail, 0.22f);
@@ -3255,7 +3335,7 @@ static void update_enemy_kamikaze(game_state* g, enemy* e, float dt, int uses_cy
                         if (facing_dot >= 0.0f) {
                             e->state = ENEMY_STATE_KAMIKAZE_STRIKE;
                             e->ai_timer_s = 0.0f;
-                            e->break_delay_s = 0.56f + frand01() * 0.22f; /* strike dash duration after turn-in */
+                            e->break_delay_s = 0.56f + frand01(g) * 0.22f; /* strike dash duration after turn-in */
                             e->kamikaze_is_turning = 1;
                             e->kamikaze_thrust = 0.0f;
                             e->kamikaze_tail = 0.92f;
@@ -3269,7 +3349,7 @@ static void update_enemy_kamikaze(game_state* g, enemy* e, float dt, int uses_cy
                 const float lunge_rate = 0.35f + near01 * 2.05f; /* events/second */
                 const float p_dt = 1.0f - expf(-lunge_rate * fmaxf(dt, 0.0f));
                 const float facing_dot = e->facing_x * dir_x + e->facing_y * dir_y;
-                if (facing_dot > 0.55f && frand01() < p_dt) {
+                if (facing_dot > 0.55f && frand01(g) < p_dt) {
                     e->ai_timer_s = e->break_delay_s;
                 }
             }
@@ -3279,7 +3359,7 @@ static void update_enemy_kamikaze(game_state* g, enemy* e, float dt, int uses_cy
             e->ai_timer_s = 0.0f;
             {
                 const float glide_scale = fmaxf(e->kamikaze_glide_scale, 0.1f);
-                e->break_delay_s = (1.15f + frand01() * 0.55f) * glide_scale;
+                e->break_delay_s = (1.15f + frand01(g) * 0.55f) * glide_scale;
             }
             e->kamikaze_thrust = 1.0f;
             e->kamikaze_tail = 1.0f;
@@ -3300,7 +3380,7 @@ static void update_enemy_kamikaze(game_state* g, enemy* e, float dt, int uses_cy
                 fmaxf(2.0f, e->radius * 0.28f))) {
             e->state = ENEMY_STATE_KAMIKAZE_COIL;
             e->ai_timer_s = 0.0f;
-            e->break_delay_s = 0.55f + frand01() * 0.35f;
+            e->break_delay_s = 0.55f + frand01(g) * 0.35f;
             e->kamikaze_thrust = 0.0f;
             e->kamikaze_tail = 0.22f;
             e->kamikaze_tail_start = e->kamikaze_tail;
@@ -3368,7 +3448,7 @@ static void update_enemy_kamikaze(game_state* g, enemy* e, float dt, int uses_cy
             e->ai_timer_s = 0.0f;
             {
                 const float glide_scale = fmaxf(e->kamikaze_glide_scale, 0.1f);
-                e->break_delay_s = (0.82f + frand01() * 0.48f) * glide_scale;
+                e->break_delay_s = (0.82f + frand01(g) * 0.48f) * glide_scale;
             }
             e->kamikaze_thrust = 0.85f;
             e->kamikaze_tail = 1.0f;
@@ -3419,14 +3499,103 @@ static void update_enemy_kamikaze(game_state* g, enemy* e, float dt, int uses_cy
     if (e->ai_timer_s >= e->break_delay_s) {
         e->state = ENEMY_STATE_KAMIKAZE_COIL;
         e->ai_timer_s = 0.0f;
-        e->break_delay_s = 0.85f + frand01() * 0.75f;
+        e->break_delay_s = 0.85f + frand01(g) * 0.75f;
         e->kamikaze_thrust = 0.0f;
         e->kamikaze_tail = 0.22f;
         e->kamikaze_tail_start = e->kamikaze_tail;
     }
 }
 
-static void update_enemy_swarm(game_state* g, enemy* e, float dt, int uses_cylinder, float period, float su) {
+/*
+ * Opt-in for stress builds only: define SWARM_MAX_NEIGHBORS (counting the boid
+ * itself) to steer each boid by its nearest members in range rather than all
+ * of them. That changes steering in flocks denser than the cap, so shipping
+ * builds leave it undefined and get the exact full-range neighbour set.
+ */
+#ifdef SWARM_MAX_NEIGHBORS
+#define SWARM_HASH_CELLS_PER_RADIUS 16.0f /* Small cells let the nearest-neighbour search stop early in a crowd. */
+#else
+#define SWARM_HASH_CELLS_PER_RADIUS 1.0f
+#endif
+
+static void build_swarm_hash(game_state* g, float su, int uses_cylinder, float period) {
+    float cell = 0.0f;
+    g->swarm_hash_valid = 0;
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const enemy* e = &g->enemies[i];
+        if (!e->active || e->archetype != ENEMY_ARCH_SWARM) {
+            continue;
+        }
+        cell = fmaxf(cell, (e->swarm_sep_r > 1.0f) ? e->swarm_sep_r : (70.0f * su));
+        cell = fmaxf(cell, (e->swarm_ali_r > 1.0f) ? e->swarm_ali_r : (180.0f * su));
+        cell = fmaxf(cell, (e->swarm_coh_r > 1.0f) ? e->swarm_coh_r : (220.0f * su));
+    }
+    if (cell <= 0.0f) {
+        return;
+    }
+    spatial_hash_begin(&g->swarm_hash, cell / SWARM_HASH_CELLS_PER_RADIUS, uses_cylinder, period);
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const enemy* e = &g->enemies[i];
+        if (!e->active || e->archetype != ENEMY_ARCH_SWARM) {
+            continue;
+        }
+        if (!spatial_hash_add(&g->swarm_hash, i, e->b.x, e->b.y, 0.0f)) {
+            return;
+        }
+    }
+    spatial_hash_finish(&g->swarm_hash);
+    g->swarm_hash_valid = 1;
+}
+
+/*
+ * Steering runs before any swarm member moves this tick, so the hash built at
+ * the top of enemy_update_system is exact. Candidates come back in pool order,
+ * which keeps the steering sums identical to a full scan. Falls back to the
+ * full scan if an enemy spawned mid-update or the hash overflowed.
+ */
+static int swarm_neighbor_candidates(const game_state* g, const enemy* e, float radius, int* out) {
+    int n = 0;
+    if (!g->swarm_hash_valid) {
+        for (int i = 0; i < MAX_ENEMIES; ++i) {
+            out[n++] = i;
+        }
+        return n;
+    }
+#ifdef SWARM_MAX_NEIGHBORS
+    return spatial_hash_query_nearest(&g->swarm_hash, e->b.x, e->b.y, radius + 1.0f, SWARM_MAX_NEIGHBORS, out, MAX_ENEMIES);
+#else
+    return spatial_hash_query(&g->swarm_hash, e->b.x, e->b.y, radius + 1.0f, out, MAX_ENEMIES);
+#endif
+}
+
+static game_segment_query swarm_player_los_query(const game_state* g, const enemy* e, float su) {
+    game_segment_query q;
+    q.x0 = e->b.x;
+    q.y0 = e->b.y;
+    q.x1 = g->player.b.x;
+    q.y1 = g->player.b.y;
+    q.pad_radius = fmaxf(4.0f * su, e->radius * 0.65f);
+    return q;
+}
+
+static int swarm_player_los_clear(const game_state* g, const enemy* e, float su, int uses_cylinder) {
+    game_segment_query q;
+    if (uses_cylinder) {
+        return 1;
+    }
+    q = swarm_player_los_query(g, e, su);
+    return !game_structure_segment_blocked(g, q.x0, q.y0, q.x1, q.y1, q.pad_radius);
+}
+
+static void update_enemy_swarm(
+    const game_state* g,
+    enemy* e,
+    float dt,
+    int uses_cylinder,
+    float period,
+    float su,
+    int player_los_clear
+) {
     float sep_x = 0.0f, sep_y = 0.0f, ali_x = 0.0f, ali_y = 0.0f, coh_x = 0.0f, coh_y = 0.0f;
     int ali_n = 0, coh_n = 0;
     float sep_r = (e->swarm_sep_r > 1.0f) ? e->swarm_sep_r : (70.0f * su);
@@ -3471,8 +3640,10 @@ static void update_enemy_swarm(game_state* g, enemy* e, float dt, int uses_cylin
     const float sep_r2 = sep_r * sep_r;
     const float ali_r2 = ali_r * ali_r;
     const float coh_r2 = coh_r * coh_r;
-    for (size_t i = 0; i < MAX_ENEMIES; ++i) {
-        const enemy* o = &g->enemies[i];
+    int neighbors[MAX_ENEMIES];
+    const int neighbor_n = swarm_neighbor_candidates(g, e, fmaxf(sep_r, fmaxf(ali_r, coh_r)), neighbors);
+    for (int k = 0; k < neighbor_n; ++k) {
+        const enemy* o = &g->enemies[neighbors[k]];
         if (!o->active || o == e || o->archetype != ENEMY_ARCH_SWARM) {
             continue;
         }
@@ -3607,8 +3778,10 @@ static void update_enemy_swarm(game_state* g, enemy* e, float dt, int uses_cylin
         }
     }
     {
-        const leveldef_level* lvl = game_current_leveldef(g);
-        if (!uses_cylinder && g->render_style != LEVEL_RENDER_CYLINDER && lvl && lvl->structure_count > 0) {
+        const structure_index* si = &g->enemy_structure_index;
+        if (!uses_cylinder && g->render_style != LEVEL_RENDER_CYLINDER && si->count > 0) {
+            int cand[STRUCTURE_INDEX_CAP];
+            int cand_n;
             float fwd_x = e->b.vx;
             float fwd_y = e->b.vy;
             const float fwd_v = length2(fwd_x, fwd_y);
@@ -3620,12 +3793,22 @@ static void update_enemy_swarm(game_state* g, enemy* e, float dt, int uses_cylin
                 fwd_y = e->facing_y;
                 normalize2(&fwd_x, &fwd_y);
             }
-            for (int i = 0; i < lvl->structure_count && i < LEVELDEF_MAX_STRUCTURES; ++i) {
-                const leveldef_structure_instance* st = &lvl->structures[i];
-                float min_x;
-                float min_y;
-                float max_x;
-                float max_y;
+            {
+                /* Widest reach of the lookahead/lateral window below, for the largest structure. */
+                const float max_r = 0.68f * fmaxf(si->max_diag, 1.5f);
+                const float max_personal_r = max_r + fmaxf(e->radius, 6.0f * su);
+                const float max_aware_r = max_personal_r + fmaxf(96.0f * su, 0.78f * max_r);
+                const float reach = max_aware_r + fmaxf(40.0f * su, e->radius * 1.5f)
+                    + max_personal_r + fmaxf(8.0f * su, e->radius * 0.35f)
+                    + max_r;
+                cand_n = structure_index_query_x(si, e->b.x - reach, e->b.x + reach, cand, STRUCTURE_INDEX_CAP);
+            }
+            for (int k = 0; k < cand_n; ++k) {
+                const int i = cand[k];
+                const float min_x = si->min_x[i];
+                const float min_y = si->min_y[i];
+                const float max_x = si->max_x[i];
+                const float max_y = si->max_y[i];
                 float cx;
                 float cy;
                 float w;
@@ -3642,10 +3825,6 @@ static void update_enemy_swarm(game_state* g, enemy* e, float dt, int uses_cylin
                 float lateral_limit;
                 float lookahead;
                 float course_w;
-                if (!structure_blocks_enemy(st)) {
-                    continue;
-                }
-                structure_aabb_world_enemy(g, st, &min_x, &min_y, &max_x, &max_y);
                 cx = 0.5f * (min_x + max_x);
                 cy = 0.5f * (min_y + max_y);
                 w = fmaxf(max_x - min_x, 1.0f);
@@ -3694,10 +3873,6 @@ static void update_enemy_swarm(game_state* g, enemy* e, float dt, int uses_cylin
 
     {
         const float goal_dir = (e->swarm_goal_dir < 0.0f) ? -1.0f : 1.0f;
-        const float los_radius = fmaxf(4.0f * su, e->radius * 0.65f);
-        const int player_los_clear = uses_cylinder ? 1 : game_line_of_sight_clear(
-            g, e->b.x, e->b.y, g->player.b.x, g->player.b.y, los_radius
-        );
         float goal_x = (g->player.b.x + goal_dir * 280.0f * su) - e->b.x;
         float goal_y;
         float wander_x = 0.0f;
@@ -3882,6 +4057,153 @@ static void update_enemy_swarm(game_state* g, enemy* e, float dt, int uses_cylin
     e->ai_timer_s += dt;
 }
 
+static void build_enemy_hash(game_state* g, float su, int uses_cylinder, float period) {
+    spatial_hash_begin(&g->enemy_hash, 128.0f * su, uses_cylinder, period);
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const enemy* e = &g->enemies[i];
+        if (e->active) {
+            (void)spatial_hash_add(&g->enemy_hash, i, e->b.x, e->b.y, fmaxf(8.0f * su, e->radius));
+        }
+    }
+    spatial_hash_finish(&g->enemy_hash);
+}
+
+#ifndef ENEMY_PARALLEL_MIN
+#define ENEMY_PARALLEL_MIN 32 /* Below this many swarm members the hand-off costs more than it saves. */
+#endif
+#ifndef ENEMY_PARALLEL_CHUNK
+#define ENEMY_PARALLEL_CHUNK 8
+#endif
+
+#ifndef ENEMY_LOD_STRIDE
+#define ENEMY_LOD_STRIDE 4
+#endif
+#define ENEMY_LOD_FAR_X 1.1f /* Screen widths from the camera centre; the view edge is at 0.5. */
+
+/*
+ * One pool per process, shared by every game_state. worker_pool_run serves a
+ * single run at a time, so a second game_state updating concurrently (a
+ * rollback check, a test) steers inline rather than racing the first.
+ * enemy_set_worker_threads must not be called while any update is running.
+ */
+static worker_pool g_enemy_workers;
+
+/*
+ * AI level of detail. Enemies well off-screen run their AI on one tick in
+ * ENEMY_LOD_STRIDE (staggered by slot) with all the time they skipped, so
+ * timers and dt-scaled chances keep their rate; their bodies still integrate,
+ * collide and fire every tick. Sets ai_dt[i] to 0 for a skipped tick and
+ * far[i] for anything beyond the LOD distance. Boss parts, EMP-pushed enemies
+ * and cylinder levels (where the whole ring is on screen) are never reduced.
+ */
+static void plan_enemy_ai_lod(game_state* g, float dt, int uses_cylinder, float* ai_dt, uint8_t* far) {
+    const uint32_t tick = g->enemy_lod_tick++;
+    const float far_x = g->world_w * ENEMY_LOD_FAR_X;
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const enemy* e = &g->enemies[i];
+        float* debt = &g->enemy_lod_debt_s[i];
+        ai_dt[i] = dt;
+        far[i] = 0u;
+        if (!e->active) {
+            continue;
+        }
+        if (g->ai_lod && !uses_cylinder && e->emp_push_time_s <= 0.0f && fabsf(e->b.x - g->camera_x) > far_x &&
+            !boss_enemy_is_managed(g, i)) {
+            far[i] = 1u;
+            if ((tick + (uint32_t)i) % ENEMY_LOD_STRIDE != 0u) {
+                *debt += dt;
+                ai_dt[i] = 0.0f;
+                continue;
+            }
+        }
+        ai_dt[i] = dt + *debt;
+        *debt = 0.0f;
+    }
+}
+
+typedef struct swarm_steer_job {
+    const game_state* g;
+    enemy* enemies;
+    const int* slots;
+    const float* ai_dt;
+    const uint8_t* los_blocked;
+    float su;
+    int uses_cylinder;
+    float period;
+} swarm_steer_job;
+
+static void swarm_steer_range(void* ctx, int begin, int end) {
+    const swarm_steer_job* job = (const swarm_steer_job*)ctx;
+    for (int k = begin; k < end; ++k) {
+        const int i = job->slots[k];
+        update_enemy_swarm(
+            job->g,
+            &job->enemies[i],
+            job->ai_dt[i],
+            job->uses_cylinder,
+            job->period,
+            job->su,
+            !job->los_blocked[k]
+        );
+    }
+}
+
+/*
+ * Read phase: swarm steering only looks at positions and velocities as they
+ * stood at the start of the tick and writes nothing but the member's own
+ * acceleration and timer, so it can run on any thread in any order. Everything
+ * that touches the RNG or spawns bullets, particles or audio stays in the
+ * serial loop below, in slot order. Player line-of-sight for every member is
+ * resolved up front in one batch.
+ */
+static void steer_swarm_members(
+    game_state* g,
+    uint8_t* steered,
+    const float* ai_dt,
+    float su,
+    int uses_cylinder,
+    float period
+) {
+    int slots[MAX_ENEMIES];
+    game_segment_query los[MAX_ENEMIES];
+    uint8_t los_blocked[MAX_ENEMIES];
+    int n = 0;
+    swarm_steer_job job;
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const enemy* e = &g->enemies[i];
+        if (!e->active || e->archetype != ENEMY_ARCH_SWARM || e->visual_kind == ENEMY_VISUAL_EEL ||
+            boss_enemy_is_managed(g, i) || ai_dt[i] <= 0.0f) {
+            continue;
+        }
+        if (!uses_cylinder) {
+            los[n] = swarm_player_los_query(g, e, su);
+        }
+        slots[n++] = i;
+    }
+    if (uses_cylinder) {
+        memset(los_blocked, 0, (size_t)n);
+    } else {
+        game_structure_segments_blocked(g, los, n, los_blocked);
+    }
+    job.g = g;
+    job.enemies = g->enemies;
+    job.slots = slots;
+    job.ai_dt = ai_dt;
+    job.los_blocked = los_blocked;
+    job.su = su;
+    job.uses_cylinder = uses_cylinder;
+    job.period = period;
+    worker_pool_run((n >= ENEMY_PARALLEL_MIN) ? &g_enemy_workers : NULL, swarm_steer_range, &job, n, ENEMY_PARALLEL_CHUNK);
+    for (int k = 0; k < n; ++k) {
+        steered[slots[k]] = 1u;
+    }
+}
+
+int enemy_set_worker_threads(int threads) {
+    worker_pool_stop(&g_enemy_workers);
+    return worker_pool_start(&g_enemy_workers, threads);
+}
+
 void enemy_update_system(
     game_state* g,
     const leveldef_db* db,
@@ -3891,10 +4213,17 @@ void enemy_update_system(
     float period
 ) {
     int player_hit_this_frame = 0;
+    uint8_t steered[MAX_ENEMIES];
+    float ai_dt[MAX_ENEMIES];
+    uint8_t far[MAX_ENEMIES];
     if (!g || !db) {
         return;
     }
 
+    build_swarm_hash(g, su, uses_cylinder, period);
+    plan_enemy_ai_lod(g, dt, uses_cylinder, ai_dt, far);
+    memset(steered, 0, sizeof(steered));
+    steer_swarm_members(g, steered, ai_dt, su, uses_cylinder, period);
     for (size_t i = 0; i < MAX_ENEMIES; ++i) {
         enemy* e = &g->enemies[i];
         const int boss_managed = boss_enemy_is_managed(g, (int)i);
@@ -3906,14 +4235,18 @@ void enemy_update_system(
             if (e->archetype == ENEMY_ARCH_BOSS_PART) {
                 e->ai_timer_s += dt;
             }
+        } else if (ai_dt[i] <= 0.0f) {
+            /* Skipped by the LOD: keep the last steering acceleration. */
         } else if (e->visual_kind == ENEMY_VISUAL_EEL) {
-            update_enemy_eel(g, e, dt, uses_cylinder, period, su);
+            update_enemy_eel(g, e, ai_dt[i], uses_cylinder, period, su);
         } else if (e->archetype == ENEMY_ARCH_SWARM) {
-            update_enemy_swarm(g, e, dt, uses_cylinder, period, su);
+            if (!steered[i]) {
+                update_enemy_swarm(g, e, ai_dt[i], uses_cylinder, period, su, swarm_player_los_clear(g, e, su, uses_cylinder));
+            }
         } else if (e->archetype == ENEMY_ARCH_KAMIKAZE) {
-            update_enemy_kamikaze(g, e, dt, uses_cylinder, period, su);
+            update_enemy_kamikaze(g, e, ai_dt[i], uses_cylinder, period, su);
         } else {
-            update_enemy_formation(g, e, dt, su, uses_cylinder, period);
+            update_enemy_formation(g, e, ai_dt[i], su, uses_cylinder, period);
         }
         if (e->emp_push_time_s > 0.0f) {
             const float emp_push01 = clampf(e->emp_push_time_s / 1.10f, 0.0f, 1.0f);
@@ -3935,7 +4268,7 @@ void enemy_update_system(
             e->b.ay = 0.0f;
         }
         if (!boss_managed && !uses_cylinder) {
-            if (e->archetype != ENEMY_ARCH_SWARM) {
+            if (e->archetype != ENEMY_ARCH_SWARM && !far[i]) {
                 float avoid_x = 0.0f;
                 float avoid_y = 0.0f;
                 game_structure_avoidance_vector(
@@ -4054,7 +4387,7 @@ void enemy_update_system(
             if (e->archetype == ENEMY_ARCH_FORMATION && e->visual_kind != ENEMY_VISUAL_MANTA) {
                 e->state = ENEMY_STATE_BREAK_ATTACK;
                 e->ai_timer_s = 0.0f;
-                e->break_delay_s = 1.0f + frand01() * 1.3f;
+                e->break_delay_s = 1.0f + frand01(g) * 1.3f;
             }
         }
         if (!boss_managed && e->b.y < 26.0f * su) {
@@ -4110,7 +4443,12 @@ void enemy_update_system(
             }
         }
         if (e->active && e->visual_kind == ENEMY_VISUAL_EEL) {
-            eel_update_spine(e, dt, uses_cylinder, period);
+            if (far[i]) {
+                /* Off-screen: drop the spine and reseed it straight when the eel comes back. */
+                g->eel_spines[i].count = 0;
+            } else {
+                eel_update_spine(e, &g->eel_spines[i], dt, uses_cylinder, period);
+            }
         }
         if (!boss_managed) {
             enemy_try_fire(g, e, dt, su, db, uses_cylinder, period);
@@ -4121,53 +4459,78 @@ void enemy_update_system(
         update_eel_arc_effects(g, dt, su, uses_cylinder, period, &player_hit_this_frame);
     }
 
-    for (size_t i = 0; i < MAX_ENEMY_BULLETS; ++i) {
-        enemy_bullet* b = &g->enemy_bullets[i];
-        if (!b->active) {
-            continue;
-        }
-        const float prev_x = b->b.x;
-        const float prev_y = b->b.y;
-        integrate_body(&b->b, dt);
-        b->ttl_s -= dt;
-        if (b->ttl_s <= 0.0f) {
-            b->active = 0;
-            continue;
-        }
+    {
+        int live[MAX_ENEMY_BULLETS];
+        float prev_x[MAX_ENEMY_BULLETS];
+        float prev_y[MAX_ENEMY_BULLETS];
+        game_segment_query sweep[MAX_ENEMY_BULLETS];
+        uint8_t blocked[MAX_ENEMY_BULLETS];
+        const int live_n = slot_pool_collect(&g->enemy_bullet_pool, live, MAX_ENEMY_BULLETS);
+        body_batch_integrate(&g->enemy_bullets[0].b, sizeof(g->enemy_bullets[0]), live, NULL, live_n, dt, prev_x, prev_y);
         if (uses_cylinder) {
-            if (fabsf(wrap_delta(b->b.x, g->player.b.x, period)) > period * 0.55f) {
-                b->active = 0;
-                continue;
+            memset(blocked, 0, (size_t)live_n);
+        } else {
+            for (int k = 0; k < live_n; ++k) {
+                const enemy_bullet* b = &g->enemy_bullets[live[k]];
+                sweep[k].x0 = prev_x[k];
+                sweep[k].y0 = prev_y[k];
+                sweep[k].x1 = b->b.x;
+                sweep[k].y1 = b->b.y;
+                sweep[k].pad_radius = b->radius;
             }
-        } else if (fabsf(b->b.x - g->camera_x) > g->world_w * 1.35f) {
-            b->active = 0;
-            continue;
+            game_structure_segments_blocked(g, sweep, live_n, blocked);
         }
-        if (!uses_cylinder && game_structure_segment_blocked(g, prev_x, prev_y, b->b.x, b->b.y, b->radius)) {
-            b->active = 0;
-            continue;
-        }
-        if (g->shield_active) {
-            if (shield_deflect_body(g, &b->b, b->radius + 2.0f * su, 760.0f * su, uses_cylinder, period)) {
-                b->ttl_s = fmaxf(b->ttl_s, 0.06f);
+        for (int k = 0; k < live_n; ++k) {
+            enemy_bullet* b = &g->enemy_bullets[live[k]];
+            b->ttl_s -= dt;
+            if (b->ttl_s <= 0.0f) {
+                kill_enemy_bullet(g, b);
+                continue;
             }
-            continue;
-        }
-        if (g->lives > 0 && !player_hit_this_frame) {
-            const float hit_r = b->radius + 12.0f * su;
-            if (dist_sq_level(uses_cylinder, period, b->b.x, b->b.y, g->player.b.x, g->player.b.y) <= hit_r * hit_r) {
-                b->active = 0;
-                apply_player_hit(g, g->player.b.x, g->player.b.y, b->b.vx, b->b.vy, su);
-                player_hit_this_frame = 1;
+            if (uses_cylinder) {
+                if (fabsf(wrap_delta(b->b.x, g->player.b.x, period)) > period * 0.55f) {
+                    kill_enemy_bullet(g, b);
+                    continue;
+                }
+            } else if (fabsf(b->b.x - g->camera_x) > g->world_w * 1.35f) {
+                kill_enemy_bullet(g, b);
+                continue;
+            }
+            if (blocked[k]) {
+                kill_enemy_bullet(g, b);
+                continue;
+            }
+            if (g->shield_active) {
+                if (shield_deflect_body(g, &b->b, b->radius + 2.0f * su, 760.0f * su, uses_cylinder, period)) {
+                    b->ttl_s = fmaxf(b->ttl_s, 0.06f);
+                }
+                continue;
+            }
+            if (g->lives > 0 && !player_hit_this_frame) {
+                const float hit_r = b->radius + 12.0f * su;
+                if (dist_sq_level(uses_cylinder, period, b->b.x, b->b.y, g->player.b.x, g->player.b.y) <= hit_r * hit_r) {
+                    kill_enemy_bullet(g, b);
+                    apply_player_hit(g, g->player.b.x, g->player.b.y, b->b.vx, b->b.vy, su);
+                    player_hit_this_frame = 1;
+                }
             }
         }
     }
 
-    for (size_t bi = 0; bi < MAX_BULLETS; ++bi) {
-        if (!g->bullets[bi].active) {
-            continue;
-        }
-        for (size_t ei = 0; ei < MAX_ENEMIES; ++ei) {
+    build_enemy_hash(g, su, uses_cylinder, period);
+    for (int bi = slot_pool_next(&g->bullet_pool, 0); bi >= 0; bi = slot_pool_next(&g->bullet_pool, bi + 1)) {
+        int candidates[MAX_ENEMIES];
+        int candidate_count;
+        candidate_count = spatial_hash_query(
+            &g->enemy_hash,
+            g->bullets[bi].b.x,
+            g->bullets[bi].b.y,
+            g->enemy_hash.max_radius,
+            candidates,
+            MAX_ENEMIES
+        );
+        for (int ci = 0; ci < candidate_count; ++ci) {
+            const size_t ei = (size_t)candidates[ci];
             if (!g->enemies[ei].active) {
                 continue;
             }
@@ -4176,7 +4539,7 @@ void enemy_update_system(
             }
             if (dist_sq_level(uses_cylinder, period, g->bullets[bi].b.x, g->bullets[bi].b.y, g->enemies[ei].b.x, g->enemies[ei].b.y) <=
                 g->enemies[ei].radius * g->enemies[ei].radius) {
-                g->bullets[bi].active = 0;
+                kill_bullet(g, &g->bullets[bi]);
                 {
                     enemy* hit = &g->enemies[ei];
                     const int damage = boss_enemy_damage_per_hit(g, (int)ei);
@@ -4202,26 +4565,33 @@ void enemy_update_system(
         }
     }
 
-    for (size_t i = 0; i < MAX_ENEMY_DEBRIS; ++i) {
-        enemy_debris* d = &g->debris[i];
-        if (!d->active) {
-            continue;
-        }
-        d->age_s += dt;
-        if (d->age_s >= d->life_s) {
-            d->active = 0;
-            continue;
-        }
-        integrate_body(&d->b, dt);
-        d->angle += d->spin_rate * dt;
-        d->alpha = clampf(1.0f - (d->age_s / d->life_s), 0.0f, 1.0f);
-        if (d->b.y < -48.0f * su) {
-            d->active = 0;
-            continue;
-        }
-        if (!uses_cylinder && fabsf(d->b.x - g->camera_x) > g->world_w * 1.4f) {
-            d->active = 0;
-            continue;
+    {
+        /* Expired pieces are frozen out of the batch step and dropped before it would have run. */
+        int live[MAX_ENEMY_DEBRIS];
+        uint8_t expired[MAX_ENEMY_DEBRIS];
+        const int live_n = slot_pool_collect(&g->debris_pool, live, MAX_ENEMY_DEBRIS);
+        for (int k = 0; k < live_n; ++k) {
+            enemy_debris* d = &g->debris[live[k]];
+            d->age_s += dt;
+            expired[k] = (d->age_s >= d->life_s) ? 1u : 0u;
+        }
+        body_batch_integrate(&g->debris[0].b, sizeof(g->debris[0]), live, expired, live_n, dt, NULL, NULL);
+        for (int k = 0; k < live_n; ++k) {
+            enemy_debris* d = &g->debris[live[k]];
+            if (expired[k]) {
+                kill_debris(g, d);
+                continue;
+            }
+            d->angle += d->spin_rate * dt;
+            d->alpha = clampf(1.0f - (d->age_s / d->life_s), 0.0f, 1.0f);
+            if (d->b.y < -48.0f * su) {
+                kill_debris(g, d);
+                continue;
+            }
+            if (!uses_cylinder && fabsf(d->b.x - g->camera_x) > g->world_w * 1.4f) {
+                kill_debris(g, d);
+                continue;
+            }
         }
     }
 }
@@ -4272,8 +4642,8 @@ void enemy_apply_emp(
             float nx = dx / d;
             float ny = dy / d;
             if (d <= 1.0e-3f) {
-                nx = (frand01() < 0.5f) ? -1.0f : 1.0f;
-                ny = frands1() * 0.25f;
+                nx = (frand01(g) < 0.5f) ? -1.0f : 1.0f;
+                ny = frands1(g) * 0.25f;
             }
             {
                 const float t = 1.0f - clampf((d - primary_radius) / fmaxf(blast_radius - primary_radius, 1.0f), 0.0f, 1.0f);
@@ -4290,16 +4660,13 @@ void enemy_apply_emp(
         }
     }
 
-    for (size_t i = 0; i < MAX_ENEMY_BULLETS; ++i) {
+    for (int i = slot_pool_next(&g->enemy_bullet_pool, 0); i >= 0; i = slot_pool_next(&g->enemy_bullet_pool, i + 1)) {
         enemy_bullet* b = &g->enemy_bullets[i];
-        if (!b->active) {
-            continue;
-        }
         const float dx = uses_cylinder ? wrap_delta(b->b.x, px, period) : (b->b.x - px);
         const float dy = b->b.y - py;
         const float d2 = dx * dx + dy * dy;
         if (d2 <= primary_sq) {
-            b->active = 0;
+            kill_enemy_bullet(g, b);
             continue;
         }
         if (d2 <= blast_sq) {
@@ -4307,8 +4674,8 @@ void enemy_apply_emp(
             float nx = dx / d;
             float ny = dy / d;
             if (d <= 1.0e-3f) {
-                nx = (frand01() < 0.5f) ? -1.0f : 1.0f;
-                ny = frands1() * 0.25f;
+                nx = (frand01(g) < 0.5f) ? -1.0f : 1.0f;
+                ny = frands1(g) * 0.25f;
             }
             {
                 const float t = 1.0f - clampf((d - primary_radius) / fmaxf(blast_radius - primary_radius, 1.0f), 0.0f, 1.0f);
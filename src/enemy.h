@@ -24,6 +24,15 @@ void enemy_spawn_next_wave(
     float cylinder_period
 );
 
+void enemy_rebuild_structure_index(game_state* g);
+
+/*
+ * Helper threads for the enemy read phase; 0 keeps it on the calling thread.
+ * Returns how many started. The pool is process-wide; call only while no
+ * game_update is running.
+ */
+int enemy_set_worker_threads(int threads);
+
 void enemy_update_system(
     game_state* g,
     const leveldef_db* db,
@@ -1,4 +1,5 @@
 #include "game.h"
+#include "body_batch.h"
 #include "boss.h"
 #include "enemy.h"
 #include "leveldef.h"
@@ -10,12 +11,39 @@
 #include <stdlib.h>
 #include <string.h>
 
-static float frand01(void) {
-    return (float)rand() / (float)RAND_MAX;
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+void game_rng_seed(game_rng* rng, uint64_t seed) {
+    if (!rng) {
+        return;
+    }
+    rng->state = 0u;
+    rng->inc = (seed << 1u) | 1u;
+    (void)game_rng_next_u32(rng);
+    rng->state += seed ^ 0x853c49e6748fea9bULL;
+    (void)game_rng_next_u32(rng);
+}
+
+uint32_t game_rng_next_u32(game_rng* rng) {
+    const uint64_t old = rng->state;
+    const uint32_t xorshifted = (uint32_t)(((old >> 18u) ^ old) >> 27u);
+    const uint32_t rot = (uint32_t)(old >> 59u);
+    rng->state = old * 6364136223846793005ULL + rng->inc;
+    return (xorshifted >> rot) | (xorshifted << ((32u - rot) & 31u));
+}
+
+float game_rng_float01(game_rng* rng) {
+    return (float)(game_rng_next_u32(rng) >> 8) * (1.0f / 16777216.0f);
+}
+
+static float frand01(game_state* g) {
+    return game_rng_float01(&g->rng);
 }
 
-static float frands1(void) {
-    return frand01() * 2.0f - 1.0f;
+static float frands1(game_state* g) {
+    return frand01(g) * 2.0f - 1.0f;
 }
 
 static int clampi(int v, int lo, int hi) {
@@ -138,7 +166,7 @@ static void normalize2(float* x, float* y);
 static float wrap_angle_rad(float a);
 static void steer_to_velocity(body* b, float target_vx, float target_vy, float accel, float damping);
 static void integrate_body(body* b, float dt);
-static particle* alloc_particle(game_state* g);
+static particle* alloc_particle(game_state* g, particle* spawn);
 static void explode_mine(game_state* g, mine* m, float impact_vx, float impact_vy);
 static void emit_player_asteroid_explosion(game_state* g);
 static void trigger_emp_visual_at(game_state* g, float x, float y, float radius);
@@ -191,7 +219,7 @@ static void game_queue_death_message(game_state* g) {
     if (n <= 0) {
         return;
     }
-    const size_t idx = (size_t)(rand() % (int)n);
+    const size_t idx = (size_t)(game_rng_next_u32(&g->rng) % (uint32_t)n);
     const char* msg = death_teletype_message_at(idx);
     if (!msg || !msg[0]) {
         return;
@@ -211,6 +239,7 @@ static void game_reset_powerup_state(game_state* g, int clear_pickups) {
         return;
     }
     memset(g->powerups, 0, sizeof(g->powerups));
+    slot_pool_clear(&g->powerup_pool);
     g->powerup_count = 0;
 }
 
@@ -218,28 +247,64 @@ static void game_capture_render_prev_state(game_state* g) {
     if (!g) {
         return;
     }
-    g->prev_player = g->player;
-    memcpy(g->prev_bullets, g->bullets, sizeof(g->prev_bullets));
-    memcpy(g->prev_enemy_bullets, g->enemy_bullets, sizeof(g->prev_enemy_bullets));
-    memcpy(g->prev_enemies, g->enemies, sizeof(g->prev_enemies));
-    memcpy(g->prev_missiles, g->missiles, sizeof(g->prev_missiles));
+    g->prev_player.x = g->player.b.x;
+    g->prev_player.y = g->player.b.y;
+    g->prev_player.facing_x = g->player.facing_x;
+    g->prev_player.facing_y = 0.0f;
+    g->prev_bullet_pool = g->bullet_pool;
+    for (int i = slot_pool_next(&g->bullet_pool, 0); i >= 0; i = slot_pool_next(&g->bullet_pool, i + 1)) {
+        g->prev_bullets[i].x = g->bullets[i].b.x;
+        g->prev_bullets[i].y = g->bullets[i].b.y;
+    }
+    g->prev_enemy_bullet_pool = g->enemy_bullet_pool;
+    for (int i = slot_pool_next(&g->enemy_bullet_pool, 0); i >= 0; i = slot_pool_next(&g->enemy_bullet_pool, i + 1)) {
+        g->prev_enemy_bullets[i].x = g->enemy_bullets[i].b.x;
+        g->prev_enemy_bullets[i].y = g->enemy_bullets[i].b.y;
+    }
+    g->prev_missile_pool = g->missile_pool;
+    for (int i = slot_pool_next(&g->missile_pool, 0); i >= 0; i = slot_pool_next(&g->missile_pool, i + 1)) {
+        g->prev_missiles[i].x = g->missiles[i].b.x;
+        g->prev_missiles[i].y = g->missiles[i].b.y;
+        g->prev_missile_heading[i] = g->missiles[i].heading_rad;
+    }
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const enemy* e = &g->enemies[i];
+        render_enemy_prev* p = &g->prev_enemies[i];
+        p->active = e->active;
+        if (!e->active) {
+            continue;
+        }
+        p->pose.x = e->b.x;
+        p->pose.y = e->b.y;
+        p->pose.facing_x = e->facing_x;
+        p->pose.facing_y = e->facing_y;
+        g->prev_eel_spines[i].count = 0;
+        if (e->visual_kind == ENEMY_VISUAL_EEL) {
+            const enemy_eel_spine* s = &g->eel_spines[i];
+            enemy_eel_spine* ps = &g->prev_eel_spines[i];
+            const int n = clampi(s->count, 0, EEL_SPINE_POINTS);
+            ps->count = n;
+            memcpy(ps->x, s->x, (size_t)n * sizeof(s->x[0]));
+            memcpy(ps->y, s->y, (size_t)n * sizeof(s->y[0]));
+        }
+    }
 }
 
 static powerup_pickup* alloc_powerup_pickup(game_state* g) {
+    powerup_pickup* p;
+    int i;
     if (!g) {
         return NULL;
     }
-    for (int i = 0; i < MAX_POWERUPS; ++i) {
-        if (g->powerups[i].active) {
-            continue;
-        }
-        powerup_pickup* p = &g->powerups[i];
-        memset(p, 0, sizeof(*p));
-        p->active = 1;
-        g->powerup_count += 1;
-        return p;
+    i = slot_pool_alloc(&g->powerup_pool, MAX_POWERUPS);
+    if (i < 0) {
+        return NULL;
     }
-    return NULL;
+    p = &g->powerups[i];
+    memset(p, 0, sizeof(*p));
+    p->active = 1;
+    g->powerup_count += 1;
+    return p;
 }
 
 static void kill_powerup_pickup(game_state* g, powerup_pickup* p) {
@@ -247,13 +312,22 @@ static void kill_powerup_pickup(game_state* g, powerup_pickup* p) {
         return;
     }
     p->active = 0;
+    slot_pool_release(&g->powerup_pool, (int)(p - g->powerups));
     if (g->powerup_count > 0) {
         g->powerup_count -= 1;
     }
 }
 
-static int powerup_pick_drop_type(const game_state* g) {
-    const float r = frand01();
+static void kill_bullet(game_state* g, bullet* b) {
+    if (!g || !b || !b->active) {
+        return;
+    }
+    b->active = 0;
+    slot_pool_release(&g->bullet_pool, (int)(b - g->bullets));
+}
+
+static int powerup_pick_drop_type(game_state* g) {
+    const float r = frand01(g);
     if (level_uses_cylinder(g)) {
         if (r < 0.27f) return POWERUP_DOUBLE_SHOT;
         if (r < 0.48f) return POWERUP_TRIPLE_SHOT;
@@ -315,7 +389,7 @@ static void game_try_spawn_powerup_drop(game_state* g, float x, float y, float v
     }
     /* Credit carry avoids long droughts/clumps while honoring level drop chance long-term. */
     g->powerup_drop_credit = fminf(g->powerup_drop_credit + drop_p, 2.0f);
-    if (g->powerup_drop_credit < 1.0f && frand01() > g->powerup_drop_credit) {
+    if (g->powerup_drop_credit < 1.0f && frand01(g) > g->powerup_drop_credit) {
         return;
     }
     p = alloc_powerup_pickup(g);
@@ -326,18 +400,18 @@ static void game_try_spawn_powerup_drop(game_state* g, float x, float y, float v
     p->type = powerup_pick_drop_type(g);
     p->b.x = x;
     p->b.y = y;
-    p->b.vx = vx * 0.08f + frands1() * 42.0f * su;
-    p->b.vy = vy * 0.08f + frands1() * 36.0f * su;
+    p->b.vx = vx * 0.08f + frands1(g) * 42.0f * su;
+    p->b.vy = vy * 0.08f + frands1(g) * 36.0f * su;
     p->b.ax = 0.0f;
     p->b.ay = 0.0f;
     p->ttl_s = 13.0f;
     p->radius = 14.0f * su;
-    p->spin = frand01() * 6.2831853f;
-    p->spin_rate = frands1() * 2.5f;
+    p->spin = frand01(g) * 6.2831853f;
+    p->spin_rate = frands1(g) * 2.5f;
     if (fabsf(p->spin_rate) < 0.8f) {
         p->spin_rate = (p->spin_rate < 0.0f) ? -0.8f : 0.8f;
     }
-    p->bob_phase = frand01() * 6.2831853f;
+    p->bob_phase = frand01(g) * 6.2831853f;
 }
 
 void game_on_enemy_destroyed(game_state* g, float x, float y, float vx, float vy, int score_delta) {
@@ -381,21 +455,20 @@ static float dist_sq(float ax, float ay, float bx, float by) {
     return dx * dx + dy * dy;
 }
 
-static float point_segment_dist_sq(
+/* Closest point on a + t*ab, t in [0, 1], with ab and its squared length precomputed. */
+static float point_segment_dist_sq_ab(
     float px,
     float py,
     float ax,
     float ay,
-    float bx,
-    float by,
+    float abx,
+    float aby,
+    float denom,
     float* out_cx,
     float* out_cy
 ) {
-    const float abx = bx - ax;
-    const float aby = by - ay;
     const float apx = px - ax;
     const float apy = py - ay;
-    const float denom = abx * abx + aby * aby;
     float t = 0.0f;
     float cx = ax;
     float cy = ay;
@@ -539,36 +612,70 @@ static int segment_intersects_aabb(
     return 1;
 }
 
+#if STRUCTURE_INDEX_CAP < LEVELDEF_MAX_STRUCTURES
+#error "STRUCTURE_INDEX_CAP must cover LEVELDEF_MAX_STRUCTURES"
+#endif
+
+static void rebuild_structure_index(game_state* g) {
+    const leveldef_level* lvl = current_leveldef(g);
+    const float unit_w = g->world_w * (float)LEVELDEF_STRUCTURE_GRID_SCALE / (float)(LEVELDEF_STRUCTURE_GRID_W - 1);
+    const structure_index prev = g->structure_index;
+    structure_index_begin(&g->structure_index);
+    if (lvl && g->render_style != LEVEL_RENDER_CYLINDER) {
+        for (int i = 0; i < lvl->structure_count && i < LEVELDEF_MAX_STRUCTURES; ++i) {
+            const leveldef_structure_instance* st = &lvl->structures[i];
+            float min_x;
+            float min_y;
+            float max_x;
+            float max_y;
+            if (!structure_blocks_gameplay(st)) {
+                continue;
+            }
+            structure_aabb_world(g, st, &min_x, &min_y, &max_x, &max_y);
+            (void)structure_index_add(&g->structure_index, min_x, min_y, max_x, max_y);
+        }
+        structure_index_finish(&g->structure_index);
+    }
+    /* Editor overrides land here too; only cells near edited structures are refilled. */
+    structure_field_update(&g->structure_field, &prev, &g->structure_index, unit_w * 0.5f);
+}
+
+void game_rebuild_structure_caches(game_state* g) {
+    if (!g) {
+        return;
+    }
+    rebuild_structure_index(g);
+    enemy_rebuild_structure_index(g);
+}
+
 int game_structure_circle_overlap(const game_state* g, float x, float y, float radius) {
-    const leveldef_level* lvl;
+    const structure_index* si;
+    int cand[STRUCTURE_INDEX_CAP];
+    int n;
     if (!g) {
         return 0;
     }
     if (g->render_style == LEVEL_RENDER_CYLINDER) {
         return 0;
     }
-    lvl = current_leveldef(g);
-    if (!lvl || lvl->structure_count <= 0) {
-        return 0;
-    }
-    for (int i = 0; i < lvl->structure_count && i < LEVELDEF_MAX_STRUCTURES; ++i) {
-        const leveldef_structure_instance* st = &lvl->structures[i];
-        float min_x;
-        float min_y;
-        float max_x;
-        float max_y;
-        float nx;
-        float ny;
-        float dx;
-        float dy;
-        if (!structure_blocks_gameplay(st)) {
-            continue;
+    if (radius >= 0.0f) {
+        const structure_field* f = &g->structure_field;
+        const float d = structure_field_sample(f, x, y);
+        if (d - f->error > radius) {
+            return 0;
+        }
+        if (d + f->error < radius) {
+            return 1;
         }
-        structure_aabb_world(g, st, &min_x, &min_y, &max_x, &max_y);
-        nx = fmaxf(min_x, fminf(x, max_x));
-        ny = fmaxf(min_y, fminf(y, max_y));
-        dx = x - nx;
-        dy = y - ny;
+    }
+    si = &g->structure_index;
+    n = structure_index_query_x(si, x - radius, x + radius, cand, STRUCTURE_INDEX_CAP);
+    for (int k = 0; k < n; ++k) {
+        const int i = cand[k];
+        const float nx = fmaxf(si->min_x[i], fminf(x, si->max_x[i]));
+        const float ny = fmaxf(si->min_y[i], fminf(y, si->max_y[i]));
+        const float dx = x - nx;
+        const float dy = y - ny;
         if (dx * dx + dy * dy <= radius * radius) {
             return 1;
         }
@@ -665,115 +772,168 @@ void game_structure_avoidance_vector(
 }
 
 int game_line_of_sight_clear(const game_state* g, float x0, float y0, float x1, float y1, float radius) {
-    const leveldef_level* lvl;
-    if (!g) {
-        return 1;
-    }
-    if (g->render_style == LEVEL_RENDER_CYLINDER) {
-        return 1;
-    }
-    lvl = current_leveldef(g);
-    if (!lvl || lvl->structure_count <= 0) {
-        return 1;
-    }
-    if (radius < 0.0f) {
-        radius = 0.0f;
-    }
-    for (int i = 0; i < lvl->structure_count && i < LEVELDEF_MAX_STRUCTURES; ++i) {
-        const leveldef_structure_instance* st = &lvl->structures[i];
-        float min_x;
-        float min_y;
-        float max_x;
-        float max_y;
-        if (!structure_blocks_gameplay(st)) {
-            continue;
+    return !game_structure_segment_blocked(g, x0, y0, x1, y1, radius);
+}
+
+/*
+ * segment_intersects_aabb over the candidate boxes, four at a time. Both
+ * slabs are clipped before the single tmin <= tmax test, which gives the
+ * same answer as the scalar early-outs since clipping only narrows the range.
+ */
+static int segment_hits_indexed_boxes(
+    const structure_index* si,
+    const int* cand,
+    int n,
+    float x0,
+    float y0,
+    float x1,
+    float y1,
+    float pad
+) {
+    int k = 0;
+#if defined(__SSE2__) || defined(_M_X64)
+    {
+        const float dx = x1 - x0;
+        const float dy = y1 - y0;
+        const int flat_x = fabsf(dx) < 1.0e-6f;
+        const int flat_y = fabsf(dy) < 1.0e-6f;
+        const __m128 vpad = _mm_set1_ps(pad);
+        const __m128 vx0 = _mm_set1_ps(x0);
+        const __m128 vy0 = _mm_set1_ps(y0);
+        const __m128 inv_dx = _mm_set1_ps(flat_x ? 0.0f : 1.0f / dx);
+        const __m128 inv_dy = _mm_set1_ps(flat_y ? 0.0f : 1.0f / dy);
+        for (; k + 4 <= n; k += 4) {
+            const int* c = &cand[k];
+            const __m128 min_x = _mm_sub_ps(_mm_set_ps(si->min_x[c[3]], si->min_x[c[2]], si->min_x[c[1]], si->min_x[c[0]]), vpad);
+            const __m128 min_y = _mm_sub_ps(_mm_set_ps(si->min_y[c[3]], si->min_y[c[2]], si->min_y[c[1]], si->min_y[c[0]]), vpad);
+            const __m128 max_x = _mm_add_ps(_mm_set_ps(si->max_x[c[3]], si->max_x[c[2]], si->max_x[c[1]], si->max_x[c[0]]), vpad);
+            const __m128 max_y = _mm_add_ps(_mm_set_ps(si->max_y[c[3]], si->max_y[c[2]], si->max_y[c[1]], si->max_y[c[0]]), vpad);
+            __m128 tmin = _mm_setzero_ps();
+            __m128 tmax = _mm_set1_ps(1.0f);
+            __m128 hit;
+            if (flat_x) {
+                hit = _mm_and_ps(_mm_cmpge_ps(vx0, min_x), _mm_cmple_ps(vx0, max_x));
+            } else {
+                const __m128 t1 = _mm_mul_ps(_mm_sub_ps(min_x, vx0), inv_dx);
+                const __m128 t2 = _mm_mul_ps(_mm_sub_ps(max_x, vx0), inv_dx);
+                tmin = _mm_max_ps(tmin, _mm_min_ps(t1, t2));
+                tmax = _mm_min_ps(tmax, _mm_max_ps(t1, t2));
+                hit = _mm_cmpeq_ps(tmin, tmin);
+            }
+            if (flat_y) {
+                hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmpge_ps(vy0, min_y), _mm_cmple_ps(vy0, max_y)));
+            } else {
+                const __m128 t1 = _mm_mul_ps(_mm_sub_ps(min_y, vy0), inv_dy);
+                const __m128 t2 = _mm_mul_ps(_mm_sub_ps(max_y, vy0), inv_dy);
+                tmin = _mm_max_ps(tmin, _mm_min_ps(t1, t2));
+                tmax = _mm_min_ps(tmax, _mm_max_ps(t1, t2));
+            }
+            hit = _mm_and_ps(hit, _mm_cmple_ps(tmin, tmax));
+            if (_mm_movemask_ps(hit) != 0) {
+                return 1;
+            }
         }
-        structure_aabb_world(g, st, &min_x, &min_y, &max_x, &max_y);
-        min_x -= radius;
-        min_y -= radius;
-        max_x += radius;
-        max_y += radius;
-        if (segment_intersects_aabb(x0, y0, x1, y1, min_x, min_y, max_x, max_y)) {
-            return 0;
+    }
+#endif
+    for (; k < n; ++k) {
+        const int i = cand[k];
+        if (segment_intersects_aabb(
+                x0,
+                y0,
+                x1,
+                y1,
+                si->min_x[i] - pad,
+                si->min_y[i] - pad,
+                si->max_x[i] + pad,
+                si->max_y[i] + pad)) {
+            return 1;
         }
     }
-    return 1;
+    return 0;
+}
+
+static int segment_blocked_indexed(const structure_index* si, float x0, float y0, float x1, float y1, float pad_radius) {
+    int cand[STRUCTURE_INDEX_CAP];
+    int n;
+    if (pad_radius < 0.0f) {
+        pad_radius = 0.0f;
+    }
+    n = structure_index_query_x(si, fminf(x0, x1) - pad_radius, fmaxf(x0, x1) + pad_radius, cand, STRUCTURE_INDEX_CAP);
+    return segment_hits_indexed_boxes(si, cand, n, x0, y0, x1, y1, pad_radius);
 }
 
 int game_structure_segment_blocked(const game_state* g, float x0, float y0, float x1, float y1, float pad_radius) {
-    const leveldef_level* lvl;
-    float unit_w;
-    float unit_h;
-    float min_x;
-    float min_y;
-    float max_x;
-    float max_y;
-    int qmin_x;
-    int qmin_y;
-    int qmax_x;
-    int qmax_y;
     if (!g) {
         return 0;
     }
     if (g->render_style == LEVEL_RENDER_CYLINDER) {
         return 0;
     }
-    lvl = current_leveldef(g);
-    if (!lvl || lvl->structure_count <= 0) {
-        return 0;
-    }
-    if (pad_radius < 0.0f) {
-        pad_radius = 0.0f;
-    }
-    unit_w = g->world_w * (float)LEVELDEF_STRUCTURE_GRID_SCALE / (float)(LEVELDEF_STRUCTURE_GRID_W - 1);
-    unit_h = g->world_h / (float)((LEVELDEF_STRUCTURE_GRID_H - 1) / LEVELDEF_STRUCTURE_GRID_SCALE);
-    min_x = fminf(x0, x1) - pad_radius;
-    min_y = fminf(y0, y1) - pad_radius;
-    max_x = fmaxf(x0, x1) + pad_radius;
-    max_y = fmaxf(y0, y1) + pad_radius;
-    qmin_x = clampi((int)floorf(min_x / fmaxf(unit_w, 1.0e-5f)), 0, LEVELDEF_STRUCTURE_GRID_W - 1);
-    qmin_y = clampi((int)floorf(min_y / fmaxf(unit_h, 1.0e-5f)), 0, LEVELDEF_STRUCTURE_GRID_H - 1);
-    qmax_x = clampi((int)ceilf(max_x / fmaxf(unit_w, 1.0e-5f)), 0, LEVELDEF_STRUCTURE_GRID_W - 1);
-    qmax_y = clampi((int)ceilf(max_y / fmaxf(unit_h, 1.0e-5f)), 0, LEVELDEF_STRUCTURE_GRID_H - 1);
-
-    for (int i = 0; i < lvl->structure_count && i < LEVELDEF_MAX_STRUCTURES; ++i) {
-        const leveldef_structure_instance* st = &lvl->structures[i];
-        int w_units = 1;
-        int h_units = 1;
-        int q;
-        int gx0, gy0, gx1, gy1;
-        if (!structure_blocks_gameplay(st)) {
-            continue;
+    return segment_blocked_indexed(&g->structure_index, x0, y0, x1, y1, pad_radius);
+}
+
+#define SEGMENT_BATCH 512
+
+/*
+ * Queries are bucketed by the single index column their padded x span falls
+ * in (a counting sort per batch), and each column's entries are read out once
+ * for its whole bucket. Spans crossing columns take the per-query path.
+ */
+void game_structure_segments_blocked(const game_state* g, const game_segment_query* q, int n, uint8_t* out_blocked) {
+    const structure_index* si;
+    if (!out_blocked || n <= 0) {
+        return;
+    }
+    if (!g || !q || g->render_style == LEVEL_RENDER_CYLINDER || g->structure_index.count <= 0) {
+        memset(out_blocked, 0, (size_t)n);
+        return;
+    }
+    si = &g->structure_index;
+    for (int base = 0; base < n; base += SEGMENT_BATCH) {
+        const int count = (n - base < SEGMENT_BATCH) ? (n - base) : SEGMENT_BATCH;
+        int column_start[STRUCTURE_INDEX_COLUMNS + 1];
+        int column_fill[STRUCTURE_INDEX_COLUMNS];
+        int16_t column[SEGMENT_BATCH];
+        int order[SEGMENT_BATCH];
+        int cand[STRUCTURE_INDEX_CAP];
+        memset(column_start, 0, sizeof(column_start));
+        for (int k = 0; k < count; ++k) {
+            const game_segment_query* s = &q[base + k];
+            const float pad = fmaxf(s->pad_radius, 0.0f);
+            int c0;
+            int c1;
+            column[k] = -1;
+            if (!structure_index_columns_x(si, fminf(s->x0, s->x1) - pad, fmaxf(s->x0, s->x1) + pad, &c0, &c1)) {
+                out_blocked[base + k] = 0;
+            } else if (c0 != c1) {
+                out_blocked[base + k] = (uint8_t)segment_blocked_indexed(si, s->x0, s->y0, s->x1, s->y1, pad);
+            } else {
+                column[k] = (int16_t)c0;
+                column_start[c0 + 1] += 1;
+            }
         }
-        w_units = (st->w_units > 0) ? st->w_units : 1;
-        h_units = (st->h_units > 0) ? st->h_units : 1;
-        q = ((st->rotation_quadrants % 4) + 4) % 4;
-        if ((q & 1) != 0) {
-            const int tmp = w_units;
-            w_units = h_units;
-            h_units = tmp;
-        }
-        gx0 = st->grid_x;
-        gy0 = st->grid_y;
-        gx1 = gx0 + w_units;
-        gy1 = gy0 + h_units;
-        if (gx1 < qmin_x || gx0 > qmax_x || gy1 < qmin_y || gy0 > qmax_y) {
-            continue;
+        for (int c = 0; c < STRUCTURE_INDEX_COLUMNS; ++c) {
+            column_start[c + 1] += column_start[c];
+            column_fill[c] = column_start[c];
         }
-        structure_aabb_world(g, st, &min_x, &min_y, &max_x, &max_y);
-        if (segment_intersects_aabb(
-                x0,
-                y0,
-                x1,
-                y1,
-                min_x - pad_radius,
-                min_y - pad_radius,
-                max_x + pad_radius,
-                max_y + pad_radius)) {
-            return 1;
+        for (int k = 0; k < count; ++k) {
+            if (column[k] >= 0) {
+                order[column_fill[column[k]]++] = k;
+            }
+        }
+        for (int c = 0; c < STRUCTURE_INDEX_COLUMNS; ++c) {
+            int m;
+            if (column_start[c] == column_start[c + 1]) {
+                continue;
+            }
+            m = structure_index_column_entries(si, c, cand, STRUCTURE_INDEX_CAP);
+            for (int j = column_start[c]; j < column_start[c + 1]; ++j) {
+                const game_segment_query* s = &q[base + order[j]];
+                out_blocked[base + order[j]] =
+                    (uint8_t)segment_hits_indexed_boxes(si, cand, m, s->x0, s->y0, s->x1, s->y1, fmaxf(s->pad_radius, 0.0f));
+            }
         }
     }
-    return 0;
 }
 
 typedef struct mine_tuning {
@@ -965,7 +1125,7 @@ static void update_searchlights(game_state* g, float dt) {
             float dy = g->player.b.y - sl->origin_y;
             normalize2(&dx, &dy);
             /* Slight spread so beam-fire feels synthetic but still targeted. */
-            const float err = frands1() * sl->aim_jitter_rad;
+            const float err = frands1(g) * sl->aim_jitter_rad;
             const float c = cosf(err);
             const float s = sinf(err);
             float dir_x = dx * c - dy * s;
@@ -1078,10 +1238,10 @@ static void asteroid_storm_reset_emitters(game_state* g) {
     const float spawn_rate_per = spawn_rate_total / (float)ASTEROID_EMITTERS;
     const float base_interval = 1.0f / fmaxf(spawn_rate_per, 0.001f);
 
-    g->asteroid_storm_emitter_cursor = (int)(frand01() * (float)ASTEROID_EMITTERS) % ASTEROID_EMITTERS;
+    g->asteroid_storm_emitter_cursor = (int)(frand01(g) * (float)ASTEROID_EMITTERS) % ASTEROID_EMITTERS;
     for (int i = 0; i < ASTEROID_EMITTERS; ++i) {
         /* Randomize initial phases so we don't get visible spawn rows. */
-        g->asteroid_storm_emitter_cd[i] = frand01() * base_interval;
+        g->asteroid_storm_emitter_cd[i] = frand01(g) * base_interval;
     }
 }
 
@@ -1103,12 +1263,12 @@ static int asteroid_try_spawn_inflow_world(game_state* g, asteroid_body* a) {
     }
 
     for (int tries = 0; tries < 12; ++tries) {
-        const float sz = (8.0f + frand01() * 36.0f) * su;
+        const float sz = (8.0f + frand01(g) * 36.0f) * su;
         const float rr = sz * 0.90f;
         const int cursor = (g->asteroid_storm_emitter_cursor + tries) % emitter_n;
         const float cell_w = (x_max - x_min) / (float)emitter_n;
-        const float sx = (x_min + (cursor + 0.5f) * cell_w) + frands1() * (cell_w * 0.45f);
-        const float sy = y_top + frand01() * (pad * 0.85f);
+        const float sx = (x_min + (cursor + 0.5f) * cell_w) + frands1(g) * (cell_w * 0.45f);
+        const float sy = y_top + frand01(g) * (pad * 0.85f);
         if (asteroid_overlap_candidate_world(g, a, sx, sy, rr)) {
             continue;
         }
@@ -1117,15 +1277,15 @@ static int asteroid_try_spawn_inflow_world(game_state* g, asteroid_body* a) {
         a->b.x = sx;
         a->b.y = sy;
         /* Small per-asteroid speed variation avoids visible "lanes" while keeping direction consistent. */
-        const float spd = (0.90f + 0.20f * frand01());
+        const float spd = (0.90f + 0.20f * frand01(g));
         a->b.vx = vx * spd;
         a->b.vy = vy * spd;
         a->b.ax = 0.0f;
         a->b.ay = 0.0f;
         a->size = sz;
         a->radius = rr;
-        a->angle = frand01() * 6.2831853f;
-        a->spin_rate = frands1() * (0.85f + frand01() * 4.80f);
+        a->angle = frand01(g) * 6.2831853f;
+        a->spin_rate = frands1(g) * (0.85f + frand01(g) * 4.80f);
         return 1;
     }
     return 0;
@@ -1252,7 +1412,7 @@ static void update_asteroid_storm(game_state* g, float dt) {
                 spawn_budget -= 1;
                 /* New randomized cooldown: each emitter is its own Poisson-ish source. */
                 const float base = 0.10f + 0.40f / fmaxf(g->asteroid_storm_density, 0.05f);
-                g->asteroid_storm_emitter_cd[ei] = base * (0.6f + 1.2f * frand01());
+                g->asteroid_storm_emitter_cd[ei] = base * (0.6f + 1.2f * frand01(g));
             } else {
                 /* Try again soon. */
                 g->asteroid_storm_emitter_cd[ei] = 0.02f;
@@ -1293,20 +1453,21 @@ static void update_asteroid_storm(game_state* g, float dt) {
 }
 
 static homing_missile* alloc_missile(game_state* g) {
+    homing_missile* m;
+    int i;
     if (!g) {
         return NULL;
     }
-    for (int i = 0; i < MAX_MISSILES; ++i) {
-        if (g->missiles[i].active) {
-            continue;
-        }
-        homing_missile* m = &g->missiles[i];
-        memset(m, 0, sizeof(*m));
-        m->active = 1;
-        g->missile_count += 1;
-        return m;
+    i = slot_pool_alloc(&g->missile_pool, g->caps.missiles);
+    if (i < 0) {
+        return NULL;
     }
-    return NULL;
+    m = &g->missiles[i];
+    memset(m, 0, sizeof(*m));
+    m->active = 1;
+    m->target_index = -1;
+    g->missile_count += 1;
+    return m;
 }
 
 static void kill_missile(game_state* g, homing_missile* m) {
@@ -1314,6 +1475,7 @@ static void kill_missile(game_state* g, homing_missile* m) {
         return;
     }
     m->active = 0;
+    slot_pool_release(&g->missile_pool, (int)(m - g->missiles));
     if (g->missile_count > 0) {
         g->missile_count -= 1;
     }
@@ -1328,38 +1490,35 @@ static void emit_missile_explosion(game_state* g, float x, float y, float vx, fl
     game_push_audio_event(g, GAME_AUDIO_EVENT_EMP, x, y);
     trigger_emp_visual_at(g, x, y, fminf(g->world_w, g->world_h) * 0.08f);
     for (int i = 0; i < 26; ++i) {
-        particle* p = alloc_particle(g);
+        particle spawn;
+        particle* p = alloc_particle(g, &spawn);
         if (!p) {
             break;
         }
-        const float a = frand01() * 6.2831853f;
-        const float spd = (90.0f + frand01() * 320.0f) * su;
-        p->type = (frand01() < 0.70f) ? PARTICLE_POINT : PARTICLE_GEOM;
-        p->b.x = origin_x + frands1() * 4.0f * su;
-        p->b.y = y + frands1() * 4.0f * su;
+        const float a = frand01(g) * 6.2831853f;
+        const float spd = (90.0f + frand01(g) * 320.0f) * su;
+        p->type = (frand01(g) < 0.70f) ? PARTICLE_POINT : PARTICLE_GEOM;
+        p->b.x = origin_x + frands1(g) * 4.0f * su;
+        p->b.y = y + frands1(g) * 4.0f * su;
         p->b.vx = cosf(a) * spd + vx * 0.2f;
         p->b.vy = sinf(a) * spd + vy * 0.2f;
         p->age_s = 0.0f;
-        p->life_s = 0.32f + frand01() * 0.56f;
-        p->size = (2.0f + frand01() * 4.2f) * su;
-        p->spin = frand01() * 6.2831853f;
-        p->spin_rate = frands1() * 9.0f;
+        p->life_s = 0.32f + frand01(g) * 0.56f;
+        p->size = (2.0f + frand01(g) * 4.2f) * su;
+        p->spin = frand01(g) * 6.2831853f;
+        p->spin_rate = frands1(g) * 9.0f;
         p->r = 1.0f;
-        p->g = 0.72f + frand01() * 0.26f;
-        p->bcol = 0.30f + frand01() * 0.34f;
+        p->g = 0.72f + frand01(g) * 0.26f;
+        p->bcol = 0.30f + frand01(g) * 0.34f;
         p->a = 1.0f;
+        game_push_particle(g, p);
     }
 }
 
-static int find_player_missile_target(
-    const game_state* g,
-    const homing_missile* m,
-    float half_angle_deg,
-    float* out_tx,
-    float* out_ty
-) {
-    if (!g || !m || !out_tx || !out_ty) {
-        return 0;
+/* Nearest live enemy inside the missile's forward cone (ties to the lower slot), or -1. */
+static int find_player_missile_target(const game_state* g, const homing_missile* m, float half_angle_deg) {
+    if (!g || !m) {
+        return -1;
     }
     const int uses_cylinder = level_uses_cylinder(g);
     const float period = cylinder_period(g);
@@ -1371,34 +1530,48 @@ static int find_player_missile_target(
     }
     normalize2(&fwd_x, &fwd_y);
     const float cone_cos = cosf(deg_to_rad(clampf(half_angle_deg, 1.0f, 179.0f)));
+    const int max_ring = spatial_hash_max_ring(&g->enemy_hash, m->b.x, m->b.y);
     float best_d2 = 1.0e20f;
+    int best_j = MAX_ENEMIES;
     int found = 0;
-    for (size_t j = 0; j < MAX_ENEMIES; ++j) {
-        const enemy* e = &g->enemies[j];
-        if (!e->active) {
-            continue;
-        }
-        const float dx = uses_cylinder ? wrap_delta(e->b.x, m->b.x, period) : (e->b.x - m->b.x);
-        const float dy = e->b.y - m->b.y;
-        const float d2 = dx * dx + dy * dy;
-        if (d2 <= 1.0e-6f) {
-            continue;
-        }
-        const float inv_d = 1.0f / sqrtf(d2);
-        const float nx = dx * inv_d;
-        const float ny = dy * inv_d;
-        const float dp = nx * fwd_x + ny * fwd_y;
-        if (dp < cone_cos) {
-            continue;
+    /* Grow rings outward from the missile; stop once no unvisited cell can beat the best hit. */
+    for (int ring = 0; ring <= max_ring; ++ring) {
+        int candidates[MAX_ENEMIES];
+        int candidate_count;
+        if (found) {
+            const float reach = spatial_hash_ring_min_dist(&g->enemy_hash, ring);
+            if (reach * reach > best_d2) {
+                break;
+            }
         }
-        if (d2 < best_d2) {
-            best_d2 = d2;
-            *out_tx = m->b.x + dx;
-            *out_ty = m->b.y + dy;
-            found = 1;
+        candidate_count = spatial_hash_query_ring(&g->enemy_hash, m->b.x, m->b.y, ring, candidates, MAX_ENEMIES);
+        for (int ci = 0; ci < candidate_count; ++ci) {
+            const int j = candidates[ci];
+            const enemy* e = &g->enemies[j];
+            if (!e->active) {
+                continue;
+            }
+            const float dx = uses_cylinder ? wrap_delta(e->b.x, m->b.x, period) : (e->b.x - m->b.x);
+            const float dy = e->b.y - m->b.y;
+            const float d2 = dx * dx + dy * dy;
+            if (d2 <= 1.0e-6f) {
+                continue;
+            }
+            const float inv_d = 1.0f / sqrtf(d2);
+            const float nx = dx * inv_d;
+            const float ny = dy * inv_d;
+            const float dp = nx * fwd_x + ny * fwd_y;
+            if (dp < cone_cos) {
+                continue;
+            }
+            if (d2 < best_d2 || (d2 == best_d2 && j < best_j)) {
+                best_d2 = d2;
+                best_j = j;
+                found = 1;
+            }
         }
     }
-    return found;
+    return found ? best_j : -1;
 }
 
 static void explode_missile(game_state* g, homing_missile* m, int direct_hit) {
@@ -1424,8 +1597,8 @@ static void explode_missile(game_state* g, homing_missile* m, int direct_hit) {
             float nx = dx / d;
             float ny = dy / d;
             if (d <= 1.0e-3f) {
-                nx = (frand01() < 0.5f) ? -1.0f : 1.0f;
-                ny = frands1() * 0.25f;
+                nx = (frand01(g) < 0.5f) ? -1.0f : 1.0f;
+                ny = frands1(g) * 0.25f;
             }
             const float blast_push = 1250.0f * su;
             g->player.b.vx += nx * blast_push;
@@ -1442,8 +1615,10 @@ static void explode_missile(game_state* g, homing_missile* m, int direct_hit) {
     } else {
         const float blast_accel = 2200.0f * su;
         const float push_duration_s = 1.10f;
-        for (size_t i = 0; i < MAX_ENEMIES; ++i) {
-            enemy* e = &g->enemies[i];
+        int candidates[MAX_ENEMIES];
+        const int candidate_count = spatial_hash_query(&g->enemy_hash, x, y, blast_r, candidates, MAX_ENEMIES);
+        for (int ci = 0; ci < candidate_count; ++ci) {
+            enemy* e = &g->enemies[candidates[ci]];
             if (!e->active) {
                 continue;
             }
@@ -1487,6 +1662,7 @@ static void configure_missile_launchers_for_level(game_state* g) {
     }
     memset(g->missile_launchers, 0, sizeof(g->missile_launchers));
     memset(g->missiles, 0, sizeof(g->missiles));
+    slot_pool_clear(&g->missile_pool);
     g->missile_launcher_count = 0;
     g->missile_count = 0;
     if (level_uses_cylinder(g)) {
@@ -1535,7 +1711,9 @@ static void configure_arc_nodes_for_level(game_state* g) {
         return;
     }
     memset(g->arc_nodes, 0, sizeof(g->arc_nodes));
+    memset(g->arc_pairs, 0, sizeof(g->arc_pairs));
     g->arc_node_count = 0;
+    g->arc_pair_count = 0;
     if (level_uses_cylinder(g)) {
         return;
     }
@@ -1562,6 +1740,23 @@ static void configure_arc_nodes_for_level(game_state* g) {
         an->sound_timer_s = 0.0f;
         an->energized_prev = 0;
     }
+    /* Nodes pair up in level order; pairs that can never energize are left out. */
+    for (int i = 0; i + 1 < g->arc_node_count; i += 2) {
+        const arc_node_runtime* a = &g->arc_nodes[i];
+        const arc_node_runtime* b = &g->arc_nodes[i + 1];
+        arc_node_pair* pair;
+        if (a->on_s <= 0.0f) {
+            continue;
+        }
+        pair = &g->arc_pairs[g->arc_pair_count++];
+        pair->a = i;
+        pair->b = i + 1;
+        pair->ab_x = b->x - a->x;
+        pair->ab_y = b->y - a->y;
+        pair->len_sq = pair->ab_x * pair->ab_x + pair->ab_y * pair->ab_y;
+        pair->mid_x = 0.5f * (a->x + b->x);
+        pair->mid_y = 0.5f * (a->y + b->y);
+    }
 }
 
 static void update_arc_nodes(game_state* g, float dt) {
@@ -1571,17 +1766,11 @@ static void update_arc_nodes(game_state* g, float dt) {
     g->lightning_active = 0;
     g->lightning_audio_gain = 0.0f;
     g->lightning_audio_pan = 0.0f;
-    for (int i = 0; i + 1 < g->arc_node_count && i + 1 < MAX_ARC_NODES; i += 2) {
-        arc_node_runtime* a = &g->arc_nodes[i];
-        arc_node_runtime* b = &g->arc_nodes[i + 1];
-        if (!a->active || !b->active) {
-            continue;
-        }
-        const float period = fmaxf(a->period_s, 0.10f);
-        const float on_s = clampf(a->on_s, 0.0f, period);
-        if (on_s <= 0.0f) {
-            continue;
-        }
+    for (int p = 0; p < g->arc_pair_count; ++p) {
+        const arc_node_pair* pair = &g->arc_pairs[p];
+        arc_node_runtime* a = &g->arc_nodes[pair->a];
+        const float period = a->period_s;
+        const float on_s = a->on_s;
         const float t = fmodf(g->t + a->phase_s, period);
         const int energized = (t <= on_s);
         if (!energized) {
@@ -1592,26 +1781,28 @@ static void update_arc_nodes(game_state* g, float dt) {
         }
         float cx = 0.0f;
         float cy = 0.0f;
-        const float d2 = point_segment_dist_sq(
+        const float d2 = point_segment_dist_sq_ab(
             g->player.b.x,
             g->player.b.y,
             a->x,
             a->y,
-            b->x,
-            b->y,
+            pair->ab_x,
+            pair->ab_y,
+            pair->len_sq,
             &cx,
             &cy
         );
         {
             float sx = 0.0f;
             float sy = 0.0f;
-            const float d2_screen = point_segment_dist_sq(
+            const float d2_screen = point_segment_dist_sq_ab(
                 g->camera_x,
                 g->camera_y,
                 a->x,
                 a->y,
-                b->x,
-                b->y,
+                pair->ab_x,
+                pair->ab_y,
+                pair->len_sq,
                 &sx,
                 &sy
             );
@@ -1654,7 +1845,7 @@ static void update_arc_nodes(game_state* g, float dt) {
                 if (audible) {
                     g->lightning_active = 1;
                     if (near01 > g->lightning_audio_gain) {
-                        const float gate_x = 0.5f * (a->x + b->x);
+                        const float gate_x = pair->mid_x;
                         const float pan = clampf((gate_x - g->player.b.x) / (g->world_w * 0.45f), -1.0f, 1.0f);
                         g->lightning_audio_gain = near01;
                         g->lightning_audio_pan = pan;
@@ -1662,7 +1853,7 @@ static void update_arc_nodes(game_state* g, float dt) {
                 }
             }
             if (audible && !a->energized_prev) {
-                game_push_audio_event(g, GAME_AUDIO_EVENT_LIGHTNING, 0.5f * (a->x + b->x), 0.5f * (a->y + b->y));
+                game_push_audio_event(g, GAME_AUDIO_EVENT_LIGHTNING, pair->mid_x, pair->mid_y);
             }
         }
         a->energized_prev = 1;
@@ -1797,6 +1988,20 @@ static void spawn_player_missile(game_state* g) {
     g->fire_sfx_pending += 1;
 }
 
+/*
+ * Keeps a player missile on the enemy it locked onto until that enemy dies;
+ * only then does it search the enemy hash for a new one. Returns the slot or -1.
+ */
+static int player_missile_lock(const game_state* g, homing_missile* m) {
+    const int t = m->target_index;
+    if (t >= 0 && t < MAX_ENEMIES && g->enemies[t].active && g->enemies[t].serial == m->target_serial) {
+        return t;
+    }
+    m->target_index = find_player_missile_target(g, m, 70.0f);
+    m->target_serial = (m->target_index >= 0) ? g->enemies[m->target_index].serial : 0u;
+    return m->target_index;
+}
+
 static void update_missile_system(game_state* g, float dt) {
     if (!g || dt <= 0.0f) {
         return;
@@ -1830,13 +2035,10 @@ static void update_missile_system(game_state* g, float dt) {
         }
     }
 
-    for (int i = 0; i < MAX_MISSILES; ++i) {
+    for (int i = slot_pool_next(&g->missile_pool, 0); i >= 0; i = slot_pool_next(&g->missile_pool, i + 1)) {
         homing_missile* m = &g->missiles[i];
         float prev_x;
         float prev_y;
-        if (!m->active) {
-            continue;
-        }
         prev_x = m->b.x;
         prev_y = m->b.y;
 
@@ -1863,7 +2065,13 @@ static void update_missile_system(game_state* g, float dt) {
         float tx = g->player.b.x;
         float ty = g->player.b.y;
         if (m->owner == MISSILE_OWNER_PLAYER) {
-            if (!find_player_missile_target(g, m, 70.0f, &tx, &ty)) {
+            const int target = player_missile_lock(g, m);
+            if (target >= 0) {
+                const enemy* e = &g->enemies[target];
+                const float dx = level_uses_cylinder(g) ? wrap_delta(e->b.x, m->b.x, cylinder_period(g)) : (e->b.x - m->b.x);
+                tx = m->b.x + dx;
+                ty = m->b.y + (e->b.y - m->b.y);
+            } else {
                 tx = m->b.x + m->forward_x * g->world_w;
                 ty = m->b.y + m->forward_y * g->world_h * 0.02f;
             }
@@ -1904,29 +2112,31 @@ static void update_missile_system(game_state* g, float dt) {
             }
             m->trail_emit_accum -= (float)emit_n;
             for (int p = 0; p < emit_n; ++p) {
-                particle* pr = alloc_particle(g);
+                particle spawn;
+                particle* pr = alloc_particle(g, &spawn);
                 if (!pr) {
                     break;
                 }
                 const float tx = -cosf(m->heading_rad);
                 const float ty = -sinf(m->heading_rad);
-                float jx = frands1() * 0.30f;
-                float jy = frands1() * 0.30f;
+                float jx = frands1(g) * 0.30f;
+                float jy = frands1(g) * 0.30f;
                 normalize2(&jx, &jy);
                 pr->type = PARTICLE_POINT;
                 pr->b.x = m->b.x + tx * (m->radius * 0.95f);
                 pr->b.y = m->b.y + ty * (m->radius * 0.95f);
-                pr->b.vx = tx * (180.0f + frand01() * 120.0f) * su + jx * 40.0f * su;
-                pr->b.vy = ty * (180.0f + frand01() * 120.0f) * su + jy * 40.0f * su;
+                pr->b.vx = tx * (180.0f + frand01(g) * 120.0f) * su + jx * 40.0f * su;
+                pr->b.vy = ty * (180.0f + frand01(g) * 120.0f) * su + jy * 40.0f * su;
                 pr->age_s = 0.0f;
-                pr->life_s = 0.10f + frand01() * 0.20f;
-                pr->size = (1.1f + frand01() * 2.0f) * su;
+                pr->life_s = 0.10f + frand01(g) * 0.20f;
+                pr->size = (1.1f + frand01(g) * 2.0f) * su;
                 pr->spin = 0.0f;
                 pr->spin_rate = 0.0f;
                 pr->r = 1.0f;
-                pr->g = 0.70f + frand01() * 0.24f;
-                pr->bcol = 0.20f + frand01() * 0.20f;
+                pr->g = 0.70f + frand01(g) * 0.24f;
+                pr->bcol = 0.20f + frand01(g) * 0.20f;
                 pr->a = 1.0f;
+                game_push_particle(g, pr);
             }
         }
 
@@ -1940,8 +2150,17 @@ static void update_missile_system(game_state* g, float dt) {
             const float su = gameplay_ui_scale(g);
             const int uses_cylinder = level_uses_cylinder(g);
             const float period = cylinder_period(g);
-            for (size_t j = 0; j < MAX_ENEMIES; ++j) {
-                const enemy* e = &g->enemies[j];
+            int candidates[MAX_ENEMIES];
+            const int candidate_count = spatial_hash_query(
+                &g->enemy_hash,
+                m->b.x,
+                m->b.y,
+                m->radius + g->enemy_hash.max_radius,
+                candidates,
+                MAX_ENEMIES
+            );
+            for (int ci = 0; ci < candidate_count; ++ci) {
+                const enemy* e = &g->enemies[candidates[ci]];
                 if (!e->active) {
                     continue;
                 }
@@ -1972,6 +2191,7 @@ static void configure_minefields_for_level(game_state* g) {
         return;
     }
     memset(g->mines, 0, sizeof(g->mines));
+    slot_pool_clear(&g->mine_pool);
     g->mine_count = 0;
     if (level_uses_cylinder(g)) {
         return;
@@ -1994,8 +2214,8 @@ static void configure_minefields_for_level(game_state* g) {
             int placed = 0;
             for (int tries = 0; tries < 20; ++tries) {
                 const float rr = tune.size;
-                const float px = cx + (frands1() * 0.5f) * field_w;
-                const float py = cy + (frands1() * 0.5f) * field_h;
+                const float px = cx + (frands1(g) * 0.5f) * field_w;
+                const float py = cy + (frands1(g) * 0.5f) * field_h;
                 int overlap = 0;
                 if (game_structure_circle_overlap(g, px, py, rr)) {
                     continue;
@@ -2016,11 +2236,12 @@ static void configure_minefields_for_level(game_state* g) {
                 }
                 memset(m, 0, sizeof(*m));
                 m->active = 1;
+                slot_pool_mark(&g->mine_pool, (int)(m - g->mines));
                 m->b.x = px;
                 m->b.y = py;
                 m->radius = rr;
-                m->angle = frand01() * 6.2831853f;
-                m->spin_rate = frands1() * (0.8f + frand01() * 2.4f);
+                m->angle = frand01(g) * 6.2831853f;
+                m->spin_rate = frands1(g) * (0.8f + frand01(g) * 2.4f);
                 m->hp = 10;
                 m->style = clampi(mf->style, MINE_STYLE_CLASSIC, MINE_STYLE_INDUSTRIAL);
                 placed = 1;
@@ -2038,11 +2259,8 @@ static void minefield_apply_emp(game_state* g, float radius) {
         return;
     }
     const float rr2 = radius * radius;
-    for (int i = 0; i < g->mine_count && i < MAX_MINES; ++i) {
+    for (int i = slot_pool_next(&g->mine_pool, 0); i >= 0; i = slot_pool_next(&g->mine_pool, i + 1)) {
         mine* m = &g->mines[i];
-        if (!m->active) {
-            continue;
-        }
         if (dist_sq(m->b.x, m->b.y, g->player.b.x, g->player.b.y) <= rr2) {
             explode_mine(g, m, 0.0f, 0.0f);
         }
@@ -2058,13 +2276,17 @@ static void update_minefields(game_state* g, float dt) {
     const float det2 = t.detonation_distance * t.detonation_distance;
     const float su = gameplay_ui_scale(g);
 
-    for (int i = 0; i < g->mine_count && i < MAX_MINES; ++i) {
+    spatial_hash_begin(&g->bullet_hash, 96.0f * su, 0, 0.0f);
+    for (int bi = slot_pool_next(&g->bullet_pool, 0); bi >= 0; bi = slot_pool_next(&g->bullet_pool, bi + 1)) {
+        const bullet* b = &g->bullets[bi];
+        (void)spatial_hash_add(&g->bullet_hash, bi, b->b.x, b->b.y, 0.0f);
+    }
+    spatial_hash_finish(&g->bullet_hash);
+
+    for (int i = slot_pool_next(&g->mine_pool, 0); i >= 0; i = slot_pool_next(&g->mine_pool, i + 1)) {
         mine* m = &g->mines[i];
         float prev_x;
         float prev_y;
-        if (!m->active) {
-            continue;
-        }
         prev_x = m->b.x;
         prev_y = m->b.y;
         float dx = g->player.b.x - m->b.x;
@@ -2093,13 +2315,15 @@ static void update_minefields(game_state* g, float dt) {
         }
 
         /* Bullet impacts: mine takes 10 hits. */
-        for (size_t bi = 0; bi < MAX_BULLETS; ++bi) {
-            bullet* b = &g->bullets[bi];
+        int candidates[MAX_BULLETS];
+        const int candidate_count = spatial_hash_query(&g->bullet_hash, m->b.x, m->b.y, m->radius, candidates, MAX_BULLETS);
+        for (int ci = 0; ci < candidate_count; ++ci) {
+            bullet* b = &g->bullets[candidates[ci]];
             if (!b->active) {
                 continue;
             }
             if (dist_sq(b->b.x, b->b.y, m->b.x, m->b.y) <= m->radius * m->radius) {
-                b->active = 0;
+                kill_bullet(g, b);
                 m->hp -= 1;
                 if (m->hp <= 0) {
                     const float kill_x = m->b.x;
@@ -2121,8 +2345,8 @@ static void update_minefields(game_state* g, float dt) {
             float nx = g->player.b.x - m->b.x;
             float ny = g->player.b.y - m->b.y;
             if (nx * nx + ny * ny < 1.0e-6f) {
-                nx = (frand01() < 0.5f) ? -1.0f : 1.0f;
-                ny = frands1() * 0.25f;
+                nx = (frand01(g) < 0.5f) ? -1.0f : 1.0f;
+                ny = frands1(g) * 0.25f;
             }
             normalize2(&nx, &ny);
             g->player.b.vx += nx * t.push_impulse;
@@ -2190,6 +2414,74 @@ static void configure_exit_portal_for_level(game_state* g) {
     g->gating_bosses_remaining = g->exit_requires_boss_defeated ? level_count_gating_boss_markers(lvl) : 0;
 }
 
+/* Curated order: by x, then by index so entries at the same x keep file order. */
+static int curated_x_less(const leveldef_level* lvl, int a, int b) {
+    const float xa = lvl->curated[a].x01;
+    const float xb = lvl->curated[b].x01;
+    return (xa < xb) || (xa == xb && a < b);
+}
+
+/* Binary heap of curated indices; max_top keeps the largest x on top instead of the smallest. */
+static int curated_heap_above(const leveldef_level* lvl, int a, int b, int max_top) {
+    return max_top ? curated_x_less(lvl, b, a) : curated_x_less(lvl, a, b);
+}
+
+static void curated_heap_push(const leveldef_level* lvl, int16_t* heap, int* count, int idx, int max_top) {
+    int i = (*count)++;
+    while (i > 0) {
+        const int parent = (i - 1) / 2;
+        if (!curated_heap_above(lvl, idx, heap[parent], max_top)) {
+            break;
+        }
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = (int16_t)idx;
+}
+
+static void curated_heap_pop(const leveldef_level* lvl, int16_t* heap, int* count, int max_top) {
+    const int last = heap[--(*count)];
+    int i = 0;
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= *count) {
+            break;
+        }
+        if (child + 1 < *count && curated_heap_above(lvl, heap[child + 1], heap[child], max_top)) {
+            child += 1;
+        }
+        if (!curated_heap_above(lvl, heap[child], last, max_top)) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = (int16_t)last;
+}
+
+static void build_curated_schedule(game_state* g, const leveldef_level* lvl) {
+    int n = 0;
+    for (int i = 0; i < lvl->curated_count && i < MAX_CURATED_RUNTIME; ++i) {
+        int j;
+        /* A non-finite x never enters the activation window, so it is left out. */
+        if (!isfinite(lvl->curated[i].x01)) {
+            continue;
+        }
+        j = n++;
+        while (j > 0 && curated_x_less(lvl, i, g->curated_schedule[j - 1])) {
+            g->curated_schedule[j] = g->curated_schedule[j - 1];
+            j -= 1;
+        }
+        g->curated_schedule[j] = (int16_t)i;
+    }
+    g->curated_schedule_count = n;
+    /* A sorted array is already a min-heap. */
+    memcpy(g->curated_ahead, g->curated_schedule, (size_t)n * sizeof(g->curated_schedule[0]));
+    g->curated_ahead_count = n;
+    g->curated_behind_count = 0;
+    g->curated_spawned_count = 0;
+}
+
 static void apply_level_runtime_config(game_state* g) {
     const leveldef_level* lvl;
     if (!g) {
@@ -2203,6 +2495,7 @@ static void apply_level_runtime_config(game_state* g) {
     }
     g->render_style = lvl->render_style;
     g->level_theme_palette = lvl->theme_palette;
+    game_rebuild_structure_caches(g);
     g->wave_cooldown_s = lvl->wave_cooldown_initial_s;
     if (lvl->wave_mode != LEVELDEF_WAVES_CURATED) {
         g->wave_cooldown_s = fmaxf(g->wave_cooldown_s, 2.5f);
@@ -2216,8 +2509,7 @@ static void apply_level_runtime_config(game_state* g) {
     if (lvl->wave_mode != LEVELDEF_WAVES_CURATED && lvl->event_count > 0) {
         g->auto_event_delay_s = fmaxf(g->auto_event_delay_s, 2.5f);
     }
-    g->curated_spawned_count = 0;
-    memset(g->curated_spawned, 0, sizeof(g->curated_spawned));
+    build_curated_schedule(g, lvl);
     configure_searchlights_for_level(g);
     configure_minefields_for_level(g);
     configure_missile_launchers_for_level(g);
@@ -2226,6 +2518,15 @@ static void apply_level_runtime_config(game_state* g) {
     configure_exit_portal_for_level(g);
 }
 
+static void seed_level_rng(game_state* g) {
+    uint64_t h = 1469598103934665603ULL;
+    for (const char* c = g->current_level_name; *c; ++c) {
+        h ^= (uint64_t)(unsigned char)*c;
+        h *= 1099511628211ULL;
+    }
+    game_rng_seed(&g->rng, h ^ ((uint64_t)g->rng_seed * 0x9e3779b97f4a7c15ULL));
+}
+
 static int set_level_index(game_state* g, int index) {
     const float su = gameplay_ui_scale(g);
     if (!g || g_level_count <= 0 || index < 0 || index >= g_level_count) {
@@ -2234,21 +2535,30 @@ static int set_level_index(game_state* g, int index) {
     g->level_index = index;
     g->level_style = g_levels[index].style_hint;
     snprintf(g->current_level_name, sizeof(g->current_level_name), "%s", g_levels[index].name);
+    seed_level_rng(g);
     memset(g->bullets, 0, sizeof(g->bullets));
     memset(g->enemy_bullets, 0, sizeof(g->enemy_bullets));
     memset(g->enemies, 0, sizeof(g->enemies));
-    memset(g->particles, 0, sizeof(g->particles));
+    particle_store_clear(&g->particles);
     memset(g->debris, 0, sizeof(g->debris));
     memset(g->asteroids, 0, sizeof(g->asteroids));
     memset(g->mines, 0, sizeof(g->mines));
     memset(g->missiles, 0, sizeof(g->missiles));
     memset(g->missile_launchers, 0, sizeof(g->missile_launchers));
     memset(g->arc_nodes, 0, sizeof(g->arc_nodes));
+    memset(g->arc_pairs, 0, sizeof(g->arc_pairs));
     memset(g->eel_arcs, 0, sizeof(g->eel_arcs));
     memset(g->powerups, 0, sizeof(g->powerups));
-    g->active_particles = 0;
+    slot_pool_clear(&g->bullet_pool);
+    slot_pool_clear(&g->enemy_bullet_pool);
+    slot_pool_clear(&g->debris_pool);
+    slot_pool_clear(&g->mine_pool);
+    slot_pool_clear(&g->missile_pool);
+    slot_pool_clear(&g->eel_arc_pool);
+    slot_pool_clear(&g->powerup_pool);
     g->wave_index = 0;
     g->wave_id_alloc = 0;
+    g->enemy_serial_alloc = 0u;
     g->wave_announce_pending = 0;
     g->fire_sfx_pending = 0;
     g->player.b.x = 170.0f * su;
@@ -2278,6 +2588,7 @@ static int set_level_index(game_state* g, int index) {
     g->missile_count = 0;
     g->missile_launcher_count = 0;
     g->arc_node_count = 0;
+    g->arc_pair_count = 0;
     g->eel_arc_count = 0;
     g->powerup_count = 0;
     g->powerup_drop_credit = 0.0f;
@@ -2348,27 +2659,42 @@ static void integrate_body(body* b, float dt) {
     b->y += b->vy * dt;
 }
 
-static particle* alloc_particle(game_state* g) {
-    for (size_t i = 0; i < MAX_PARTICLES; ++i) {
-        if (!g->particles[i].active) {
-            particle* p = &g->particles[i];
-            memset(p, 0, sizeof(*p));
-            p->active = 1;
-            g->active_particles += 1;
-            return p;
-        }
+/* Zeroes a spawn record when the store has room; game_push_particle commits it. */
+static particle* alloc_particle(game_state* g, particle* spawn) {
+    if (g->particles.count >= g->caps.particles) {
+        return NULL;
     }
-    return NULL;
+    memset(spawn, 0, sizeof(*spawn));
+    return spawn;
 }
 
-static void kill_particle(game_state* g, particle* p) {
-    if (!p || !p->active) {
+void game_push_particle(game_state* g, const particle* p) {
+    particle_store* ps;
+    int i;
+    if (!g || !p) {
         return;
     }
-    p->active = 0;
-    if (g->active_particles > 0) {
-        g->active_particles -= 1;
+    ps = &g->particles;
+    i = (ps->count < g->caps.particles) ? particle_store_alloc(ps) : -1;
+    if (i < 0) {
+        return;
     }
+    ps->type[i] = (uint8_t)p->type;
+    ps->x[i] = p->b.x;
+    ps->y[i] = p->b.y;
+    ps->vx[i] = p->b.vx;
+    ps->vy[i] = p->b.vy;
+    ps->ax[i] = p->b.ax;
+    ps->ay[i] = p->b.ay;
+    ps->age_s[i] = p->age_s;
+    ps->life_s[i] = p->life_s;
+    ps->size[i] = p->size;
+    ps->spin[i] = p->spin;
+    ps->spin_rate[i] = p->spin_rate;
+    ps->r[i] = p->r;
+    ps->g[i] = p->g;
+    ps->b[i] = p->bcol;
+    ps->a[i] = p->a;
 }
 
 static void emit_player_asteroid_explosion(game_state* g) {
@@ -2379,7 +2705,8 @@ static void emit_player_asteroid_explosion(game_state* g) {
     const float origin_x = normalize_cylinder_world_x(g, g->player.b.x);
     game_push_audio_event(g, GAME_AUDIO_EVENT_EXPLOSION, g->player.b.x, g->player.b.y);
     {
-        particle* f = alloc_particle(g);
+        particle spawn;
+        particle* f = alloc_particle(g, &spawn);
         if (f) {
             f->type = PARTICLE_FLASH;
             f->b.x = origin_x;
@@ -2391,29 +2718,32 @@ static void emit_player_asteroid_explosion(game_state* g) {
             f->g = 0.96f;
             f->bcol = 0.72f;
             f->a = 1.0f;
+            game_push_particle(g, f);
         }
     }
     for (int i = 0; i < 56; ++i) {
-        particle* p = alloc_particle(g);
+        particle spawn;
+        particle* p = alloc_particle(g, &spawn);
         if (!p) {
             break;
         }
-        const float a = frand01() * 6.2831853f;
-        const float spd = (120.0f + frand01() * 420.0f) * su;
-        p->type = (frand01() < 0.7f) ? PARTICLE_POINT : PARTICLE_GEOM;
-        p->b.x = origin_x + frands1() * 5.0f * su;
-        p->b.y = g->player.b.y + frands1() * 5.0f * su;
+        const float a = frand01(g) * 6.2831853f;
+        const float spd = (120.0f + frand01(g) * 420.0f) * su;
+        p->type = (frand01(g) < 0.7f) ? PARTICLE_POINT : PARTICLE_GEOM;
+        p->b.x = origin_x + frands1(g) * 5.0f * su;
+        p->b.y = g->player.b.y + frands1(g) * 5.0f * su;
         p->b.vx = cosf(a) * spd + g->player.b.vx * 0.25f;
         p->b.vy = sinf(a) * spd + g->player.b.vy * 0.25f;
         p->age_s = 0.0f;
-        p->life_s = 0.55f + frand01() * 0.65f;
-        p->size = (2.5f + frand01() * 5.2f) * su;
-        p->spin = frand01() * 6.2831853f;
-        p->spin_rate = frands1() * 10.0f;
+        p->life_s = 0.55f + frand01(g) * 0.65f;
+        p->size = (2.5f + frand01(g) * 5.2f) * su;
+        p->spin = frand01(g) * 6.2831853f;
+        p->spin_rate = frands1(g) * 10.0f;
         p->r = 1.0f;
-        p->g = 0.56f + frand01() * 0.40f;
-        p->bcol = 0.22f + frand01() * 0.32f;
+        p->g = 0.56f + frand01(g) * 0.40f;
+        p->bcol = 0.22f + frand01(g) * 0.32f;
         p->a = 1.0f;
+        game_push_particle(g, p);
     }
 }
 
@@ -2423,26 +2753,23 @@ static void emit_mine_debris(game_state* g, float x, float y, float radius, floa
     }
     const float su = gameplay_ui_scale(g);
     for (int seg = 0; seg < 12; ++seg) {
-        for (size_t i = 0; i < MAX_ENEMY_DEBRIS; ++i) {
+        const int i = slot_pool_alloc(&g->debris_pool, g->caps.debris);
+        if (i >= 0) {
             enemy_debris* d = &g->debris[i];
-            if (d->active) {
-                continue;
-            }
             const float a = ((float)seg / 12.0f) * 6.2831853f;
             d->active = 1;
             d->half_len = radius * 0.36f;
             d->angle = a;
-            d->spin_rate = frands1() * (5.0f + 7.0f * frand01());
+            d->spin_rate = frands1(g) * (5.0f + 7.0f * frand01(g));
             d->b.x = x + cosf(a) * radius * 0.30f;
             d->b.y = y + sinf(a) * radius * 0.30f;
-            d->b.vx = cosf(a) * (82.0f + frand01() * 190.0f) * su + impact_vx * 0.18f;
-            d->b.vy = sinf(a) * (82.0f + frand01() * 190.0f) * su + impact_vy * 0.18f;
+            d->b.vx = cosf(a) * (82.0f + frand01(g) * 190.0f) * su + impact_vx * 0.18f;
+            d->b.vy = sinf(a) * (82.0f + frand01(g) * 190.0f) * su + impact_vy * 0.18f;
             d->b.ax = -d->b.vx * 0.16f;
             d->b.ay = -220.0f;
             d->age_s = 0.0f;
-            d->life_s = 1.5f + frand01() * 0.95f;
+            d->life_s = 1.5f + frand01(g) * 0.95f;
             d->alpha = 1.0f;
-            break;
         }
     }
 }
@@ -2471,28 +2798,31 @@ static void explode_mine(game_state* g, mine* m, float impact_vx, float impact_v
     trigger_emp_visual_at(g, x, y, mine_tuning_for(g).emp_fx_radius);
     emit_mine_debris(g, x, y, m->radius, impact_vx, impact_vy);
     for (int i = 0; i < 22; ++i) {
-        particle* p = alloc_particle(g);
+        particle spawn;
+        particle* p = alloc_particle(g, &spawn);
         if (!p) {
             break;
         }
-        const float a = frand01() * 6.2831853f;
-        const float spd = (75.0f + frand01() * 220.0f) * su;
-        p->type = (frand01() < 0.65f) ? PARTICLE_POINT : PARTICLE_GEOM;
-        p->b.x = x + frands1() * 5.0f * su;
-        p->b.y = y + frands1() * 5.0f * su;
+        const float a = frand01(g) * 6.2831853f;
+        const float spd = (75.0f + frand01(g) * 220.0f) * su;
+        p->type = (frand01(g) < 0.65f) ? PARTICLE_POINT : PARTICLE_GEOM;
+        p->b.x = x + frands1(g) * 5.0f * su;
+        p->b.y = y + frands1(g) * 5.0f * su;
         p->b.vx = cosf(a) * spd + impact_vx * 0.2f;
         p->b.vy = sinf(a) * spd + impact_vy * 0.2f;
         p->age_s = 0.0f;
-        p->life_s = 0.45f + frand01() * 0.55f;
-        p->size = (2.2f + frand01() * 4.0f) * su;
-        p->spin = frand01() * 6.2831853f;
-        p->spin_rate = frands1() * 9.0f;
+        p->life_s = 0.45f + frand01(g) * 0.55f;
+        p->size = (2.2f + frand01(g) * 4.0f) * su;
+        p->spin = frand01(g) * 6.2831853f;
+        p->spin_rate = frands1(g) * 9.0f;
         p->r = 1.0f;
-        p->g = 0.82f + frand01() * 0.18f;
-        p->bcol = 0.38f + frand01() * 0.28f;
+        p->g = 0.82f + frand01(g) * 0.18f;
+        p->bcol = 0.38f + frand01(g) * 0.28f;
         p->a = 1.0f;
+        game_push_particle(g, p);
     }
     m->active = 0;
+    slot_pool_release(&g->mine_pool, (int)(m - g->mines));
 }
 
 static void game_push_audio_event(game_state* g, game_audio_event_type type, float x, float y) {
@@ -2543,49 +2873,50 @@ static void emit_thruster(game_state* g, float dt) {
     }
     g->thruster_emit_accum -= (float)emit_count;
     for (int i = 0; i < emit_count; ++i) {
-        particle* p = alloc_particle(g);
+        particle spawn;
+        particle* p = alloc_particle(g, &spawn);
         if (!p) {
             return;
         }
-        p->type = (frand01() < 0.75f) ? PARTICLE_POINT : PARTICLE_GEOM;
-        p->b.x = g->player.b.x - dir * (40.0f + frand01() * 4.0f) * su;
-        p->b.y = g->player.b.y + frands1() * 4.5f * su;
-        p->b.vx = -dir * (220.0f + frand01() * 220.0f) * su + g->player.b.vx * 0.25f;
-        p->b.vy = frands1() * 30.0f * su + g->player.b.vy * 0.15f;
+        p->type = (frand01(g) < 0.75f) ? PARTICLE_POINT : PARTICLE_GEOM;
+        p->b.x = g->player.b.x - dir * (40.0f + frand01(g) * 4.0f) * su;
+        p->b.y = g->player.b.y + frands1(g) * 4.5f * su;
+        p->b.vx = -dir * (220.0f + frand01(g) * 220.0f) * su + g->player.b.vx * 0.25f;
+        p->b.vy = frands1(g) * 30.0f * su + g->player.b.vy * 0.15f;
         p->b.ax = -p->b.vx * 1.9f;
         p->b.ay = -p->b.vy * 1.6f;
         p->age_s = 0.0f;
-        p->life_s = 0.10f + frand01() * 0.15f;
-        p->size = (2.1f + frand01() * 3.6f) * su;
-        p->spin = frand01() * 6.2831853f;
-        p->spin_rate = frands1() * 15.0f;
+        p->life_s = 0.10f + frand01(g) * 0.15f;
+        p->size = (2.1f + frand01(g) * 3.6f) * su;
+        p->spin = frand01(g) * 6.2831853f;
+        p->spin_rate = frands1(g) * 15.0f;
         p->r = 0.35f;
         p->g = 1.0f;
         p->bcol = 0.75f;
         p->a = 0.95f;
+        game_push_particle(g, p);
     }
 }
 
 static int spawn_bullet_single(game_state* g, float y_offset, float muzzle_speed, float dir, float muzzle_offset) {
     const float su = gameplay_ui_scale(g);
     const float vertical_inherit = 0.18f;
-    for (size_t i = 0; i < MAX_BULLETS; ++i) {
-        if (g->bullets[i].active) {
-            continue;
-        }
-        bullet* b = &g->bullets[i];
-        b->active = 1;
-        b->b.x = g->player.b.x + dir * muzzle_offset * su;
-        b->b.y = g->player.b.y + y_offset;
-        b->spawn_x = b->b.x;
-        b->b.vx = dir * muzzle_speed + g->player.b.vx;
-        b->b.vy = g->player.b.vy * vertical_inherit;
-        b->b.ax = 0.0f;
-        b->b.ay = 0.0f;
-        b->ttl_s = 2.0f;
-        return 1;
+    const int i = slot_pool_alloc(&g->bullet_pool, g->caps.bullets);
+    bullet* b;
+    if (i < 0) {
+        return 0;
     }
-    return 0;
+    b = &g->bullets[i];
+    b->active = 1;
+    b->b.x = g->player.b.x + dir * muzzle_offset * su;
+    b->b.y = g->player.b.y + y_offset;
+    b->spawn_x = b->b.x;
+    b->b.vx = dir * muzzle_speed + g->player.b.vx;
+    b->b.vy = g->player.b.vy * vertical_inherit;
+    b->b.ax = 0.0f;
+    b->b.ay = 0.0f;
+    b->ttl_s = 2.0f;
+    return 1;
 }
 
 static void spawn_bullet(game_state* g) {
@@ -2695,23 +3026,22 @@ static enemy_bullet* spawn_enemy_bullet_at(
     float ttl_s,
     float radius
 ) {
-    for (size_t i = 0; i < MAX_ENEMY_BULLETS; ++i) {
-        if (g->enemy_bullets[i].active) {
-            continue;
-        }
-        enemy_bullet* b = &g->enemy_bullets[i];
-        b->active = 1;
-        b->ttl_s = ttl_s;
-        b->radius = radius;
-        b->b.x = ox + dir_x * (radius + 8.0f);
-        b->b.y = oy + dir_y * (radius + 8.0f);
-        b->b.vx = dir_x * speed;
-        b->b.vy = dir_y * speed;
-        b->b.ax = 0.0f;
-        b->b.ay = 0.0f;
-        return b;
+    const int i = slot_pool_alloc(&g->enemy_bullet_pool, g->caps.enemy_bullets);
+    enemy_bullet* b;
+    if (i < 0) {
+        return NULL;
     }
-    return NULL;
+    b = &g->enemy_bullets[i];
+    b->active = 1;
+    b->ttl_s = ttl_s;
+    b->radius = radius;
+    b->b.x = ox + dir_x * (radius + 8.0f);
+    b->b.y = oy + dir_y * (radius + 8.0f);
+    b->b.vx = dir_x * speed;
+    b->b.vy = dir_y * speed;
+    b->b.ax = 0.0f;
+    b->b.ay = 0.0f;
+    return b;
 }
 
 int game_spawn_enemy_bullet(
@@ -2742,8 +3072,28 @@ int game_spawn_enemy_bullet(
     return 1;
 }
 
+static int capacity_or_ceiling(int requested, int ceiling) {
+    return (requested > 0 && requested < ceiling) ? requested : ceiling;
+}
+
 void game_init(game_state* g, float world_w, float world_h) {
+    game_init_with_capacity(g, world_w, world_h, NULL);
+}
+
+void game_init_with_capacity(game_state* g, float world_w, float world_h, const game_capacity* caps) {
+    game_capacity c;
+    memset(&c, 0, sizeof(c));
+    if (caps) {
+        c = *caps;
+    }
     memset(g, 0, sizeof(*g));
+    g->caps.enemies = capacity_or_ceiling(c.enemies, MAX_ENEMIES);
+    g->caps.enemy_bullets = capacity_or_ceiling(c.enemy_bullets, MAX_ENEMY_BULLETS);
+    g->caps.bullets = capacity_or_ceiling(c.bullets, MAX_BULLETS);
+    g->caps.missiles = capacity_or_ceiling(c.missiles, MAX_MISSILES);
+    g->caps.particles = capacity_or_ceiling(c.particles, MAX_PARTICLES);
+    g->caps.debris = capacity_or_ceiling(c.debris, MAX_ENEMY_DEBRIS);
+    g->ai_lod = 1;
     g->world_w = world_w;
     g->world_h = world_h;
     g->lives = 3;
@@ -2783,6 +3133,7 @@ void game_init(game_state* g, float world_w, float world_h) {
     g->orbit_decay_timeout = 0;
     g->wave_index = 0;
     g->wave_id_alloc = 0;
+    g->enemy_serial_alloc = 0u;
     ensure_leveldef_loaded();
     for (int i = 0; i < g_level_count; ++i) {
         if (g_levels[i].style_hint == LEVEL_STYLE_DEFENDER) {
@@ -2792,16 +3143,17 @@ void game_init(game_state* g, float world_w, float world_h) {
     }
     g->level_style = g_levels[g->level_index].style_hint;
     snprintf(g->current_level_name, sizeof(g->current_level_name), "%s", g_levels[g->level_index].name);
+    seed_level_rng(g);
     apply_level_runtime_config(g);
     g->level_time_remaining_s = level_uses_cylinder(g) ? 120.0f : 0.0f;
 
     for (size_t i = 0; i < MAX_STARS; ++i) {
-        g->stars[i].x = frand01() * world_w;
-        g->stars[i].y = frand01() * world_h;
+        g->stars[i].x = frand01(g) * world_w;
+        g->stars[i].y = frand01(g) * world_h;
         g->stars[i].prev_x = g->stars[i].x;
         g->stars[i].prev_y = g->stars[i].y;
-        g->stars[i].speed = 50.0f + frand01() * 190.0f;
-        g->stars[i].size = 0.9f + frand01() * 1.5f;
+        g->stars[i].speed = 50.0f + frand01(g) * 190.0f;
+        g->stars[i].size = 0.9f + frand01(g) * 1.5f;
     }
     game_capture_render_prev_state(g);
 }
@@ -2857,7 +3209,14 @@ static void game_handle_restart(game_state* g, const game_input* in) {
     }
     if (in->restart && g->lives <= 0) {
         const int restart_level_index = g->level_index;
-        game_init(g, g->world_w, g->world_h);
+        const uint32_t rng_seed = g->rng_seed;
+        const game_profile profile = g->profile;
+        const game_capacity caps = g->caps;
+        const int ai_lod = g->ai_lod;
+        game_init_with_capacity(g, g->world_w, g->world_h, &caps);
+        g->ai_lod = ai_lod;
+        g->rng_seed = rng_seed;
+        g->profile = profile;
         if (!set_level_index(g, restart_level_index)) {
             apply_level_runtime_config(g);
         }
@@ -2871,11 +3230,11 @@ static void game_update_stars(game_state* g, float dt) {
         g->stars[i].x -= g->stars[i].speed * dt;
         if (g->stars[i].x < -6.0f) {
             g->stars[i].x = g->world_w + 6.0f;
-            g->stars[i].y = frand01() * g->world_h;
+            g->stars[i].y = frand01(g) * g->world_h;
             g->stars[i].prev_x = g->stars[i].x;
             g->stars[i].prev_y = g->stars[i].y;
-            g->stars[i].speed = 50.0f + frand01() * 190.0f;
-            g->stars[i].size = 0.9f + frand01() * 1.5f;
+            g->stars[i].speed = 50.0f + frand01(g) * 190.0f;
+            g->stars[i].size = 0.9f + frand01(g) * 1.5f;
         }
     }
 }
@@ -2996,16 +3355,13 @@ static void game_update_powerups(game_state* g, float dt) {
     const float su = gameplay_ui_scale(g);
     const int uses_cylinder = level_uses_cylinder(g);
     const float period = cylinder_period(g);
-    for (int i = 0; i < MAX_POWERUPS; ++i) {
+    for (int i = slot_pool_next(&g->powerup_pool, 0); i >= 0; i = slot_pool_next(&g->powerup_pool, i + 1)) {
         powerup_pickup* p = &g->powerups[i];
         float px;
         float py;
         float dx;
         float dy;
         float rr;
-        if (!p->active) {
-            continue;
-        }
         p->ttl_s -= dt;
         if (p->ttl_s <= 0.0f) {
             kill_powerup_pickup(g, p);
@@ -3063,30 +3419,104 @@ static void game_update_powerups(game_state* g, float dt) {
 
 static void game_update_player_bullets(game_state* g, float dt) {
     const float su = gameplay_ui_scale(g);
-    for (size_t i = 0; i < MAX_BULLETS; ++i) {
-        if (!g->bullets[i].active) {
-            continue;
-        }
-        bullet* b = &g->bullets[i];
-        const float prev_x = b->b.x;
-        const float prev_y = b->b.y;
-        integrate_body(&b->b, dt);
+    int live[MAX_BULLETS];
+    float prev_x[MAX_BULLETS];
+    float prev_y[MAX_BULLETS];
+    game_segment_query sweep[MAX_BULLETS];
+    uint8_t blocked[MAX_BULLETS];
+    const int live_n = slot_pool_collect(&g->bullet_pool, live, MAX_BULLETS);
+    body_batch_integrate(&g->bullets[0].b, sizeof(g->bullets[0]), live, NULL, live_n, dt, prev_x, prev_y);
+    if (live_n > 0 && !level_uses_cylinder(g)) {
+        for (int k = 0; k < live_n; ++k) {
+            const bullet* b = &g->bullets[live[k]];
+            sweep[k].x0 = prev_x[k];
+            sweep[k].y0 = prev_y[k];
+            sweep[k].x1 = b->b.x;
+            sweep[k].y1 = b->b.y;
+            sweep[k].pad_radius = 2.4f * su;
+        }
+        game_structure_segments_blocked(g, sweep, live_n, blocked);
+    }
+    for (int k = 0; k < live_n; ++k) {
+        bullet* b = &g->bullets[live[k]];
         b->ttl_s -= dt;
         if (level_uses_cylinder(g)) {
             const float period = cylinder_period(g);
             const float travel = fabsf(wrap_delta(b->b.x, b->spawn_x, period));
             if (b->ttl_s <= 0.0f || travel >= period * (1.0f / 3.0f)) {
-                b->active = 0;
+                kill_bullet(g, b);
             }
             continue;
         }
-        if (game_structure_segment_blocked(g, prev_x, prev_y, b->b.x, b->b.y, 2.4f * su)) {
-            b->active = 0;
+        if (blocked[k]) {
+            kill_bullet(g, b);
             continue;
         }
         if (b->ttl_s <= 0.0f || fabsf(b->b.x - g->camera_x) > g->world_w * 1.2f) {
-            b->active = 0;
+            kill_bullet(g, b);
+        }
+    }
+}
+
+/*
+ * Spawns every unspawned curated entry inside the activation window. Entries
+ * only move between the two heaps as the window passes them, so the camera
+ * can drift back and still pick up anything it left behind.
+ */
+static void game_update_curated_spawning(game_state* g, const leveldef_level* lvl) {
+    const float activate_min_x = g->camera_x + g->world_w * 0.05f;
+    const float activate_x = g->camera_x + g->world_w * 1.18f;
+    int due[MAX_CURATED_RUNTIME];
+    int due_n = 0;
+    while (g->curated_ahead_count > 0) {
+        const int i = g->curated_ahead[0];
+        const float world_x = lvl->curated[i].x01 * g->world_w;
+        if (world_x > activate_x) {
+            break;
+        }
+        curated_heap_pop(lvl, g->curated_ahead, &g->curated_ahead_count, 0);
+        if (world_x >= activate_min_x) {
+            due[due_n++] = i;
+        } else {
+            curated_heap_push(lvl, g->curated_behind, &g->curated_behind_count, i, 1);
+        }
+    }
+    while (g->curated_behind_count > 0) {
+        const int i = g->curated_behind[0];
+        const float world_x = lvl->curated[i].x01 * g->world_w;
+        if (world_x < activate_min_x) {
+            break;
+        }
+        curated_heap_pop(lvl, g->curated_behind, &g->curated_behind_count, 1);
+        if (world_x <= activate_x) {
+            due[due_n++] = i;
+        } else {
+            curated_heap_push(lvl, g->curated_ahead, &g->curated_ahead_count, i, 0);
+        }
+    }
+    /* File order, so wave ids and RNG draws match a scan of curated[]. */
+    for (int k = 1; k < due_n; ++k) {
+        const int v = due[k];
+        int j = k;
+        while (j > 0 && due[j - 1] > v) {
+            due[j] = due[j - 1];
+            j -= 1;
         }
+        due[j] = v;
+    }
+    for (int k = 0; k < due_n; ++k) {
+        const int wave_id = ++g->wave_id_alloc;
+        enemy_spawn_curated_enemy(
+            g,
+            &g_leveldef,
+            lvl,
+            wave_id,
+            &lvl->curated[due[k]],
+            gameplay_ui_scale(g),
+            level_uses_cylinder(g),
+            cylinder_period(g)
+        );
+        g->curated_spawned_count += 1;
     }
 }
 
@@ -3102,30 +3532,7 @@ static void game_update_wave_spawning(game_state* g, float dt) {
         if (boss_any_controller_alive(g)) {
             return;
         }
-        const float activate_min_x = g->camera_x + g->world_w * 0.05f;
-        const float activate_x = g->camera_x + g->world_w * 1.18f;
-        for (int i = 0; i < lvl->curated_count && i < MAX_CURATED_RUNTIME; ++i) {
-            const leveldef_curated_enemy* ce = &lvl->curated[i];
-            const float world_x = ce->x01 * g->world_w;
-            if (g->curated_spawned[i]) {
-                continue;
-            }
-            if (world_x >= activate_min_x && world_x <= activate_x) {
-                const int wave_id = ++g->wave_id_alloc;
-                enemy_spawn_curated_enemy(
-                    g,
-                    &g_leveldef,
-                    lvl,
-                    wave_id,
-                    ce,
-                    gameplay_ui_scale(g),
-                    level_uses_cylinder(g),
-                    cylinder_period(g)
-                );
-                g->curated_spawned[i] = 1u;
-                g->curated_spawned_count += 1;
-            }
-        }
+        game_update_curated_spawning(g, lvl);
         return;
     }
     if (boss_any_controller_alive(g)) {
@@ -3268,34 +3675,32 @@ static void game_update_wave_spawning(game_state* g, float dt) {
 }
 
 static void game_update_particles(game_state* g, float dt) {
+    particle_store* ps = &g->particles;
     const int uses_cylinder = level_uses_cylinder(g);
     const float period = uses_cylinder ? cylinder_period(g) : 0.0f;
-    for (size_t i = 0; i < MAX_PARTICLES; ++i) {
-        particle* p = &g->particles[i];
-        if (!p->active) {
-            continue;
-        }
-        p->age_s += dt;
-        if (p->age_s >= p->life_s) {
-            kill_particle(g, p);
+    particle_store_integrate(ps, dt);
+    for (int i = 0; i < ps->count;) {
+        const float age_s = ps->age_s[i];
+        const float life_s = ps->life_s[i];
+        if (age_s >= life_s) {
+            particle_store_remove(ps, i);
             continue;
         }
-        p->spin += p->spin_rate * dt;
-        integrate_body(&p->b, dt);
         if (uses_cylinder) {
-            p->b.x = g->camera_x + wrap_delta(p->b.x, g->camera_x, period);
+            ps->x[i] = g->camera_x + wrap_delta(ps->x[i], g->camera_x, period);
         }
         {
-            const float t01 = p->age_s / p->life_s;
+            const float t01 = age_s / life_s;
             const float inv = 1.0f - t01;
-            if (p->type == PARTICLE_FLASH) {
-                p->a = inv * inv * inv;
-            } else if (p->life_s > 0.30f) {
-                p->a = powf(inv, 1.35f);
+            if (ps->type[i] == PARTICLE_FLASH) {
+                ps->a[i] = inv * inv * inv;
+            } else if (life_s > 0.30f) {
+                ps->a[i] = powf(inv, 1.35f);
             } else {
-                p->a = inv * inv;
+                ps->a[i] = inv * inv;
             }
         }
+        ++i;
     }
 }
 
@@ -3325,6 +3730,8 @@ static void game_update_camera(game_state* g, float dt) {
 }
 
 void game_update(game_state* g, float dt, const game_input* in) {
+    game_profile* prof = &g->profile;
+    game_profile_begin_tick(prof);
     g->t += dt;
     const float su = gameplay_ui_scale(g);
     game_capture_render_prev_state(g);
@@ -3337,31 +3744,46 @@ void game_update(game_state* g, float dt, const game_input* in) {
             g->level_time_remaining_s = 0.0f;
             g->orbit_decay_timeout = 1;
             game_set_player_dead(g, 0);
+            game_profile_mark(prof, GAME_PROFILE_PLAYER);
             return;
         }
     }
     if (game_update_player(g, dt, in, su)) {
+        game_profile_mark(prof, GAME_PROFILE_PLAYER);
         return;
     }
+    game_profile_mark(prof, GAME_PROFILE_PLAYER);
     game_update_powerups(g, dt);
+    game_profile_mark(prof, GAME_PROFILE_POWERUPS);
     game_update_player_weapons(g, dt, in);
+    game_profile_mark(prof, GAME_PROFILE_WEAPONS);
     game_update_player_bullets(g, dt);
+    game_profile_mark(prof, GAME_PROFILE_BULLETS);
     game_update_wave_spawning(g, dt);
+    game_profile_mark(prof, GAME_PROFILE_WAVES);
     update_asteroid_storm(g, dt);
+    game_profile_mark(prof, GAME_PROFILE_ASTEROIDS);
     if (g->searchlight_count > 0) {
         update_searchlights(g, dt);
     }
+    game_profile_mark(prof, GAME_PROFILE_SEARCHLIGHTS);
     g->lightning_active = 0;
     g->lightning_audio_gain = 0.0f;
     g->lightning_audio_pan = 0.0f;
     if (g->arc_node_count > 1) {
         update_arc_nodes(g, dt);
     }
+    game_profile_mark(prof, GAME_PROFILE_ARC_NODES);
     enemy_update_system(g, &g_leveldef, dt, su, level_uses_cylinder(g), cylinder_period(g));
+    game_profile_mark(prof, GAME_PROFILE_ENEMIES);
     update_minefields(g, dt);
+    game_profile_mark(prof, GAME_PROFILE_MINES);
     update_missile_system(g, dt);
+    game_profile_mark(prof, GAME_PROFILE_MISSILES);
     game_update_particles(g, dt);
+    game_profile_mark(prof, GAME_PROFILE_PARTICLES);
     game_update_camera(g, dt);
+    game_profile_mark(prof, GAME_PROFILE_CAMERA);
 }
 
 int game_enemy_count(const game_state* g) {
@@ -3447,6 +3869,14 @@ const char* game_current_level_name(const game_state* g) {
     return "";
 }
 
+void game_set_rng_seed(game_state* g, uint32_t seed) {
+    if (!g) {
+        return;
+    }
+    g->rng_seed = seed;
+    seed_level_rng(g);
+}
+
 int game_set_level_by_name(game_state* g, const char* name) {
     if (!g || !name || !name[0]) {
         return 0;
@@ -3515,10 +3945,18 @@ int game_apply_level_override(game_state* g, const struct leveldef_level* level,
     if (g_levels[g->level_index].name[0] != '\0') {
         snprintf(g->current_level_name, sizeof(g->current_level_name), "%s", g_levels[g->level_index].name);
     }
+    seed_level_rng(g);
     apply_level_runtime_config(g);
     return 1;
 }
 
+void game_set_ai_lod(game_state* g, int enabled) {
+    if (!g) {
+        return;
+    }
+    g->ai_lod = enabled ? 1 : 0;
+}
+
 void game_set_alt_weapon(game_state* g, int weapon_id) {
     if (!g) {
         return;
@@ -1,32 +1,63 @@
 #ifndef V_TYPE_GAME_H
 #define V_TYPE_GAME_H
 
+#include "game_profile.h"
+#include "particle_store.h"
+#include "slot_pool.h"
+#include "spatial_hash.h"
+#include "structure_index.h"
+
 #include <stddef.h>
 #include <stdint.h>
 
+/*
+ * Ceilings for the entity arrays baked into game_state. The pooled ones can
+ * be raised with -D for stress builds (see vs_headless_stress in
+ * CMakeLists.txt); game_capacity picks the live limit below each at game_init.
+ */
 #define MAX_STARS 64
+#ifndef MAX_BULLETS
 #define MAX_BULLETS 128
+#endif
+#ifndef MAX_ENEMY_BULLETS
 #define MAX_ENEMY_BULLETS 512
+#endif
+#ifndef MAX_ENEMIES
 #define MAX_ENEMIES 64
-#define MAX_PARTICLES 1024
+#endif
+#define MAX_PARTICLES PARTICLE_STORE_CAP
+#ifndef MAX_ENEMY_DEBRIS
 #define MAX_ENEMY_DEBRIS 512
+#endif
 #define MAX_AUDIO_EVENTS 256
 #define MAX_SEARCHLIGHTS 4
-#define MAX_CURATED_RUNTIME 128
+#define MAX_CURATED_RUNTIME 256
 #define MAX_ASTEROIDS 192
 #define ASTEROID_EMITTERS 64
 #define MAX_MINES 256
 #define MAX_MISSILE_LAUNCHERS 64
+#ifndef MAX_MISSILES
 #define MAX_MISSILES 256
+#endif
 #define MAX_ARC_NODES 64
 #define MAX_POWERUPS 64
 #define MAX_EEL_ARCS 384
 #define EEL_ARC_MAX_POINTS 10
 #define EEL_SPINE_POINTS 28
+#define BOSS_MAX_PARTS 16
 #define EEL_ARC_PULSE_PERIOD_S 0.60f
 #define EEL_ARC_PULSE_ON_S 0.20f
+#define EEL_ARC_JITTER_INTERVAL_S (1.0f / 30.0f)
 #define PLAYER_ALT_WEAPON_COUNT 4
 
+#if MAX_BULLETS > SLOT_POOL_MAX_SLOTS || MAX_ENEMY_BULLETS > SLOT_POOL_MAX_SLOTS || \
+    MAX_ENEMY_DEBRIS > SLOT_POOL_MAX_SLOTS || MAX_MISSILES > SLOT_POOL_MAX_SLOTS || MAX_EEL_ARCS > SLOT_POOL_MAX_SLOTS
+#error "SLOT_POOL_MAX_SLOTS must cover every pooled array"
+#endif
+#if MAX_ENEMIES > SPATIAL_HASH_CAP || MAX_BULLETS > SPATIAL_HASH_CAP
+#error "SPATIAL_HASH_CAP must cover the enemy and bullet hashes"
+#endif
+
 struct leveldef_db;
 struct leveldef_level;
 
@@ -146,6 +177,7 @@ typedef struct enemy {
     int state;
     int wave_id;
     int slot_index;
+    uint32_t serial; /* Unique per spawn, so a reused slot is not mistaken for the enemy it held. */
     float ai_timer_s;
     float break_delay_s;
     float max_speed;
@@ -212,11 +244,19 @@ typedef struct enemy {
     float eel_weapon_fire_rate;
     float eel_weapon_duration_s;
     float eel_weapon_damage_interval_s;
-    int eel_spine_count;
-    float eel_spine_x[EEL_SPINE_POINTS];
-    float eel_spine_y[EEL_SPINE_POINTS];
 } enemy;
 
+/*
+ * Eel body points live beside `enemy` (indexed by enemy slot) rather than in
+ * it: they are most of an eel's bytes, and every other enemy loop would
+ * otherwise stream them through the cache.
+ */
+typedef struct enemy_eel_spine {
+    int count; /* 0 unless the enemy is an eel */
+    float x[EEL_SPINE_POINTS];
+    float y[EEL_SPINE_POINTS];
+} enemy_eel_spine;
+
 typedef struct enemy_bullet {
     int active;
     body b;
@@ -297,8 +337,8 @@ typedef enum particle_type {
     PARTICLE_FLASH = 2
 } particle_type;
 
+/* Spawn record; live particles are kept column-wise in game_state.particles. */
 typedef struct particle {
-    int active;
     particle_type type;
     body b;
     float age_s;
@@ -389,6 +429,8 @@ typedef struct homing_missile {
     float forward_y;
     float trail_emit_accum;
     int style; /* enum missile_style_id */
+    int target_index; /* Enemy slot a player missile is locked on, or -1. */
+    uint32_t target_serial;
 } homing_missile;
 
 typedef enum powerup_type {
@@ -434,6 +476,10 @@ typedef struct eel_arc_effect {
     int point_count;
     float point_x[EEL_ARC_MAX_POINTS];
     float point_y[EEL_ARC_MAX_POINTS];
+    /* Jag offsets sampled at jitter keys jag_key and jag_key + 1; points blend between them. */
+    int jag_key;
+    float jag_a[EEL_ARC_MAX_POINTS];
+    float jag_b[EEL_ARC_MAX_POINTS];
 } eel_arc_effect;
 
 typedef struct arc_node_runtime {
@@ -451,6 +497,17 @@ typedef struct arc_node_runtime {
     int energized_prev;
 } arc_node_runtime;
 
+/* A node pair that can carry a beam, with its segment cached at level load. */
+typedef struct arc_node_pair {
+    int a;
+    int b;
+    float ab_x;
+    float ab_y;
+    float len_sq;
+    float mid_x;
+    float mid_y;
+} arc_node_pair;
+
 typedef struct boss_enemy_attachment {
     int active;
     int owner_index;
@@ -504,8 +561,17 @@ typedef struct boss_controller_runtime {
     float movement_target_y;
     float destruction_time_s;
     float detonation_timer_s;
+    /* Slots attached to this controller, ascending; stale entries are pruned each tick. */
+    int part_count;
+    int16_t part_slots[BOSS_MAX_PARTS];
 } boss_controller_runtime;
 
+/* PCG32; one stream per game_state so ticks replay bit-identically. */
+typedef struct game_rng {
+    uint64_t state;
+    uint64_t inc;
+} game_rng;
+
 typedef struct game_input {
     int left;
     int right;
@@ -516,10 +582,43 @@ typedef struct game_input {
     int restart;
 } game_input;
 
+/*
+ * Previous-tick poses for render interpolation. Only the fields render.c
+ * blends are captured, and only for live slots; bullet and missile
+ * liveness comes from the prev_*_pool copies in game_state.
+ */
+typedef struct render_pose {
+    float x;
+    float y;
+    float facing_x;
+    float facing_y;
+} render_pose;
+
+typedef struct render_enemy_prev {
+    int active;
+    render_pose pose;
+} render_enemy_prev;
+
+/*
+ * Live entity limits for one game_state. A zero (or anything above the
+ * matching MAX_* ceiling) means "use the ceiling", so a zeroed config keeps
+ * the shipping caps.
+ */
+typedef struct game_capacity {
+    int enemies;
+    int enemy_bullets;
+    int bullets;
+    int missiles;
+    int particles;
+    int debris;
+} game_capacity;
+
 typedef struct game_state {
     float world_w;
     float world_h;
     float t;
+    uint32_t rng_seed; /* Base seed mixed with the level name on every level apply. */
+    game_rng rng;
     int lives;
     int kills;
     int score;
@@ -529,14 +628,24 @@ typedef struct game_state {
     float wave_cooldown_s;
     int wave_index;
     int wave_id_alloc;
+    uint32_t enemy_serial_alloc;
     int curated_spawned_count;
-    uint8_t curated_spawned[MAX_CURATED_RUNTIME];
+    /*
+     * Curated entries sorted by x when the level is applied. Unspawned ones
+     * wait in a heap ahead of the activation window (nearest on top) or
+     * behind it (farthest on top), so a tick only pops entries entering it.
+     */
+    int curated_schedule_count;
+    int16_t curated_schedule[MAX_CURATED_RUNTIME];
+    int curated_ahead_count;
+    int16_t curated_ahead[MAX_CURATED_RUNTIME];
+    int curated_behind_count;
+    int16_t curated_behind[MAX_CURATED_RUNTIME];
     int wave_announce_pending;
     int fire_sfx_pending;
     char wave_announce_text[160];
     float weapon_heat;
     int weapon_level;
-    int active_particles;
     int audio_event_count;
     float thruster_emit_accum;
     float camera_x;
@@ -552,16 +661,20 @@ typedef struct game_state {
     int orbit_decay_timeout;
     int render_style; /* enum level_render_style_id */
     int level_theme_palette; /* 0=green,1=amber,2=ice from level config */
+    game_capacity caps; /* Set by game_init_with_capacity; survives restarts. */
+    int ai_lod; /* Reduced AI cadence for far off-screen enemies; on by default, survives restarts. */
     player_state player;
-    player_state prev_player;
+    render_pose prev_player;
     star stars[MAX_STARS];
     bullet bullets[MAX_BULLETS];
-    bullet prev_bullets[MAX_BULLETS];
+    render_pose prev_bullets[MAX_BULLETS];
     enemy_bullet enemy_bullets[MAX_ENEMY_BULLETS];
-    enemy_bullet prev_enemy_bullets[MAX_ENEMY_BULLETS];
+    render_pose prev_enemy_bullets[MAX_ENEMY_BULLETS];
     enemy enemies[MAX_ENEMIES];
-    enemy prev_enemies[MAX_ENEMIES];
-    particle particles[MAX_PARTICLES];
+    render_enemy_prev prev_enemies[MAX_ENEMIES];
+    enemy_eel_spine eel_spines[MAX_ENEMIES];
+    enemy_eel_spine prev_eel_spines[MAX_ENEMIES];
+    particle_store particles;
     enemy_debris debris[MAX_ENEMY_DEBRIS];
     game_audio_event audio_events[MAX_AUDIO_EVENTS];
     searchlight searchlights[MAX_SEARCHLIGHTS];
@@ -592,16 +705,40 @@ typedef struct game_state {
     missile_launcher missile_launchers[MAX_MISSILE_LAUNCHERS];
     int missile_launcher_count;
     homing_missile missiles[MAX_MISSILES];
-    homing_missile prev_missiles[MAX_MISSILES];
+    render_pose prev_missiles[MAX_MISSILES];
+    float prev_missile_heading[MAX_MISSILES];
     int missile_count;
     arc_node_runtime arc_nodes[MAX_ARC_NODES];
     int arc_node_count;
+    arc_node_pair arc_pairs[MAX_ARC_NODES / 2];
+    int arc_pair_count;
     powerup_pickup powerups[MAX_POWERUPS];
     int powerup_count;
     eel_arc_effect eel_arcs[MAX_EEL_ARCS];
     int eel_arc_count;
     boss_enemy_attachment boss_attachments[MAX_ENEMIES];
     boss_controller_runtime boss_controllers[MAX_ENEMIES];
+    /* Live slots of the entity arrays above; kept in step with each entry's active flag. */
+    slot_pool bullet_pool;
+    slot_pool enemy_bullet_pool;
+    slot_pool debris_pool;
+    slot_pool missile_pool;
+    slot_pool mine_pool;
+    slot_pool powerup_pool;
+    slot_pool eel_arc_pool;
+    /* Live bullet and missile slots as of the last render capture. */
+    slot_pool prev_bullet_pool;
+    slot_pool prev_enemy_bullet_pool;
+    slot_pool prev_missile_pool;
+    spatial_hash enemy_hash; /* Rebuilt by enemy_update_system after movement; valid until the next tick. */
+    spatial_hash bullet_hash;
+    spatial_hash swarm_hash; /* Swarm members as of the start of enemy_update_system. */
+    int swarm_hash_valid;
+    structure_index structure_index; /* Blocking structures, rebuilt when the level is applied. */
+    structure_index enemy_structure_index; /* Same set with enemy.c's taller grid rows. */
+    structure_field structure_field; /* Distance to structure_index boxes; answers most overlap tests. */
+    uint32_t enemy_lod_tick;
+    float enemy_lod_debt_s[MAX_ENEMIES]; /* AI time owed to enemies the LOD skipped. */
     int powerup_magnet_active;
     float powerup_drop_credit; /* Smooths drop cadence while preserving average drop chance. */
     int exit_portal_active;
@@ -628,11 +765,17 @@ typedef struct game_state {
     float emp_blast_radius;
     int alt_weapon_equipped; /* enum player_alt_weapon_id */
     int alt_weapon_ammo[PLAYER_ALT_WEAPON_COUNT];
+    game_profile profile; /* Subsystem timing, not simulation state: survives restarts, skipped by snapshots. */
 } game_state;
 
 void game_init(game_state* g, float world_w, float world_h);
+void game_init_with_capacity(game_state* g, float world_w, float world_h, const game_capacity* caps);
 void game_set_world_size(game_state* g, float world_w, float world_h);
 void game_update(game_state* g, float dt, const game_input* in);
+void game_set_rng_seed(game_state* g, uint32_t seed);
+void game_rng_seed(game_rng* rng, uint64_t seed);
+uint32_t game_rng_next_u32(game_rng* rng);
+float game_rng_float01(game_rng* rng);
 void game_cycle_level(game_state* g);
 int game_enemy_count(const game_state* g);
 float game_player_speed01(const game_state* g);
@@ -647,11 +790,15 @@ const char* game_current_level_name(const game_state* g);
 int game_set_level_by_name(game_state* g, const char* name);
 int game_refresh_levels(game_state* g);
 int game_apply_level_override(game_state* g, const struct leveldef_level* level, const char* level_name);
+/* Rebuilds the structure indexes and distance field from the current level; snapshots leave them out. */
+void game_rebuild_structure_caches(game_state* g);
 void game_set_alt_weapon(game_state* g, int weapon_id);
+void game_set_ai_lod(game_state* g, int enabled);
 int game_get_alt_weapon(const game_state* g);
 int game_get_alt_weapon_ammo(const game_state* g, int weapon_id);
 void game_on_enemy_destroyed(game_state* g, float x, float y, float vx, float vy, int score_delta);
 void game_on_player_life_lost(game_state* g);
+void game_push_particle(game_state* g, const particle* p);
 int game_structure_circle_overlap(const game_state* g, float x, float y, float radius);
 int game_find_noncolliding_spawn(
     const game_state* g,
@@ -672,6 +819,20 @@ void game_structure_avoidance_vector(
 );
 int game_line_of_sight_clear(const game_state* g, float x0, float y0, float x1, float y1, float radius);
 int game_structure_segment_blocked(const game_state* g, float x0, float y0, float x1, float y1, float pad_radius);
+
+typedef struct game_segment_query {
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    float pad_radius;
+} game_segment_query;
+
+/*
+ * out_blocked[k] = game_structure_segment_blocked for q[k]. Queries sharing a
+ * structure index column are resolved together from one read of that column.
+ */
+void game_structure_segments_blocked(const game_state* g, const game_segment_query* q, int n, uint8_t* out_blocked);
 int game_spawn_enemy_bullet(
     game_state* g,
     float x,
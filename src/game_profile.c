@@ -0,0 +1,130 @@
+#include "game_profile.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static const char* const k_section_names[GAME_PROFILE_SECTION_COUNT + 1] = {
+    "player",
+    "powerups",
+    "weapons",
+    "bullets",
+    "waves",
+    "asteroids",
+    "searchlights",
+    "arc_nodes",
+    "enemies",
+    "mines",
+    "missiles",
+    "particles",
+    "camera",
+    "tick"
+};
+
+/* timespec_get is plain C11; TIME_UTC has ns resolution on the platforms we ship. */
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    if (timespec_get(&ts, TIME_UTC) != TIME_UTC) {
+        return 0u;
+    }
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static float row_value(const game_profile* p, int row, int section) {
+    if (section == GAME_PROFILE_TICK) {
+        float sum = 0.0f;
+        for (int s = 0; s < GAME_PROFILE_SECTION_COUNT; ++s) {
+            sum += p->us[row][s];
+        }
+        return sum;
+    }
+    return p->us[row][section];
+}
+
+static int cmp_float(const void* a, const void* b) {
+    const float fa = *(const float*)a;
+    const float fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+void game_profile_set_enabled(game_profile* p, int enabled) {
+    if (!p) {
+        return;
+    }
+    enabled = enabled ? 1 : 0;
+    if (enabled && !p->enabled) {
+        p->count = 0;
+        p->head = 0;
+    }
+    p->enabled = enabled;
+}
+
+void game_profile_begin_tick(game_profile* p) {
+    if (!p || !p->enabled) {
+        return;
+    }
+    p->head = (p->head + 1) % GAME_PROFILE_RING;
+    if (p->count < GAME_PROFILE_RING) {
+        p->count += 1;
+    }
+    memset(p->us[p->head], 0, sizeof(p->us[p->head]));
+    p->mark_ns = now_ns();
+}
+
+/* Charges the time since the previous mark (or the start of the tick) to section. */
+void game_profile_mark(game_profile* p, int section) {
+    uint64_t t;
+    if (!p || !p->enabled || p->count <= 0 || section < 0 || section >= GAME_PROFILE_SECTION_COUNT) {
+        return;
+    }
+    t = now_ns();
+    p->us[p->head][section] += (float)(t - p->mark_ns) * 0.001f;
+    p->mark_ns = t;
+}
+
+int game_profile_get_stats(const game_profile* p, int section, game_profile_stats* out) {
+    float v[GAME_PROFILE_RING];
+    double sum = 0.0;
+    int n;
+    if (!out) {
+        return 0;
+    }
+    memset(out, 0, sizeof(*out));
+    if (!p || p->count <= 0 || section < 0 || section > GAME_PROFILE_TICK) {
+        return 0;
+    }
+    n = p->count;
+    for (int i = 0; i < n; ++i) {
+        const int row = (p->head - i + GAME_PROFILE_RING) % GAME_PROFILE_RING;
+        v[i] = row_value(p, row, section);
+        sum += (double)v[i];
+    }
+    qsort(v, (size_t)n, sizeof(v[0]), cmp_float);
+    out->samples = n;
+    out->min_us = v[0];
+    out->max_us = v[n - 1];
+    out->avg_us = (float)(sum / (double)n);
+    out->p99_us = v[(n * 99 + 99) / 100 - 1];
+    return 1;
+}
+
+float game_profile_recent_us(const game_profile* p, int section, int ticks) {
+    float sum = 0.0f;
+    if (!p || section < 0 || section > GAME_PROFILE_TICK) {
+        return 0.0f;
+    }
+    if (ticks > p->count) {
+        ticks = p->count;
+    }
+    for (int i = 0; i < ticks; ++i) {
+        sum += row_value(p, (p->head - i + GAME_PROFILE_RING) % GAME_PROFILE_RING, section);
+    }
+    return sum;
+}
+
+const char* game_profile_section_name(int section) {
+    if (section < 0 || section > GAME_PROFILE_TICK) {
+        return "";
+    }
+    return k_section_names[section];
+}
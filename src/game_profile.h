@@ -0,0 +1,57 @@
+#ifndef V_TYPE_GAME_PROFILE_H
+#define V_TYPE_GAME_PROFILE_H
+
+#include <stdint.h>
+
+#define GAME_PROFILE_RING 512 /* Ticks kept: a little over 4 s at 120 Hz. */
+
+enum game_profile_section {
+    GAME_PROFILE_PLAYER = 0, /* Render capture, restart, stars, orbit timer and the ship itself. */
+    GAME_PROFILE_POWERUPS,
+    GAME_PROFILE_WEAPONS,
+    GAME_PROFILE_BULLETS,
+    GAME_PROFILE_WAVES,
+    GAME_PROFILE_ASTEROIDS,
+    GAME_PROFILE_SEARCHLIGHTS,
+    GAME_PROFILE_ARC_NODES,
+    GAME_PROFILE_ENEMIES,
+    GAME_PROFILE_MINES,
+    GAME_PROFILE_MISSILES,
+    GAME_PROFILE_PARTICLES,
+    GAME_PROFILE_CAMERA,
+    GAME_PROFILE_SECTION_COUNT,
+    GAME_PROFILE_TICK = GAME_PROFILE_SECTION_COUNT /* Stats only: sum of all sections. */
+};
+
+/*
+ * Per-subsystem wall time of recent game_update calls, one row per tick.
+ * Off by default; when off, the marks are a flag test. A tick that returns
+ * early leaves its remaining sections at zero.
+ */
+typedef struct game_profile {
+    int enabled;
+    int count;
+    int head; /* Row of the newest tick. */
+    uint64_t mark_ns;
+    float us[GAME_PROFILE_RING][GAME_PROFILE_SECTION_COUNT];
+} game_profile;
+
+typedef struct game_profile_stats {
+    int samples;
+    float min_us;
+    float avg_us;
+    float max_us;
+    float p99_us;
+} game_profile_stats;
+
+void game_profile_set_enabled(game_profile* p, int enabled);
+void game_profile_begin_tick(game_profile* p);
+void game_profile_mark(game_profile* p, int section);
+
+/* Stats over the whole ring; section may be GAME_PROFILE_TICK. Returns 0 when nothing was recorded. */
+int game_profile_get_stats(const game_profile* p, int section, game_profile_stats* out);
+/* Summed time of the newest `ticks` rows, e.g. the ticks run since the last frame. */
+float game_profile_recent_us(const game_profile* p, int section, int ticks);
+const char* game_profile_section_name(int section);
+
+#endif
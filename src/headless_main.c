@@ -0,0 +1,528 @@
+#include "enemy.h"
+#include "game.h"
+#include "leveldef.h"
+#include "replay.h"
+#include "sim_script.h"
+#include "snapshot.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define HEADLESS_MAX_LEVELS LEVELDEF_MAX_DISCOVERED_LEVELS
+#define HEADLESS_LEVEL_NAME_CAP 64
+
+enum headless_script {
+    HEADLESS_SCRIPT_SWEEP = 0,
+    HEADLESS_SCRIPT_IDLE = 1
+};
+
+typedef struct headless_options {
+    const char* level_name;
+    const char* level_file;
+    int all_levels;
+    int ticks;
+    float world_w;
+    float world_h;
+    int script;
+    uint32_t seed;
+    const char* record_path;
+    const char* replay_path;
+    int rollback_ticks;
+    int profile;
+    int schedule;
+    int no_ai_lod;
+    int threads;
+    game_capacity caps;
+} headless_options;
+
+typedef struct headless_result {
+    int ticks;
+    double wall_ms;
+    double max_tick_us;
+    int restarts;
+    int level_changes;
+    int rollbacks;
+    int rollback_mismatches;
+    int peak_enemies;
+    int peak_enemy_bullets;
+} headless_result;
+
+static const float k_sim_fixed_dt_s = 1.0f / 120.0f;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1.0e-9;
+}
+
+static void usage(const char* argv0) {
+    fprintf(
+        stderr,
+        "usage: %s [--level NAME | --level-file FILE | --all] [--ticks N] [--size WxH] [--script sweep|idle] [--seed N]\n"
+        "       [--record FILE] [--rollback-check N] [--profile] [--schedule] [--no-ai-lod] [--threads N]\n"
+        "       [--caps KEY=N,...]\n"
+        "       %s --replay FILE\n"
+        "  Runs game_update at a fixed 1/120 s step without SDL/Vulkan and reports ticks per second.\n"
+        "  --profile prints per-subsystem tick times (min/avg/p99/max us over the last 512 ticks).\n"
+        "  --schedule prints the level's curated spawns in trigger order and its event lane before running.\n"
+        "  --rollback-check N rewinds N ticks every 5 s, re-simulates and checks the state matches.\n"
+        "  --no-ai-lod runs far off-screen enemies' AI every tick, for comparison runs.\n"
+        "  --threads N adds N helper threads to the enemy update; results do not depend on N.\n"
+        "  --caps sets live entity limits (enemies, enemy_bullets, bullets, missiles, particles, debris) up to the build's MAX_*.\n",
+        argv0,
+        argv0
+    );
+}
+
+/* "enemies=2000,enemy_bullets=5000": unknown keys or bad numbers fail the parse. */
+static int parse_caps(const char* spec, game_capacity* caps) {
+    static const char* const k_names[] = {"enemies", "enemy_bullets", "bullets", "missiles", "particles", "debris"};
+    int* const fields[] = {
+        &caps->enemies, &caps->enemy_bullets, &caps->bullets, &caps->missiles, &caps->particles, &caps->debris
+    };
+    const char* p = spec;
+    while (p && *p) {
+        const char* eq = strchr(p, '=');
+        const char* end = strchr(p, ',');
+        char* num_end = NULL;
+        long v;
+        int found = 0;
+        if (!eq || (end && end < eq)) {
+            return 0;
+        }
+        v = strtol(eq + 1, &num_end, 10);
+        if (num_end == eq + 1 || v <= 0 || v > INT_MAX || (*num_end != '\0' && *num_end != ',')) {
+            return 0;
+        }
+        for (size_t i = 0; i < sizeof(k_names) / sizeof(k_names[0]); ++i) {
+            if (strlen(k_names[i]) == (size_t)(eq - p) && strncmp(k_names[i], p, (size_t)(eq - p)) == 0) {
+                *fields[i] = (int)v;
+                found = 1;
+            }
+        }
+        if (!found) {
+            return 0;
+        }
+        p = end ? end + 1 : NULL;
+    }
+    return 1;
+}
+
+static int parse_options(int argc, char** argv, headless_options* o) {
+    o->level_name = NULL;
+    o->level_file = NULL;
+    o->all_levels = 0;
+    o->ticks = 120 * 60;
+    o->world_w = 1920.0f;
+    o->world_h = 1080.0f;
+    o->script = HEADLESS_SCRIPT_SWEEP;
+    o->seed = 0u;
+    o->record_path = NULL;
+    o->replay_path = NULL;
+    o->rollback_ticks = 0;
+    o->profile = 0;
+    o->schedule = 0;
+    o->no_ai_lod = 0;
+    o->threads = 0;
+    memset(&o->caps, 0, sizeof(o->caps));
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--all") == 0) {
+            o->all_levels = 1;
+        } else if (strcmp(arg, "--profile") == 0) {
+            o->profile = 1;
+        } else if (strcmp(arg, "--schedule") == 0) {
+            o->schedule = 1;
+        } else if (strcmp(arg, "--no-ai-lod") == 0) {
+            o->no_ai_lod = 1;
+        } else if (strcmp(arg, "--level") == 0 && val) {
+            o->level_name = val;
+            ++i;
+        } else if (strcmp(arg, "--ticks") == 0 && val) {
+            o->ticks = atoi(val);
+            ++i;
+        } else if (strcmp(arg, "--size") == 0 && val) {
+            int w = 0;
+            int h = 0;
+            if (sscanf(val, "%dx%d", &w, &h) != 2 || w <= 0 || h <= 0) {
+                fprintf(stderr, "invalid --size '%s'\n", val);
+                return 0;
+            }
+            o->world_w = (float)w;
+            o->world_h = (float)h;
+            ++i;
+        } else if (strcmp(arg, "--seed") == 0 && val) {
+            o->seed = (uint32_t)strtoul(val, NULL, 0);
+            ++i;
+        } else if (strcmp(arg, "--record") == 0 && val) {
+            o->record_path = val;
+            ++i;
+        } else if (strcmp(arg, "--replay") == 0 && val) {
+            o->replay_path = val;
+            ++i;
+        } else if (strcmp(arg, "--level-file") == 0 && val) {
+            o->level_file = val;
+            ++i;
+        } else if (strcmp(arg, "--caps") == 0 && val) {
+            if (!parse_caps(val, &o->caps)) {
+                fprintf(stderr, "invalid --caps '%s'\n", val);
+                return 0;
+            }
+            ++i;
+        } else if (strcmp(arg, "--threads") == 0 && val) {
+            o->threads = atoi(val);
+            ++i;
+        } else if (strcmp(arg, "--rollback-check") == 0 && val) {
+            o->rollback_ticks = atoi(val);
+            ++i;
+        } else if (strcmp(arg, "--script") == 0 && val) {
+            if (strcmp(val, "sweep") == 0) {
+                o->script = HEADLESS_SCRIPT_SWEEP;
+            } else if (strcmp(val, "idle") == 0) {
+                o->script = HEADLESS_SCRIPT_IDLE;
+            } else {
+                fprintf(stderr, "unknown --script '%s'\n", val);
+                return 0;
+            }
+            ++i;
+        } else {
+            return 0;
+        }
+    }
+    if (o->ticks <= 0) {
+        fprintf(stderr, "--ticks must be positive\n");
+        return 0;
+    }
+    if (o->threads < 0) {
+        fprintf(stderr, "--threads must not be negative\n");
+        return 0;
+    }
+    if (o->rollback_ticks < 0 || o->rollback_ticks > GAME_HISTORY_TICKS) {
+        fprintf(stderr, "--rollback-check takes 0..%d ticks\n", GAME_HISTORY_TICKS);
+        return 0;
+    }
+    if (o->record_path && o->rollback_ticks > 0) {
+        fprintf(stderr, "--record and --rollback-check cannot be combined\n");
+        return 0;
+    }
+    if (o->level_file && (o->all_levels || o->level_name || o->replay_path || o->record_path)) {
+        fprintf(stderr, "--level-file takes a plain single run\n");
+        return 0;
+    }
+    if (o->record_path && (o->all_levels || o->replay_path)) {
+        fprintf(stderr, "--record takes a single level run\n");
+        return 0;
+    }
+    return 1;
+}
+
+/* Level data is located relative to cwd by game.c; fall back to the source tree. */
+static void ensure_level_data_reachable(void) {
+    FILE* f = fopen("data/levels/combat.cfg", "r");
+    if (!f) {
+        f = fopen("../data/levels/combat.cfg", "r");
+    }
+    if (f) {
+        fclose(f);
+        return;
+    }
+#ifdef VTYPE_SOURCE_DIR
+    if (chdir(VTYPE_SOURCE_DIR) != 0) {
+        fprintf(stderr, "headless: could not chdir to %s\n", VTYPE_SOURCE_DIR);
+    }
+#endif
+}
+
+static void scripted_input(int script, int tick, game_input* in) {
+    if (script == HEADLESS_SCRIPT_IDLE) {
+        memset(in, 0, sizeof(*in));
+        return;
+    }
+    sim_script_sweep_input(tick, in);
+}
+
+static void track_peaks(const game_state* g, headless_result* out) {
+    const int enemies = game_enemy_count(g);
+    if (enemies > out->peak_enemies) {
+        out->peak_enemies = enemies;
+    }
+    if (g->enemy_bullet_pool.live > out->peak_enemy_bullets) {
+        out->peak_enemy_bullets = g->enemy_bullet_pool.live;
+    }
+}
+
+/*
+ * Rewinds h by n ticks and re-simulates back to the present from the recorded
+ * input; returns 1 if the state matches what it was before the rewind.
+ */
+static int rollback_check(game_state* g, game_history* h, int n) {
+    static uint8_t before[sizeof(game_state)];
+    static uint8_t after[sizeof(game_state)];
+    const size_t before_size = game_snapshot_save(g, before, sizeof(before));
+    size_t after_size;
+    const int rewound = game_rollback(g, h, n);
+    for (int i = 0; i < rewound; ++i) {
+        const game_input in = h->inputs[h->tick % GAME_HISTORY_TICKS];
+        game_history_update(h, g, &in);
+    }
+    after_size = game_snapshot_save(g, after, sizeof(after));
+    return before_size <= sizeof(before) && after_size == before_size && memcmp(before, after, before_size) == 0;
+}
+
+/* Loads a level file over the current level's slot so restarts and exits come back to it. */
+static int apply_level_file(game_state* g, const char* path) {
+    static leveldef_level lvl;
+    int style = -1;
+    if (!leveldef_load_level_file_with_base(game_leveldef_get(), path, &lvl, &style, stderr)) {
+        fprintf(stderr, "headless: could not load level file '%s'\n", path);
+        return 0;
+    }
+    return game_apply_level_override(g, &lvl, NULL);
+}
+
+/* Curated entries in the order the camera reaches them (world x), then the event lane. */
+static void print_schedule(const game_state* g) {
+    const leveldef_level* lvl = game_current_leveldef(g);
+    if (!lvl) {
+        return;
+    }
+    printf(
+        "schedule level=%s curated=%d events=%d\n",
+        game_current_level_name(g),
+        g->curated_schedule_count,
+        lvl->event_count
+    );
+    for (int k = 0; k < g->curated_schedule_count; ++k) {
+        const int i = g->curated_schedule[k];
+        printf("  curated index=%d x=%.0f kind=%d\n", i, lvl->curated[i].x01 * g->world_w, lvl->curated[i].kind);
+    }
+    for (int k = 0; k < lvl->event_count; ++k) {
+        printf("  event order=%d kind=%d delay_s=%.2f\n", lvl->events[k].order, lvl->events[k].kind, lvl->events[k].delay_s);
+    }
+}
+
+static void run_level(game_state* g, const headless_options* o, const char* level_name, headless_result* out) {
+    game_input in;
+    int level_index;
+    replay_writer rec;
+    char file_level_name[HEADLESS_LEVEL_NAME_CAP];
+    static game_history hist;
+    memset(out, 0, sizeof(*out));
+    memset(&rec, 0, sizeof(rec));
+    game_history_init(&hist, k_sim_fixed_dt_s);
+    if (o->record_path && !replay_writer_open(&rec, o->record_path)) {
+        return;
+    }
+    game_init_with_capacity(g, o->world_w, o->world_h, &o->caps);
+    game_set_ai_lod(g, !o->no_ai_lod);
+    if (level_name && !game_set_level_by_name(g, level_name)) {
+        fprintf(stderr, "headless: unknown level '%s'\n", level_name);
+        return;
+    }
+    if (o->level_file) {
+        if (!apply_level_file(g, o->level_file)) {
+            return;
+        }
+        snprintf(file_level_name, sizeof(file_level_name), "%s", game_current_level_name(g));
+        level_name = file_level_name;
+    }
+    game_set_rng_seed(g, o->seed);
+    game_profile_set_enabled(&g->profile, o->profile);
+    if (o->schedule) {
+        print_schedule(g);
+    }
+    level_index = g->level_index;
+    {
+        const double t0 = now_seconds();
+        for (int tick = 0; tick < o->ticks; ++tick) {
+            double tick_t0;
+            double tick_us;
+            scripted_input(o->script, tick, &in);
+            if (g->lives <= 0) {
+                in.restart = 1;
+                out->restarts += 1;
+            }
+            tick_t0 = now_seconds();
+            if (rec.f) {
+                replay_writer_update(&rec, g, k_sim_fixed_dt_s, &in);
+            } else if (o->rollback_ticks > 0) {
+                game_history_update(&hist, g, &in);
+                if (tick % 600 == 599) {
+                    out->rollbacks += 1;
+                    if (!rollback_check(g, &hist, o->rollback_ticks)) {
+                        out->rollback_mismatches += 1;
+                        fprintf(stderr, "headless: rollback mismatch at tick %d\n", tick);
+                    }
+                }
+            } else {
+                game_update(g, k_sim_fixed_dt_s, &in);
+            }
+            tick_us = (now_seconds() - tick_t0) * 1.0e6;
+            if (tick_us > out->max_tick_us) {
+                out->max_tick_us = tick_us;
+            }
+            /* Keep benchmarking the requested level if the player exits or times out. */
+            if (g->level_index != level_index) {
+                out->level_changes += 1;
+                if (level_name) {
+                    (void)game_set_level_by_name(g, level_name);
+                }
+                level_index = g->level_index;
+            }
+            track_peaks(g, out);
+            out->ticks += 1;
+        }
+        out->wall_ms = (now_seconds() - t0) * 1000.0;
+    }
+    replay_writer_close(&rec);
+    game_history_free(&hist);
+}
+
+/* Replays a recording as fast as possible; the input and level changes all come from the file. */
+static int run_replay(game_state* g, const char* path, int profile, headless_result* out) {
+    replay_reader r;
+    memset(out, 0, sizeof(*out));
+    if (!replay_reader_open(&r, path)) {
+        return 0;
+    }
+    {
+        const double t0 = now_seconds();
+        for (;;) {
+            const double tick_t0 = now_seconds();
+            double tick_us;
+            const int lives_before = g->lives;
+            /* The first tick rebuilds the start state, which clears the profile flag. */
+            game_profile_set_enabled(&g->profile, profile);
+            if (!replay_reader_update(&r, g)) {
+                break;
+            }
+            tick_us = (now_seconds() - tick_t0) * 1.0e6;
+            if (tick_us > out->max_tick_us) {
+                out->max_tick_us = tick_us;
+            }
+            if (out->ticks > 0 && lives_before <= 0) {
+                out->restarts += 1;
+            }
+            if (g->level_index != r.tick_level_index) {
+                out->level_changes += 1;
+            }
+            track_peaks(g, out);
+            out->ticks += 1;
+        }
+        out->wall_ms = (now_seconds() - t0) * 1000.0;
+    }
+    replay_reader_close(&r);
+    return 1;
+}
+
+static void print_result(const game_state* g, const char* level_name, const headless_result* r) {
+    const double tps = (r->wall_ms > 0.0) ? ((double)r->ticks / (r->wall_ms * 0.001)) : 0.0;
+    const double avg_us = (r->ticks > 0) ? (r->wall_ms * 1000.0 / (double)r->ticks) : 0.0;
+    printf(
+        "level=%s ticks=%d wall_ms=%.2f tps=%.0f avg_us=%.2f max_us=%.2f enemies=%d particles=%d score=%d restarts=%d level_changes=%d"
+        " peak_enemies=%d peak_enemy_bullets=%d\n",
+        level_name,
+        r->ticks,
+        r->wall_ms,
+        tps,
+        avg_us,
+        r->max_tick_us,
+        game_enemy_count(g),
+        g->particles.count,
+        g->score,
+        r->restarts,
+        r->level_changes,
+        r->peak_enemies,
+        r->peak_enemy_bullets
+    );
+    for (int s = 0; g->profile.enabled && s <= GAME_PROFILE_TICK; ++s) {
+        game_profile_stats st;
+        if (game_profile_get_stats(&g->profile, s, &st)) {
+            printf(
+                "  %-12s min=%.2f avg=%.2f p99=%.2f max=%.2f\n",
+                game_profile_section_name(s),
+                st.min_us,
+                st.avg_us,
+                st.p99_us,
+                st.max_us
+            );
+        }
+    }
+    if (r->rollbacks > 0) {
+        printf("  rollbacks=%d mismatches=%d\n", r->rollbacks, r->rollback_mismatches);
+    }
+    fflush(stdout);
+}
+
+static int collect_level_names(game_state* g, const headless_options* o, char names[][HEADLESS_LEVEL_NAME_CAP]) {
+    int count = 0;
+    char first[HEADLESS_LEVEL_NAME_CAP];
+    game_init(g, o->world_w, o->world_h);
+    snprintf(first, sizeof(first), "%s", game_current_level_name(g));
+    do {
+        snprintf(names[count], HEADLESS_LEVEL_NAME_CAP, "%s", game_current_level_name(g));
+        count += 1;
+        game_cycle_level(g);
+    } while (count < HEADLESS_MAX_LEVELS && strcmp(game_current_level_name(g), first) != 0);
+    return count;
+}
+
+int main(int argc, char** argv) {
+    headless_options o;
+    game_state* g;
+    if (!parse_options(argc, argv, &o)) {
+        usage(argv[0]);
+        return 2;
+    }
+    ensure_level_data_reachable();
+    g = (game_state*)calloc(1, sizeof(*g));
+    if (!g) {
+        fprintf(stderr, "headless: out of memory\n");
+        return 1;
+    }
+    (void)enemy_set_worker_threads(o.threads);
+
+    if (o.replay_path) {
+        headless_result r;
+        g->caps = o.caps;
+        if (!run_replay(g, o.replay_path, o.profile, &r)) {
+            (void)enemy_set_worker_threads(0);
+            free(g);
+            return 1;
+        }
+        print_result(g, game_current_level_name(g), &r);
+    } else if (o.all_levels) {
+        static char names[HEADLESS_MAX_LEVELS][HEADLESS_LEVEL_NAME_CAP];
+        const int count = collect_level_names(g, &o, names);
+        double total_ms = 0.0;
+        int total_ticks = 0;
+        for (int i = 0; i < count; ++i) {
+            headless_result r;
+            run_level(g, &o, names[i], &r);
+            print_result(g, names[i], &r);
+            total_ms += r.wall_ms;
+            total_ticks += r.ticks;
+        }
+        printf(
+            "total levels=%d ticks=%d wall_ms=%.2f tps=%.0f\n",
+            count,
+            total_ticks,
+            total_ms,
+            (total_ms > 0.0) ? ((double)total_ticks / (total_ms * 0.001)) : 0.0
+        );
+    } else {
+        headless_result r;
+        run_level(g, &o, o.level_name, &r);
+        print_result(g, o.level_file ? o.level_file : game_current_level_name(g), &r);
+    }
+
+    (void)enemy_set_worker_threads(0);
+    free(g);
+    return 0;
+}
@@ -2045,6 +2045,9 @@ static int build_level_serialized_text(
             if (!appendf(out, out_cap, &used, "v.max_speed=%.3f\n", lvl.v.max_speed)) return 0;
             if (!appendf(out, out_cap, &used, "v.accel=%.3f\n", lvl.v.accel)) return 0;
         }
+        if (lvl.swarm_count > 0) {
+            if (!appendf(out, out_cap, &used, "swarm.count=%d\n", lvl.swarm_count)) return 0;
+        }
         if (need_kamikaze) {
             if (!appendf(out, out_cap, &used, "kamikaze.count=%d\n", lvl.kamikaze.count)) return 0;
             if (!appendf(out, out_cap, &used, "kamikaze.start_x01=%.3f\n", lvl.kamikaze.start_x01)) return 0;
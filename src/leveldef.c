@@ -1450,6 +1450,8 @@ static int leveldef_apply_file(leveldef_db* db, const char* path, FILE* log_out)
                         cur_level->v.max_speed = strtof(v, NULL);
                     } else if (strcmp(k, "v.accel") == 0) {
                         cur_level->v.accel = strtof(v, NULL);
+                    } else if (strcmp(k, "swarm.count") == 0) {
+                        cur_level->swarm_count = atoi(v);
                     } else if (strcmp(k, "kamikaze.count") == 0) {
                         cur_level->kamikaze.count = atoi(v);
                     } else if (strcmp(k, "kamikaze.start_x01") == 0) {
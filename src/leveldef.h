@@ -10,6 +10,7 @@
 #define LEVELDEF_WEAPON_COUNT 3
 #define LEVELDEF_MAX_DISCOVERED_LEVELS 128
 #define LEVELDEF_MAX_EVENTS 64
+#define LEVELDEF_MAX_CURATED MAX_CURATED_RUNTIME
 #define LEVELDEF_MAX_MINEFIELDS 32
 #define LEVELDEF_MAX_MISSILE_LAUNCHERS 32
 #define LEVELDEF_MAX_ARC_NODES 64
@@ -442,8 +443,9 @@ typedef struct leveldef_level {
     leveldef_wave_sine_tuning sine;
     leveldef_wave_v_tuning v;
     leveldef_wave_kamikaze_tuning kamikaze;
+    int swarm_count; /* Boids per swarm wave when > 0; otherwise the boid profile's count. */
     int curated_count;
-    leveldef_curated_enemy curated[LEVELDEF_MAX_BOID_CYCLE * 8];
+    leveldef_curated_enemy curated[LEVELDEF_MAX_CURATED];
     int searchlight_count;
     leveldef_searchlight searchlights[MAX_SEARCHLIGHTS];
     int minefield_count;
@@ -1,6 +1,7 @@
 #include "game.h"
 #include "acoustics_ui_layout.h"
 #include "audio.h"
+#include "enemy.h"
 #include "level_editor.h"
 #include "leveldef.h"
 #include "menu.h"
@@ -9,8 +10,11 @@
 #include "planetarium/planetarium_validate.h"
 #include "planetarium_propaganda.h"
 #include "render.h"
+#include "replay.h"
 #include "settings.h"
+#include "snapshot.h"
 #include "texture_atlas.h"
+#include "triple_buffer.h"
 #include "ui_layout.h"
 #include "vg.h"
 #include "vg_ui.h"
@@ -341,6 +345,8 @@ typedef struct hitch_trace_frame {
     submit_trace submit;
     int menu_screen;
     char level_name[HITCH_TRACE_LEVEL_NAME_CAP];
+    int sim_profile_valid;
+    float sim_section_ms[GAME_PROFILE_SECTION_COUNT]; /* Summed over the frame's sim_steps ticks. */
 } hitch_trace_frame;
 
 typedef struct hitch_trace_ring {
@@ -350,6 +356,14 @@ typedef struct hitch_trace_ring {
     uint32_t dump_count;
 } hitch_trace_ring;
 
+/* One published sim tick: a render copy of game, which carries the previous tick's poses for interpolation. */
+typedef struct sim_snapshot {
+    game_state game;
+    uint64_t publish_counter;
+    float accum_s;
+    int running;
+} sim_snapshot;
+
 typedef struct app {
     SDL_Window* window;
 
@@ -482,6 +496,20 @@ typedef struct app {
     float sim_fixed_dt_s;
     float sim_accum_s;
     int sim_max_catchup_steps;
+    /* While sim_thread runs, game, sim_input, sim_accum_s and the two ints below are guarded by sim_lock. */
+    SDL_Thread* sim_thread;
+    SDL_mutex* sim_lock;
+    atomic_int sim_thread_quit;
+    int sim_thread_run;
+    int sim_thread_steps;
+    game_input sim_input;
+    sim_snapshot* sim_snapshots;
+    triple_buffer sim_snapshot_tb;
+    const game_state* render_game; /* What render-path code draws: game, or the newest snapshot when threaded. */
+    float render_sim_alpha;
+    replay_writer replay_rec; /* VTYPE_REPLAY_RECORD */
+    replay_reader replay_play; /* VTYPE_REPLAY_PLAY; sim-owned like game */
+    int replay_playing;
     float grid_sim_hz;
     float grid_sim_spring_k;
     float grid_sim_neighbor_coupling;
@@ -695,6 +723,7 @@ typedef struct app {
     int force_clear_frames;
     int show_crt_ui;
     int show_fps_counter;
+    int show_sim_profile; /* VTYPE_SIM_PROFILE or the P key */
     int crt_ui_selected;
     int crt_ui_mouse_drag;
     int video_menu_selected;
@@ -990,13 +1019,23 @@ static void hitch_trace_ring_push(hitch_trace_ring* ring, const hitch_trace_fram
     }
 }
 
+/* Ends a hitch line with the per-subsystem sim columns when profiling was on. */
+static void hitch_trace_print_sim_sections(FILE* out, const hitch_trace_frame* frame) {
+    if (frame->sim_profile_valid) {
+        for (int s = 0; s < GAME_PROFILE_SECTION_COUNT; ++s) {
+            fprintf(out, " sim_%s=%.3f", game_profile_section_name(s), frame->sim_section_ms[s]);
+        }
+    }
+    fputc('\n', out);
+}
+
 static void hitch_trace_frame_print(FILE* out, const hitch_trace_frame* frame, uint32_t index) {
     if (!out || !frame) {
         return;
     }
     fprintf(
         out,
-        "[%u] total=%.2fms dt=%.2fms sim_steps=%d sim=%.2f audio_ui=%.2f frame_wait=%.2f structure_tiles=%.2f acquire=%.2f image_wait=%.2f submit_present=%.2f record=%.2f vg=%.2f post=%.2f end_cmd=%.2f submit=%.2f present=%.2f gpu_total=%.2f gpu_scene=%.2f gpu_bloom=%.2f gpu_comp=%.2f gpu_valid=%d menu=%d level=%s\n",
+        "[%u] total=%.2fms dt=%.2fms sim_steps=%d sim=%.2f audio_ui=%.2f frame_wait=%.2f structure_tiles=%.2f acquire=%.2f image_wait=%.2f submit_present=%.2f record=%.2f vg=%.2f post=%.2f end_cmd=%.2f submit=%.2f present=%.2f gpu_total=%.2f gpu_scene=%.2f gpu_bloom=%.2f gpu_comp=%.2f gpu_valid=%d menu=%d level=%s",
         index,
         frame->total_ms,
         frame->dt_ms,
@@ -1022,6 +1061,7 @@ static void hitch_trace_frame_print(FILE* out, const hitch_trace_frame* frame, u
         frame->menu_screen,
         frame->level_name
     );
+    hitch_trace_print_sim_sections(out, frame);
 }
 
 static void hitch_trace_ring_dump(hitch_trace_ring* ring, const hitch_trace_frame* trigger) {
@@ -1050,6 +1090,165 @@ static void hitch_trace_ring_dump(hitch_trace_ring* ring, const hitch_trace_fram
     fprintf(stderr, "[hitch-dump] wrote %s trigger_total=%.2fms frames=%u\n", path, trigger->total_ms, ring->count);
 }
 
+/* One fixed tick, fed from the replay file when playing one back and logged when recording. */
+static void step_game(app* a, const game_input* in) {
+    if (a->replay_playing) {
+        if (replay_reader_update(&a->replay_play, &a->game)) {
+            return;
+        }
+        fprintf(stderr, "replay: finished after %u ticks\n", (unsigned int)a->replay_play.ticks);
+        replay_reader_close(&a->replay_play);
+        a->replay_playing = 0;
+    }
+    if (a->replay_rec.f) {
+        replay_writer_update(&a->replay_rec, &a->game, a->sim_fixed_dt_s, in);
+        return;
+    }
+    game_update(&a->game, a->sim_fixed_dt_s, in);
+}
+
+/* Caller holds sim_lock. Copies only what rendering reads, so the lock is held for live entities, not all of game. */
+static void publish_sim_snapshot(app* a) {
+    sim_snapshot* snap = &a->sim_snapshots[triple_buffer_write_slot(&a->sim_snapshot_tb)];
+    game_snapshot_copy_render(&snap->game, &a->game);
+    snap->publish_counter = SDL_GetPerformanceCounter();
+    snap->accum_s = a->sim_accum_s;
+    snap->running = a->sim_thread_run;
+    triple_buffer_publish(&a->sim_snapshot_tb);
+}
+
+static int sim_thread_main(void* userdata) {
+    app* a = (app*)userdata;
+    const float freq = (float)SDL_GetPerformanceFrequency();
+    uint64_t last = SDL_GetPerformanceCounter();
+    while (!atomic_load_explicit(&a->sim_thread_quit, memory_order_acquire)) {
+        const uint64_t now = SDL_GetPerformanceCounter();
+        float dt = (float)(now - last) / freq;
+        float wait_s = 0.0f;
+        last = now;
+        if (dt > 0.25f) dt = 0.25f;
+        SDL_LockMutex(a->sim_lock);
+        if (a->sim_thread_run) {
+            const float max_sim_catchup_s = a->sim_fixed_dt_s * (float)a->sim_max_catchup_steps;
+            int steps = 0;
+            a->sim_accum_s += dt;
+            if (a->sim_accum_s > max_sim_catchup_s) {
+                a->sim_accum_s = max_sim_catchup_s;
+            }
+            while (a->sim_accum_s >= a->sim_fixed_dt_s && steps < a->sim_max_catchup_steps) {
+                step_game(a, &a->sim_input);
+                a->sim_input.restart = 0;
+                a->sim_accum_s -= a->sim_fixed_dt_s;
+                steps++;
+            }
+            if (steps > 0) {
+                a->sim_thread_steps += steps;
+                publish_sim_snapshot(a);
+            }
+            wait_s = a->sim_fixed_dt_s - a->sim_accum_s;
+        } else {
+            a->sim_accum_s = 0.0f;
+            wait_s = a->sim_fixed_dt_s;
+        }
+        SDL_UnlockMutex(a->sim_lock);
+        SDL_Delay((wait_s > 0.002f) ? (Uint32)(wait_s * 1000.0f) : 1u);
+    }
+    return 0;
+}
+
+static int start_sim_thread(app* a) {
+    a->sim_snapshots = (sim_snapshot*)calloc(3u, sizeof(*a->sim_snapshots));
+    a->sim_lock = SDL_CreateMutex();
+    if (!a->sim_snapshots || !a->sim_lock) {
+        fprintf(stderr, "sim thread unavailable; stepping on the render thread\n");
+        free(a->sim_snapshots);
+        a->sim_snapshots = NULL;
+        if (a->sim_lock) {
+            SDL_DestroyMutex(a->sim_lock);
+            a->sim_lock = NULL;
+        }
+        return 0;
+    }
+    triple_buffer_init(&a->sim_snapshot_tb);
+    atomic_store_explicit(&a->sim_thread_quit, 0, memory_order_release);
+    a->sim_thread_run = 0;
+    a->sim_thread_steps = 0;
+    a->sim_accum_s = 0.0f;
+    memset(&a->sim_input, 0, sizeof(a->sim_input));
+    publish_sim_snapshot(a);
+    a->sim_thread = SDL_CreateThread(sim_thread_main, "vtype_sim", a);
+    if (!a->sim_thread) {
+        fprintf(stderr, "SDL_CreateThread(sim) failed: %s; stepping on the render thread\n", SDL_GetError());
+        SDL_DestroyMutex(a->sim_lock);
+        a->sim_lock = NULL;
+        free(a->sim_snapshots);
+        a->sim_snapshots = NULL;
+        return 0;
+    }
+    return 1;
+}
+
+static void stop_sim_thread(app* a) {
+    if (a->sim_thread) {
+        atomic_store_explicit(&a->sim_thread_quit, 1, memory_order_release);
+        SDL_WaitThread(a->sim_thread, NULL);
+        a->sim_thread = NULL;
+    }
+    if (a->sim_lock) {
+        SDL_DestroyMutex(a->sim_lock);
+        a->sim_lock = NULL;
+    }
+    free(a->sim_snapshots);
+    a->sim_snapshots = NULL;
+    a->render_game = &a->game;
+}
+
+/* SDL mutexes are recursive, so state-change paths can lock while the main loop already holds it. */
+static void lock_sim(app* a) {
+    if (a->sim_lock) {
+        SDL_LockMutex(a->sim_lock);
+    }
+}
+
+static void unlock_sim(app* a) {
+    if (a->sim_lock) {
+        SDL_UnlockMutex(a->sim_lock);
+    }
+}
+
+/* Points render_game at the newest tick and derives the interpolation alpha from its age. */
+static void acquire_render_snapshot(app* a) {
+    const float dt = fmaxf(a->sim_fixed_dt_s, 1.0e-6f);
+    if (!a->sim_thread) {
+        a->render_game = &a->game;
+        a->render_sim_alpha = clampf(a->sim_accum_s / dt, 0.0f, 1.0f);
+        return;
+    }
+    {
+        const sim_snapshot* snap = &a->sim_snapshots[triple_buffer_acquire(&a->sim_snapshot_tb, NULL)];
+        const float age_s = (float)(SDL_GetPerformanceCounter() - snap->publish_counter) / (float)SDL_GetPerformanceFrequency();
+        a->render_game = &snap->game;
+        a->render_sim_alpha = snap->running ? clampf((snap->accum_s + age_s) / dt, 0.0f, 1.0f) : 0.0f;
+    }
+}
+
+/*
+ * Main-thread edits of game outside the per-frame input handoff: sim_lock is
+ * held only around the edit, and the result is republished so render_game
+ * (and anything that reads it, like the structure tile sync) sees it at once.
+ */
+static void begin_game_edit(app* a) {
+    lock_sim(a);
+}
+
+static void end_game_edit(app* a) {
+    if (a->sim_thread) {
+        publish_sim_snapshot(a);
+    }
+    unlock_sim(a);
+    acquire_render_snapshot(a);
+}
+
 static const char* k_control_action_labels[CONTROL_ACTION_COUNT] = {
     "UP", "DOWN", "LEFT", "RIGHT", "PRIMARY FIRE", "SECONDARY FIRE"
 };
@@ -1133,7 +1332,9 @@ static void sync_shipyard_weapon_to_game(app* a) {
     if (a->shipyard_weapon_selected >= PLAYER_ALT_WEAPON_COUNT) {
         a->shipyard_weapon_selected = PLAYER_ALT_WEAPON_COUNT - 1;
     }
+    lock_sim(a);
     game_set_alt_weapon(&a->game, a->shipyard_weapon_selected);
+    unlock_sim(a);
 }
 
 static void menu_open_screen(app* a, int screen, int return_screen) {
@@ -1184,8 +1385,8 @@ static int gameplay_palette_mode(const app* a) {
     if (!a) {
         return 0;
     }
-    if (a->game.level_theme_palette >= 0 && a->game.level_theme_palette <= 2) {
-        return a->game.level_theme_palette;
+    if (a->render_game->level_theme_palette >= 0 && a->render_game->level_theme_palette <= 2) {
+        return a->render_game->level_theme_palette;
     }
     return a->palette_mode;
 }
@@ -1328,7 +1529,7 @@ static int handle_grid_tuning_key(app* a, SDL_Keycode key) {
         return 0;
     }
     {
-        const leveldef_level* lvl = game_current_leveldef(&a->game);
+        const leveldef_level* lvl = game_current_leveldef(a->render_game);
         if (!lvl || lvl->background_style != LEVELDEF_BACKGROUND_GRID) {
             return 0;
         }
@@ -1401,7 +1602,7 @@ static void print_fog_tuning(const app* a) {
 }
 
 static int handle_fog_tuning_key(app* a, SDL_Keycode key) {
-    if (!a || !a->fog_tuning_enabled || a->game.render_style != LEVEL_RENDER_FOG) {
+    if (!a || !a->fog_tuning_enabled || a->render_game->render_style != LEVEL_RENDER_FOG) {
         return 0;
     }
     int handled = 1;
@@ -1519,7 +1720,7 @@ static void print_terrain_tuning(const app* a) {
 }
 
 static int handle_terrain_tuning_key(app* a, SDL_Keycode key) {
-    if (!a || !a->terrain_tuning_enabled || a->game.render_style != LEVEL_RENDER_DRIFTER_SHADED) {
+    if (!a || !a->terrain_tuning_enabled || a->render_game->render_style != LEVEL_RENDER_DRIFTER_SHADED) {
         return 0;
     }
     int handled = 1;
@@ -2260,7 +2461,7 @@ static void set_tty_level_intro_message(app* a) {
     if (!a) {
         return;
     }
-    const char* raw = game_current_level_name(&a->game);
+    const char* raw = game_current_level_name(a->render_game);
     char lvl[96];
     char msg[160];
     format_level_name_for_tty(raw, lvl, sizeof(lvl));
@@ -2272,7 +2473,7 @@ static void update_level_start_teletype(app* a) {
     if (!a) {
         return;
     }
-    const char* cur = game_current_level_name(&a->game);
+    const char* cur = game_current_level_name(a->render_game);
     if (!cur) {
         cur = "";
     }
@@ -2334,20 +2535,20 @@ static void audio_spatial_params_from_world(const app* a, float event_x, float e
         return;
     }
 
-    float dx = event_x - a->game.player.b.x;
-    float dy = event_y - a->game.player.b.y;
-    if (a->game.render_style == LEVEL_RENDER_CYLINDER) {
-        const float su = fmaxf(0.5f, fminf(a->game.world_w / 1920.0f, a->game.world_h / 1080.0f));
+    float dx = event_x - a->render_game->player.b.x;
+    float dy = event_y - a->render_game->player.b.y;
+    if (a->render_game->render_style == LEVEL_RENDER_CYLINDER) {
+        const float su = fmaxf(0.5f, fminf(a->render_game->world_w / 1920.0f, a->render_game->world_h / 1080.0f));
         const float period = fmaxf(1920.0f * su * 2.4f, 1.0f);
-        const float theta = audio_wrap_delta(event_x, a->game.player.b.x, period) / period * 6.28318530718f;
-        const float radius = a->game.world_w * 0.485f;
+        const float theta = audio_wrap_delta(event_x, a->render_game->player.b.x, period) / period * 6.28318530718f;
+        const float radius = a->render_game->world_w * 0.485f;
         const float lateral = sinf(theta) * radius;
         const float depth = (1.0f - cosf(theta)) * radius;
         dx = lateral;
         dy *= 0.44f + (cosf(theta) * 0.5f + 0.5f) * 0.62f;
         {
             const float dist = sqrtf(lateral * lateral + dy * dy + depth * depth);
-            const float near_r = fmaxf(fminf(a->game.world_w, a->game.world_h) * 0.10f, 1.0f);
+            const float near_r = fmaxf(fminf(a->render_game->world_w, a->render_game->world_h) * 0.10f, 1.0f);
             const float far_r = fmaxf(radius * 2.0f, near_r + 1.0f);
             const float t = clampf((dist - near_r) / (far_r - near_r), 0.0f, 1.0f);
             const float fade = 1.0f - t;
@@ -2356,9 +2557,9 @@ static void audio_spatial_params_from_world(const app* a, float event_x, float e
             return;
         }
     }
-    const float pan_ref = fmaxf(a->game.world_w * 0.45f, 1.0f);
-    const float near_r = fmaxf(fminf(a->game.world_w, a->game.world_h) * 0.10f, 1.0f);
-    const float far_r = fmaxf(fmaxf(a->game.world_w, a->game.world_h) * 1.20f, near_r + 1.0f);
+    const float pan_ref = fmaxf(a->render_game->world_w * 0.45f, 1.0f);
+    const float near_r = fmaxf(fminf(a->render_game->world_w, a->render_game->world_h) * 0.10f, 1.0f);
+    const float far_r = fmaxf(fmaxf(a->render_game->world_w, a->render_game->world_h) * 1.20f, near_r + 1.0f);
     const float dist = sqrtf(dx * dx + dy * dy);
     const float t = clampf((dist - near_r) / (far_r - near_r), 0.0f, 1.0f);
     const float fade = 1.0f - t;
@@ -4819,6 +5020,7 @@ static int handle_planetarium_mouse(app* a, int mouse_x, int mouse_y, int set_va
 static void apply_level_editor_runtime(app* a) {
     const leveldef_db* db = NULL;
     leveldef_level lvl;
+    int applied;
     if (!a) {
         return;
     }
@@ -4829,9 +5031,12 @@ static void apply_level_editor_runtime(app* a) {
     if (!db) {
         return;
     }
+    begin_game_edit(a);
     (void)game_set_level_by_name(&a->game, a->level_editor.level_name);
-    if (level_editor_build_level(&a->level_editor, db, &lvl) &&
-        game_apply_level_override(&a->game, &lvl, a->level_editor.level_name)) {
+    applied = level_editor_build_level(&a->level_editor, db, &lvl) &&
+              game_apply_level_override(&a->game, &lvl, a->level_editor.level_name);
+    end_game_edit(a);
+    if (applied) {
         a->level_editor_applied_revision = a->level_editor.edit_revision;
         (void)sync_structure_tile_resources_after_state_change(a, "level editor apply");
     }
@@ -4864,8 +5069,11 @@ static int handle_level_editor_mouse(app* a, int mouse_x, int mouse_y, int mouse
         const leveldef_db* db = (const leveldef_db*)game_leveldef_get();
         char saved_path[LEVEL_EDITOR_PATH_CAP];
         if (level_editor_save_current(&a->level_editor, db, saved_path, sizeof(saved_path))) {
-            if (!game_refresh_levels(&a->game) ||
-                !game_set_level_by_name(&a->game, a->level_editor.level_name)) {
+            int synced;
+            begin_game_edit(a);
+            synced = game_refresh_levels(&a->game) && game_set_level_by_name(&a->game, a->level_editor.level_name);
+            end_game_edit(a);
+            if (!synced) {
                 set_tty_message(a, "level editor: saved, runtime sync failed");
                 return action != 0;
             }
@@ -4889,8 +5097,11 @@ static int handle_level_editor_mouse(app* a, int mouse_x, int mouse_y, int mouse
         const leveldef_db* db = (const leveldef_db*)game_leveldef_get();
         char saved_path[LEVEL_EDITOR_PATH_CAP];
         if (level_editor_save_new(&a->level_editor, db, saved_path, sizeof(saved_path))) {
-            if (!game_refresh_levels(&a->game) ||
-                !game_set_level_by_name(&a->game, a->level_editor.level_name)) {
+            int synced;
+            begin_game_edit(a);
+            synced = game_refresh_levels(&a->game) && game_set_level_by_name(&a->game, a->level_editor.level_name);
+            end_game_edit(a);
+            if (!synced) {
                 set_tty_message(a, "level editor: saved new, runtime sync failed");
                 return action != 0;
             }
@@ -5424,6 +5635,10 @@ static void clear_scene_color_depth(VkCommandBuffer cmd, VkExtent2D extent) {
 }
 
 static void cleanup(app* a) {
+    stop_sim_thread(a);
+    (void)enemy_set_worker_threads(0);
+    replay_writer_close(&a->replay_rec);
+    replay_reader_close(&a->replay_play);
     g_shared_noise_tex_ready = 0;
     if (a->device != VK_NULL_HANDLE && !a->device_lost) {
         vkDeviceWaitIdle(a->device);
@@ -6239,7 +6454,9 @@ static int recreate_render_runtime(app* a) {
     if (have_crt) {
         vg_set_crt_profile(a->vg, &saved_crt);
     }
+    begin_game_edit(a);
     game_set_world_size(&a->game, (float)a->swapchain_extent.width, (float)a->swapchain_extent.height);
+    end_game_edit(a);
     reset_grid_sim_state(a);
     a->force_clear_frames = 2;
     return sync_structure_tile_resources_for_current_state(a);
@@ -7470,7 +7687,7 @@ static void update_gpu_wormhole_vertices(app* a) {
         return;
     }
     wormhole_line_vertex* out = (wormhole_line_vertex*)a->wormhole_line_vertex_map;
-    const size_t n = render_build_event_horizon_gpu_lines(&a->game, out, (size_t)WORMHOLE_GPU_MAX_VERTS);
+    const size_t n = render_build_event_horizon_gpu_lines(a->render_game, out, (size_t)WORMHOLE_GPU_MAX_VERTS);
     a->wormhole_line_vertex_count = (uint32_t)((n > (size_t)UINT32_MAX) ? (size_t)UINT32_MAX : n);
 }
 
@@ -7479,7 +7696,7 @@ static void update_gpu_wormhole_tri_vertices(app* a) {
         return;
     }
     wormhole_line_vertex* out = (wormhole_line_vertex*)a->wormhole_tri_vertex_map;
-    const size_t n = render_build_event_horizon_gpu_tris(&a->game, out, (size_t)WORMHOLE_GPU_MAX_TRI_VERTS);
+    const size_t n = render_build_event_horizon_gpu_tris(a->render_game, out, (size_t)WORMHOLE_GPU_MAX_TRI_VERTS);
     a->wormhole_tri_vertex_count = (uint32_t)((n > (size_t)UINT32_MAX) ? (size_t)UINT32_MAX : n);
 }
 
@@ -7489,12 +7706,12 @@ static void update_gpu_radar_vertices(app* a) {
     }
     {
         wormhole_line_vertex* out = (wormhole_line_vertex*)a->radar_line_vertex_map;
-        const size_t n = render_build_enemy_radar_gpu_lines(&a->game, out, (size_t)RADAR_GPU_MAX_VERTS);
+        const size_t n = render_build_enemy_radar_gpu_lines(a->render_game, out, (size_t)RADAR_GPU_MAX_VERTS);
         a->radar_line_vertex_count = (uint32_t)((n > (size_t)UINT32_MAX) ? (size_t)UINT32_MAX : n);
     }
     {
         wormhole_line_vertex* out = (wormhole_line_vertex*)a->radar_tri_vertex_map;
-        const size_t n = render_build_enemy_radar_gpu_tris(&a->game, out, (size_t)RADAR_GPU_MAX_VERTS);
+        const size_t n = render_build_enemy_radar_gpu_tris(a->render_game, out, (size_t)RADAR_GPU_MAX_VERTS);
         a->radar_tri_vertex_count = (uint32_t)((n > (size_t)UINT32_MAX) ? (size_t)UINT32_MAX : n);
     }
 }
@@ -9644,7 +9861,7 @@ static int desired_structure_tile_atlas_id(const app* a) {
         return TEXTURE_ATLAS_NONE;
     }
     if (menu_is_gameplay(&a->menu)) {
-        const leveldef_level* lvl = game_current_leveldef(&a->game);
+        const leveldef_level* lvl = game_current_leveldef(a->render_game);
         if (lvl && leveldef_level_uses_textured_panels(lvl)) {
             return lvl->texture_atlas_id;
         }
@@ -9856,7 +10073,7 @@ static void update_gpu_high_plains_vertices(app* a) {
     const float h = (float)a->swapchain_extent.height;
     const float y_near = h * 0.04f;
     const float y_far = h * 0.34f;
-    const float cam = a->game.camera_x * 1.75f;
+    const float cam = a->render_game->camera_x * 1.75f;
     const float center_x = w * 0.50f;
     const float col_spacing = w * 0.050f;
     const float col_span = col_spacing * (float)(TERRAIN_COLS - 1);
@@ -9961,7 +10178,7 @@ static void update_gpu_high_plains_vertices(app* a) {
     a->terrain_cache_col_spacing = col_spacing;
     a->terrain_cache_h = h;
 
-    const int draw_wire = (a->game.render_style == LEVEL_RENDER_DRIFTER) ? 1 : a->terrain_wire_enabled;
+    const int draw_wire = (a->render_game->render_style == LEVEL_RENDER_DRIFTER) ? 1 : a->terrain_wire_enabled;
     if (draw_wire && a->terrain_wire_vertex_map) {
         terrain_wire_vertex* wv = (terrain_wire_vertex*)a->terrain_wire_vertex_map;
         uint32_t wi = 0;
@@ -10744,7 +10961,7 @@ static void update_gpu_particle_instances(app* a, int emit_runtime_particles, in
     const int trace_enabled = a->particle_tuning_enabled;
     particle_instance* out = (particle_instance*)a->particle_instance_map;
     uint32_t n = 0;
-    const game_state* g = &a->game;
+    const game_state* g = a->render_game;
     const leveldef_level* lvl = game_current_leveldef(g);
     const int palette_mode = gameplay_palette_mode(a);
     const int use_cyl = level_uses_cylinder_gpu(g);
@@ -10757,26 +10974,33 @@ static void update_gpu_particle_instances(app* a, int emit_runtime_particles, in
     float r_min = 1e9f;
     float r_max = 0.0f;
     if (emit_runtime_particles) {
-        for (size_t i = 0; i < MAX_PARTICLES; ++i) {
-            const particle* p = &g->particles[i];
-            if (!p->active || p->a <= 0.01f || p->size <= 0.10f) {
+        const particle_store* ps = &g->particles;
+        for (int i = 0; i < ps->count; ++i) {
+            const float px = ps->x[i];
+            const float py = ps->y[i];
+            const float pvx = ps->vx[i];
+            const float pvy = ps->vy[i];
+            const float age_s = ps->age_s[i];
+            const float life_s = ps->life_s[i];
+            const int type = ps->type[i];
+            if (ps->a[i] <= 0.01f || ps->size[i] <= 0.10f) {
                 continue;
             }
             if (n >= GPU_PARTICLE_MAX_INSTANCES) {
                 break;
             }
-            float sx = p->b.x;
-            float sy = p->b.y;
+            float sx = px;
+            float sy = py;
             float depth = 1.0f;
-            float radius = p->size;
+            float radius = ps->size[i];
             if (use_cyl) {
-                project_cylinder_point_gpu(g, p->b.x, p->b.y, &sx, &sy, &depth);
+                project_cylinder_point_gpu(g, px, py, &sx, &sy, &depth);
                 radius *= (0.35f + 0.9f * depth);
             } else {
                 /* Match vg foreground world->screen transform:
                    translate(world by -camera, then center in viewport). */
-                sx = p->b.x + g->world_w * 0.5f - g->camera_x;
-                sy = p->b.y + g->world_h * 0.5f - g->camera_y;
+                sx = px + g->world_w * 0.5f - g->camera_x;
+                sy = py + g->world_h * 0.5f - g->camera_y;
             }
             if (sx < -24.0f || sx > g->world_w + 24.0f || sy < -24.0f || sy > g->world_h + 24.0f) {
                 continue;
@@ -10790,9 +11014,9 @@ static void update_gpu_particle_instances(app* a, int emit_runtime_particles, in
             out[n].x = sx;
             out[n].y = sy;
             out[n].radius_px = radius;
-            if (p->type == PARTICLE_POINT) {
+            if (type == PARTICLE_POINT) {
                 out[n].kind = 0.0f;
-            } else if (p->type == PARTICLE_FLASH) {
+            } else if (type == PARTICLE_FLASH) {
                 out[n].kind = 2.0f;
             } else {
                 out[n].kind = 1.0f;
@@ -10801,30 +11025,30 @@ static void update_gpu_particle_instances(app* a, int emit_runtime_particles, in
                 float emission_boost = 1.0f;
                 /* Explosion particles live longer than thruster particles;
                    give them a short spawn-time brightness kick. */
-                if (p->life_s > 0.30f) {
-                    const float life_t = clampf(p->age_s / fmaxf(p->life_s, 1e-5f), 0.0f, 1.0f);
+                if (life_s > 0.30f) {
+                    const float life_t = clampf(age_s / fmaxf(life_s, 1e-5f), 0.0f, 1.0f);
                     const float spawn_t = 1.0f - life_t;
                     emission_boost += 0.55f * spawn_t * spawn_t;
                 }
-                out[n].r = clampf(p->r * emission_boost, 0.0f, 1.0f);
-                out[n].g = clampf(p->g * emission_boost, 0.0f, 1.0f);
-                out[n].b = clampf(p->bcol * emission_boost, 0.0f, 1.0f);
-                out[n].a = p->a;
+                out[n].r = clampf(ps->r[i] * emission_boost, 0.0f, 1.0f);
+                out[n].g = clampf(ps->g[i] * emission_boost, 0.0f, 1.0f);
+                out[n].b = clampf(ps->b[i] * emission_boost, 0.0f, 1.0f);
+                out[n].a = ps->a[i];
             }
             {
-                const float spd = sqrtf(p->b.vx * p->b.vx + p->b.vy * p->b.vy);
+                const float spd = sqrtf(pvx * pvx + pvy * pvy);
                 float dx = 1.0f;
                 float dy = 0.0f;
                 if (spd > 1e-3f) {
-                    dx = p->b.vx / spd;
-                    dy = p->b.vy / spd;
+                    dx = pvx / spd;
+                    dy = pvy / spd;
                 }
-                float life_t = clampf(p->age_s / fmaxf(p->life_s, 1e-5f), 0.0f, 1.0f);
+                float life_t = clampf(age_s / fmaxf(life_s, 1e-5f), 0.0f, 1.0f);
                 float trail = 0.0f;
                 float heat = 0.0f;
-                if (p->type == PARTICLE_FLASH) {
+                if (type == PARTICLE_FLASH) {
                     heat = 2.0f;
-                } else if (p->life_s > 0.30f) {
+                } else if (life_s > 0.30f) {
                     /* Explosion sparks: hot at spawn, with short phosphor streak. */
                     const float speed01 = clampf(spd / 520.0f, 0.0f, 1.0f);
                     trail = speed01 * (1.0f - life_t) * 0.95f * a->particle_trail_gain;
@@ -10901,7 +11125,7 @@ static void update_gpu_particle_instances(app* a, int emit_runtime_particles, in
         fprintf(
             stderr,
             "[particles] gpu=1 lvl=%d n=%u radius_px[min=%.2f avg=%.2f max=%.2f] active=%d\n",
-            g->level_style, n, r_min, r_avg, r_max, g->active_particles
+            g->level_style, n, r_min, r_avg, r_max, g->particles.count
         );
         trace_last_t = g->t;
     }
@@ -10974,7 +11198,7 @@ static void record_gpu_wormhole(app* a, VkCommandBuffer cmd) {
     (void)cmd;
 #else
     if (!a || !cmd || !a->use_gpu_wormhole ||
-        a->game.level_style != LEVEL_STYLE_EVENT_HORIZON ||
+        a->render_game->level_style != LEVEL_STYLE_EVENT_HORIZON ||
         !a->wormhole_line_pipeline || !a->wormhole_depth_pipeline ||
         !a->wormhole_line_vertex_buffer || !a->wormhole_tri_vertex_buffer) {
         return;
@@ -11064,7 +11288,7 @@ static void record_gpu_radar(app* a, VkCommandBuffer cmd) {
     (void)cmd;
 #else
     if (!a || !cmd || !a->use_gpu_radar ||
-        a->game.level_style != LEVEL_STYLE_ENEMY_RADAR ||
+        a->render_game->level_style != LEVEL_STYLE_ENEMY_RADAR ||
         !a->radar_pipeline || !a->radar_fill_pipeline ||
         !a->radar_line_vertex_buffer || !a->radar_tri_vertex_buffer ||
         !a->radar_layout) {
@@ -11157,16 +11381,16 @@ static void record_gpu_fog(app* a, VkCommandBuffer cmd, float t) {
     if (!a || !cmd || !a->fog_pipeline || !a->fog_layout) {
         return;
     }
-    if (a->game.render_style != LEVEL_RENDER_FOG) {
+    if (a->render_game->render_style != LEVEL_RENDER_FOG) {
         return;
     }
 
     fog_pc pc;
     memset(&pc, 0, sizeof(pc));
-    const float world_w = a->game.world_w;
-    const float world_h = a->game.world_h;
-    const float cx = a->game.camera_x;
-    const float cy = a->game.camera_y;
+    const float world_w = a->render_game->world_w;
+    const float world_h = a->render_game->world_h;
+    const float cx = a->render_game->camera_x;
+    const float cy = a->render_game->camera_y;
     const float viewport_h = (float)a->swapchain_extent.height;
     const float to_shader_y = viewport_h; /* helper for top-left world -> shader frag space */
     pc.p0[0] = (float)a->swapchain_extent.width;
@@ -11201,39 +11425,33 @@ static void record_gpu_fog(app* a, VkCommandBuffer cmd, float t) {
     pc.p3[3] = video_quality_uses_cached_fog_noise(a->video_menu_quality) ? -a->fog_flow_scale : a->fog_flow_scale;
 
     int emit_n = 0;
-    if (a->game.lives > 0 && emit_n < 4) {
-        pc.emit[emit_n][0] = a->game.player.b.x + world_w * 0.5f - cx;
-        pc.emit[emit_n][1] = to_shader_y - (a->game.player.b.y + world_h * 0.5f - cy);
+    if (a->render_game->lives > 0 && emit_n < 4) {
+        pc.emit[emit_n][0] = a->render_game->player.b.x + world_w * 0.5f - cx;
+        pc.emit[emit_n][1] = to_shader_y - (a->render_game->player.b.y + world_h * 0.5f - cy);
         pc.emit[emit_n][2] = 180.0f;
         pc.emit[emit_n][3] = 1.0f * a->fog_light_gain;
         emit_n++;
     }
     for (size_t i = 0; i < MAX_ENEMIES && emit_n < 4; ++i) {
-        if (!a->game.enemies[i].active) {
+        if (!a->render_game->enemies[i].active) {
             continue;
         }
-        pc.emit[emit_n][0] = a->game.enemies[i].b.x + world_w * 0.5f - cx;
-        pc.emit[emit_n][1] = to_shader_y - (a->game.enemies[i].b.y + world_h * 0.5f - cy);
+        pc.emit[emit_n][0] = a->render_game->enemies[i].b.x + world_w * 0.5f - cx;
+        pc.emit[emit_n][1] = to_shader_y - (a->render_game->enemies[i].b.y + world_h * 0.5f - cy);
         pc.emit[emit_n][2] = 135.0f;
         pc.emit[emit_n][3] = 0.58f * a->fog_light_gain;
         emit_n++;
     }
-    for (size_t i = 0; i < MAX_BULLETS && emit_n < 4; ++i) {
-        if (!a->game.bullets[i].active) {
-            continue;
-        }
-        pc.emit[emit_n][0] = a->game.bullets[i].b.x + world_w * 0.5f - cx;
-        pc.emit[emit_n][1] = to_shader_y - (a->game.bullets[i].b.y + world_h * 0.5f - cy);
+    for (int i = slot_pool_next(&a->render_game->bullet_pool, 0); i >= 0 && emit_n < 4; i = slot_pool_next(&a->render_game->bullet_pool, i + 1)) {
+        pc.emit[emit_n][0] = a->render_game->bullets[i].b.x + world_w * 0.5f - cx;
+        pc.emit[emit_n][1] = to_shader_y - (a->render_game->bullets[i].b.y + world_h * 0.5f - cy);
         pc.emit[emit_n][2] = 92.0f;
         pc.emit[emit_n][3] = 0.36f * a->fog_light_gain;
         emit_n++;
     }
-    for (size_t i = 0; i < MAX_ENEMY_BULLETS && emit_n < 4; ++i) {
-        if (!a->game.enemy_bullets[i].active) {
-            continue;
-        }
-        pc.emit[emit_n][0] = a->game.enemy_bullets[i].b.x + world_w * 0.5f - cx;
-        pc.emit[emit_n][1] = to_shader_y - (a->game.enemy_bullets[i].b.y + world_h * 0.5f - cy);
+    for (int i = slot_pool_next(&a->render_game->enemy_bullet_pool, 0); i >= 0 && emit_n < 4; i = slot_pool_next(&a->render_game->enemy_bullet_pool, i + 1)) {
+        pc.emit[emit_n][0] = a->render_game->enemy_bullets[i].b.x + world_w * 0.5f - cx;
+        pc.emit[emit_n][1] = to_shader_y - (a->render_game->enemy_bullets[i].b.y + world_h * 0.5f - cy);
         pc.emit[emit_n][2] = 80.0f;
         pc.emit[emit_n][3] = 0.28f * a->fog_light_gain;
         emit_n++;
@@ -11257,17 +11475,17 @@ static void record_gpu_underwater(app* a, VkCommandBuffer cmd, float t) {
     if (!a || !cmd || !a->underwater_pipeline || !a->underwater_layout || !a->underwater_desc_set) {
         return;
     }
-    const leveldef_level* lvl = game_current_leveldef(&a->game);
+    const leveldef_level* lvl = game_current_leveldef(a->render_game);
     if (!lvl || lvl->background_style != LEVELDEF_BACKGROUND_UNDERWATER) {
         return;
     }
 
     underwater_pc pc;
     memset(&pc, 0, sizeof(pc));
-    const float world_w = a->game.world_w;
-    const float world_h = a->game.world_h;
-    const float cx = a->game.camera_x;
-    const float cy = a->game.camera_y;
+    const float world_w = a->render_game->world_w;
+    const float world_h = a->render_game->world_h;
+    const float cx = a->render_game->camera_x;
+    const float cy = a->render_game->camera_y;
     pc.p0[0] = (float)a->swapchain_extent.width;
     pc.p0[1] = (float)a->swapchain_extent.height;
     pc.p0[2] = t;
@@ -11326,17 +11544,17 @@ static void record_gpu_fire(app* a, VkCommandBuffer cmd, float t) {
     if (!a || !cmd || !a->fire_pipeline || !a->underwater_layout || !a->underwater_desc_set) {
         return;
     }
-    const leveldef_level* lvl = game_current_leveldef(&a->game);
+    const leveldef_level* lvl = game_current_leveldef(a->render_game);
     if (!lvl || lvl->background_style != LEVELDEF_BACKGROUND_FIRE) {
         return;
     }
 
     underwater_pc pc;
     memset(&pc, 0, sizeof(pc));
-    const float world_w = a->game.world_w;
-    const float world_h = a->game.world_h;
-    const float cx = a->game.camera_x;
-    const float cy = a->game.camera_y;
+    const float world_w = a->render_game->world_w;
+    const float world_h = a->render_game->world_h;
+    const float cx = a->render_game->camera_x;
+    const float cy = a->render_game->camera_y;
     const int palette_mode = gameplay_palette_mode(a);
 
     pc.p0[0] = (float)a->swapchain_extent.width;
@@ -11403,17 +11621,17 @@ static void record_gpu_ice(app* a, VkCommandBuffer cmd, float t) {
     if (!a || !cmd || !a->ice_pipeline || !a->underwater_layout || !a->underwater_desc_set) {
         return;
     }
-    const leveldef_level* lvl = game_current_leveldef(&a->game);
+    const leveldef_level* lvl = game_current_leveldef(a->render_game);
     if (!lvl || lvl->background_style != LEVELDEF_BACKGROUND_ICE) {
         return;
     }
 
     underwater_pc pc;
     memset(&pc, 0, sizeof(pc));
-    const float world_w = a->game.world_w;
-    const float world_h = a->game.world_h;
-    const float cx = a->game.camera_x;
-    const float cy = a->game.camera_y;
+    const float world_w = a->render_game->world_w;
+    const float world_h = a->render_game->world_h;
+    const float cx = a->render_game->camera_x;
+    const float cy = a->render_game->camera_y;
     const int palette_mode = gameplay_palette_mode(a);
     const float snow_angle_rad = lvl->ice_snow_angle_deg * (3.14159265358979323846f / 180.0f);
 
@@ -11467,17 +11685,17 @@ static void record_gpu_forest_flora(app* a, VkCommandBuffer cmd, float t) {
     if (!a || !cmd || !a->forest_flora_pipeline || !a->underwater_layout || !a->underwater_desc_set) {
         return;
     }
-    const leveldef_level* lvl = game_current_leveldef(&a->game);
+    const leveldef_level* lvl = game_current_leveldef(a->render_game);
     if (!lvl || lvl->background_style != LEVELDEF_BACKGROUND_FOREST) {
         return;
     }
 
     underwater_pc pc;
     memset(&pc, 0, sizeof(pc));
-    const float world_w = a->game.world_w;
-    const float world_h = a->game.world_h;
-    const float cx = a->game.camera_x;
-    const float cy = a->game.camera_y;
+    const float world_w = a->render_game->world_w;
+    const float world_h = a->render_game->world_h;
+    const float cx = a->render_game->camera_x;
+    const float cy = a->render_game->camera_y;
     const int palette_mode = gameplay_palette_mode(a);
 
     pc.p0[0] = (float)a->underwater_kelp_w;
@@ -11538,17 +11756,17 @@ static void record_gpu_forest_cache(app* a, VkCommandBuffer cmd, float t) {
     if (!a || !cmd || !a->forest_cache_pipeline || !a->underwater_layout || !a->underwater_desc_set) {
         return;
     }
-    const leveldef_level* lvl = game_current_leveldef(&a->game);
+    const leveldef_level* lvl = game_current_leveldef(a->render_game);
     if (!lvl || lvl->background_style != LEVELDEF_BACKGROUND_FOREST) {
         return;
     }
 
     underwater_pc pc;
     memset(&pc, 0, sizeof(pc));
-    const float world_w = a->game.world_w;
-    const float world_h = a->game.world_h;
-    const float cx = a->game.camera_x;
-    const float cy = a->game.camera_y;
+    const float world_w = a->render_game->world_w;
+    const float world_h = a->render_game->world_h;
+    const float cx = a->render_game->camera_x;
+    const float cy = a->render_game->camera_y;
 
     pc.p0[0] = (float)a->underwater_kelp_w;
     pc.p0[1] = (float)a->underwater_kelp_h;
@@ -11594,17 +11812,17 @@ static void record_gpu_forest(app* a, VkCommandBuffer cmd, float t) {
     if (!a || !cmd || !a->forest_pipeline || !a->underwater_layout || !a->underwater_desc_set) {
         return;
     }
-    const leveldef_level* lvl = game_current_leveldef(&a->game);
+    const leveldef_level* lvl = game_current_leveldef(a->render_game);
     if (!lvl || lvl->background_style != LEVELDEF_BACKGROUND_FOREST) {
         return;
     }
 
     underwater_pc pc;
     memset(&pc, 0, sizeof(pc));
-    const float world_w = a->game.world_w;
-    const float world_h = a->game.world_h;
-    const float cx = a->game.camera_x;
-    const float cy = a->game.camera_y;
+    const float world_w = a->render_game->world_w;
+    const float world_h = a->render_game->world_h;
+    const float cx = a->render_game->camera_x;
+    const float cy = a->render_game->camera_y;
     const int palette_mode = gameplay_palette_mode(a);
 
     pc.p0[0] = (float)a->swapchain_extent.width;
@@ -11680,17 +11898,17 @@ static void record_gpu_underwater_kelp(app* a, VkCommandBuffer cmd, float t) {
     if (!a || !cmd || !a->underwater_kelp_pipeline || !a->underwater_layout || !a->underwater_desc_set) {
         return;
     }
-    const leveldef_level* lvl = game_current_leveldef(&a->game);
+    const leveldef_level* lvl = game_current_leveldef(a->render_game);
     if (!lvl || lvl->background_style != LEVELDEF_BACKGROUND_UNDERWATER) {
         return;
     }
 
     underwater_pc pc;
     memset(&pc, 0, sizeof(pc));
-    const float world_w = a->game.world_w;
-    const float world_h = a->game.world_h;
-    const float cx = a->game.camera_x;
-    const float cy = a->game.camera_y;
+    const float world_w = a->render_game->world_w;
+    const float world_h = a->render_game->world_h;
+    const float cx = a->render_game->camera_x;
+    const float cy = a->render_game->camera_y;
     pc.p0[0] = (float)a->swapchain_extent.width;
     pc.p0[1] = (float)a->swapchain_extent.height;
     pc.p0[2] = t;
@@ -11757,10 +11975,10 @@ static int gather_grid_sim_sources(const app* a, float out_src[GRID_SIM_MAX_SOUR
     if (!a || !out_src) {
         return 0;
     }
-    const float world_w = a->game.world_w;
-    const float world_h = a->game.world_h;
-    const float cx = a->game.camera_x;
-    const float cy = a->game.camera_y;
+    const float world_w = a->render_game->world_w;
+    const float world_h = a->render_game->world_h;
+    const float cx = a->render_game->camera_x;
+    const float cy = a->render_game->camera_y;
     const float viewport_h = (float)a->swapchain_extent.height;
 
     const float x_min = cx - world_w * 0.75f;
@@ -11768,31 +11986,28 @@ static int gather_grid_sim_sources(const app* a, float out_src[GRID_SIM_MAX_SOUR
     const float y_min = -world_h * 0.25f;
     const float y_max = world_h * 1.25f;
 
-    out_src[n][0] = a->game.player.b.x + world_w * 0.5f - cx;
-    out_src[n][1] = viewport_h - (a->game.player.b.y + world_h * 0.5f - cy);
+    out_src[n][0] = a->render_game->player.b.x + world_w * 0.5f - cx;
+    out_src[n][1] = viewport_h - (a->render_game->player.b.y + world_h * 0.5f - cy);
     out_src[n][2] = 52.0f;
     out_src[n][3] = fmaxf(world_h * 0.18f, 90.0f);
     n++;
 
-    if (a->game.emp_effect_active && n < GRID_SIM_MAX_SOURCES) {
+    if (a->render_game->emp_effect_active && n < GRID_SIM_MAX_SOURCES) {
         const float u = clampf(
-            a->game.emp_effect_t / fmaxf(a->game.emp_effect_duration_s, 1.0e-3f),
+            a->render_game->emp_effect_t / fmaxf(a->render_game->emp_effect_duration_s, 1.0e-3f),
             0.0f,
             1.0f
         );
-        out_src[n][0] = a->game.emp_effect_x + world_w * 0.5f - cx;
-        out_src[n][1] = viewport_h - (a->game.emp_effect_y + world_h * 0.5f - cy);
+        out_src[n][0] = a->render_game->emp_effect_x + world_w * 0.5f - cx;
+        out_src[n][1] = viewport_h - (a->render_game->emp_effect_y + world_h * 0.5f - cy);
         /* Negative amplitude marks a shockwave ring source in grid_sim.frag. */
         out_src[n][2] = -320.0f * (1.0f - 0.28f * u);
-        out_src[n][3] = fmaxf(a->game.emp_blast_radius * (0.08f + 1.05f * u), world_h * 0.05f);
+        out_src[n][3] = fmaxf(a->render_game->emp_blast_radius * (0.08f + 1.05f * u), world_h * 0.05f);
         n++;
     }
 
-    for (int i = 0; i < MAX_MINES && n < GRID_SIM_MAX_SOURCES; ++i) {
-        const mine* m = &a->game.mines[i];
-        if (!m->active) {
-            continue;
-        }
+    for (int i = slot_pool_next(&a->render_game->mine_pool, 0); i >= 0 && n < GRID_SIM_MAX_SOURCES; i = slot_pool_next(&a->render_game->mine_pool, i + 1)) {
+        const mine* m = &a->render_game->mines[i];
         if (m->b.x < x_min || m->b.x > x_max ||
             m->b.y < y_min || m->b.y > y_max) {
             continue;
@@ -11804,11 +12019,8 @@ static int gather_grid_sim_sources(const app* a, float out_src[GRID_SIM_MAX_SOUR
         n++;
     }
 
-    for (int i = 0; i < MAX_MISSILES && n < GRID_SIM_MAX_SOURCES; ++i) {
-        const homing_missile* m = &a->game.missiles[i];
-        if (!m->active) {
-            continue;
-        }
+    for (int i = slot_pool_next(&a->render_game->missile_pool, 0); i >= 0 && n < GRID_SIM_MAX_SOURCES; i = slot_pool_next(&a->render_game->missile_pool, i + 1)) {
+        const homing_missile* m = &a->render_game->missiles[i];
         if (m->b.x < x_min || m->b.x > x_max ||
             m->b.y < y_min || m->b.y > y_max) {
             continue;
@@ -11826,32 +12038,32 @@ static int gather_grid_sim_sources(const app* a, float out_src[GRID_SIM_MAX_SOUR
     }
 
     for (int i = 0; i < MAX_ENEMIES && n < GRID_SIM_MAX_SOURCES; ++i) {
-        if (!a->game.enemies[i].active) {
+        if (!a->render_game->enemies[i].active) {
             continue;
         }
-        if (a->game.enemies[i].b.x < x_min || a->game.enemies[i].b.x > x_max ||
-            a->game.enemies[i].b.y < y_min || a->game.enemies[i].b.y > y_max) {
+        if (a->render_game->enemies[i].b.x < x_min || a->render_game->enemies[i].b.x > x_max ||
+            a->render_game->enemies[i].b.y < y_min || a->render_game->enemies[i].b.y > y_max) {
             continue;
         }
-        out_src[n][0] = a->game.enemies[i].b.x + world_w * 0.5f - cx;
-        out_src[n][1] = viewport_h - (a->game.enemies[i].b.y + world_h * 0.5f - cy);
+        out_src[n][0] = a->render_game->enemies[i].b.x + world_w * 0.5f - cx;
+        out_src[n][1] = viewport_h - (a->render_game->enemies[i].b.y + world_h * 0.5f - cy);
         out_src[n][2] = 34.0f;
-        out_src[n][3] = fmaxf(a->game.enemies[i].radius * 5.2f, 70.0f);
+        out_src[n][3] = fmaxf(a->render_game->enemies[i].radius * 5.2f, 70.0f);
         n++;
     }
-    for (int i = 0; i < MAX_PARTICLES && n < GRID_SIM_MAX_SOURCES; ++i) {
-        const particle* p = &a->game.particles[i];
-        if (!p->active || p->type != PARTICLE_FLASH || p->life_s <= 1.0e-4f) {
+    const particle_store* ps = &a->render_game->particles;
+    for (int i = 0; i < ps->count && n < GRID_SIM_MAX_SOURCES; ++i) {
+        if (ps->type[i] != PARTICLE_FLASH || ps->life_s[i] <= 1.0e-4f) {
             continue;
         }
-        if (p->b.x < x_min || p->b.x > x_max || p->b.y < y_min || p->b.y > y_max) {
+        if (ps->x[i] < x_min || ps->x[i] > x_max || ps->y[i] < y_min || ps->y[i] > y_max) {
             continue;
         }
-        const float t = clampf(1.0f - p->age_s / p->life_s, 0.0f, 1.0f);
-        out_src[n][0] = p->b.x + world_w * 0.5f - cx;
-        out_src[n][1] = viewport_h - (p->b.y + world_h * 0.5f - cy);
+        const float t = clampf(1.0f - ps->age_s[i] / ps->life_s[i], 0.0f, 1.0f);
+        out_src[n][0] = ps->x[i] + world_w * 0.5f - cx;
+        out_src[n][1] = viewport_h - (ps->y[i] + world_h * 0.5f - cy);
         out_src[n][2] = 180.0f * t;
-        out_src[n][3] = fmaxf(p->size * 20.0f, world_h * 0.22f);
+        out_src[n][3] = fmaxf(ps->size[i] * 20.0f, world_h * 0.22f);
         n++;
     }
     return n;
@@ -11866,7 +12078,7 @@ static void record_gpu_grid_sim(app* a, VkCommandBuffer cmd, float dt) {
     if (!a || !cmd || !a->grid_sim_pipeline || !a->grid_sim_layout || !a->grid_state_render_pass) {
         return;
     }
-    const leveldef_level* lvl = game_current_leveldef(&a->game);
+    const leveldef_level* lvl = game_current_leveldef(a->render_game);
     if (!lvl || lvl->background_style != LEVELDEF_BACKGROUND_GRID) {
         reset_grid_sim_state(a);
         return;
@@ -11889,11 +12101,11 @@ static void record_gpu_grid_sim(app* a, VkCommandBuffer cmd, float dt) {
     float cam_dx = 0.0f;
     float cam_dy = 0.0f;
     if (a->grid_state_initialized) {
-        cam_dx = a->game.camera_x - a->grid_prev_camera_x;
-        cam_dy = a->game.camera_y - a->grid_prev_camera_y;
+        cam_dx = a->render_game->camera_x - a->grid_prev_camera_x;
+        cam_dy = a->render_game->camera_y - a->grid_prev_camera_y;
     }
-    a->grid_prev_camera_x = a->game.camera_x;
-    a->grid_prev_camera_y = a->game.camera_y;
+    a->grid_prev_camera_x = a->render_game->camera_x;
+    a->grid_prev_camera_y = a->render_game->camera_y;
 
     float src[GRID_SIM_MAX_SOURCES][4] = {{0}};
     const int src_n = gather_grid_sim_sources(a, src);
@@ -11961,7 +12173,7 @@ static void record_gpu_grid(app* a, VkCommandBuffer cmd) {
     if (!a || !cmd || !a->grid_pipeline || !a->grid_layout) {
         return;
     }
-    const leveldef_level* lvl = game_current_leveldef(&a->game);
+    const leveldef_level* lvl = game_current_leveldef(a->render_game);
     if (!lvl || lvl->background_style != LEVELDEF_BACKGROUND_GRID) {
         return;
     }
@@ -11972,8 +12184,8 @@ static void record_gpu_grid(app* a, VkCommandBuffer cmd) {
 
     grid_pc pc;
     memset(&pc, 0, sizeof(pc));
-    const float world_w = a->game.world_w;
-    const float world_h = a->game.world_h;
+    const float world_w = a->render_game->world_w;
+    const float world_h = a->render_game->world_h;
     pc.p0[0] = (float)a->swapchain_extent.width;
     pc.p0[1] = (float)a->swapchain_extent.height;
     {
@@ -11985,8 +12197,8 @@ static void record_gpu_grid(app* a, VkCommandBuffer cmd) {
     pc.p1[1] = a->grid_render_strain_gain;
     pc.p1[2] = (float)GRID_STATE_W;
     pc.p1[3] = (float)GRID_STATE_H;
-    pc.p4[0] = a->game.camera_x;
-    pc.p4[1] = a->game.camera_y;
+    pc.p4[0] = a->render_game->camera_x;
+    pc.p4[1] = a->render_game->camera_y;
     pc.p4[2] = world_w;
     pc.p4[3] = world_h;
 
@@ -12034,7 +12246,7 @@ static void record_gpu_arc_beam(app* a, VkCommandBuffer cmd, float t) {
         return;
     }
     (void)t;
-    const game_state* g = &a->game;
+    const game_state* g = a->render_game;
     const float gt = g->t;
     if (g->arc_node_count < 2 || g->render_style == LEVEL_RENDER_CYLINDER) {
         return;
@@ -12106,7 +12318,7 @@ static void record_gpu_industry(app* a, VkCommandBuffer cmd, float t) {
     if (!a || !cmd || !a->use_gpu_industry || !a->industry_pipeline || !a->industry_layout || !a->industry_desc_set) {
         return;
     }
-    if (a->game.render_style != LEVEL_RENDER_DEFENDER) {
+    if (a->render_game->render_style != LEVEL_RENDER_DEFENDER) {
         return;
     }
     set_viewport_scissor(cmd, a->swapchain_extent.width, a->swapchain_extent.height);
@@ -12124,11 +12336,11 @@ static void record_gpu_industry(app* a, VkCommandBuffer cmd, float t) {
     } else {
         pc.p1[0] = 0.08f; pc.p1[1] = 0.46f; pc.p1[2] = 0.16f;
     }
-    pc.p1[3] = a->game.camera_x;
-    pc.p2[0] = a->game.world_w;
-    pc.p2[1] = a->game.world_h;
+    pc.p1[3] = a->render_game->camera_x;
+    pc.p2[0] = a->render_game->world_w;
+    pc.p2[1] = a->render_game->world_h;
     pc.p2[2] = (float)a->industry_w / fmaxf((float)a->industry_h, 1.0f);
-    pc.p2[3] = fmaxf(game_current_leveldef(&a->game) ? game_current_leveldef(&a->game)->defender_industry_parallax_speed : 1.0f, 0.0f);
+    pc.p2[3] = fmaxf(game_current_leveldef(a->render_game) ? game_current_leveldef(a->render_game)->defender_industry_parallax_speed : 1.0f, 0.0f);
     vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, a->industry_pipeline);
     vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, a->industry_layout, 0, 1, &a->industry_desc_set, 0, NULL);
     vkCmdPushConstants(cmd, a->industry_layout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(pc), &pc);
@@ -12313,13 +12525,13 @@ static void record_gpu_structure_tiles(app* a, VkCommandBuffer cmd, int pass) {
 
     if (pass == STRUCTURE_TILE_PASS_WORLD) {
         if (menu_is_gameplay(&a->menu)) {
-            const leveldef_level* lvl = game_current_leveldef(&a->game);
+            const leveldef_level* lvl = game_current_leveldef(a->render_game);
             if (!lvl || !leveldef_level_uses_textured_panels(lvl) || lvl->texture_atlas_id != a->current_structure_tile_atlas_id) {
                 return;
             }
             {
-                const float unit_w = a->game.world_w * (float)LEVELDEF_STRUCTURE_GRID_SCALE / (float)(LEVELDEF_STRUCTURE_GRID_W - 1);
-                const float unit_h = a->game.world_h / (float)((LEVELDEF_STRUCTURE_GRID_H - 1) / LEVELDEF_STRUCTURE_GRID_SCALE);
+                const float unit_w = a->render_game->world_w * (float)LEVELDEF_STRUCTURE_GRID_SCALE / (float)(LEVELDEF_STRUCTURE_GRID_W - 1);
+                const float unit_h = a->render_game->world_h / (float)((LEVELDEF_STRUCTURE_GRID_H - 1) / LEVELDEF_STRUCTURE_GRID_SCALE);
                 for (int i = 0; i < lvl->structure_count && i < LEVELDEF_MAX_STRUCTURES; ++i) {
                     const leveldef_structure_instance* st = &lvl->structures[i];
                     if (st->prefab_id != LEVELDEF_STRUCTURE_PREFAB_TEX_PANEL || st->variant < 0) {
@@ -12328,8 +12540,8 @@ static void record_gpu_structure_tiles(app* a, VkCommandBuffer cmd, int pass) {
                     {
                         const float bx = (float)st->grid_x * unit_w;
                         const float by = (float)st->grid_y * unit_h;
-                        const float sx = bx + a->game.world_w * 0.5f - a->game.camera_x;
-                        const float sy = by + a->game.world_h * 0.5f - a->game.camera_y;
+                        const float sx = bx + a->render_game->world_w * 0.5f - a->render_game->camera_x;
+                        const float sy = by + a->render_game->world_h * 0.5f - a->render_game->camera_y;
                         structure_tile_emit(
                             a, cmd,
                             sx, sy,
@@ -12462,7 +12674,7 @@ static void record_gpu_revolver(app* a, VkCommandBuffer cmd, float t, int front_
     if (!a || !cmd || !a->use_gpu_revolver || !a->revolver_pipeline || !a->industry_layout || !a->industry_desc_set) {
         return;
     }
-    if (a->game.level_style != LEVEL_STYLE_REVOLVER) {
+    if (a->render_game->level_style != LEVEL_STYLE_REVOLVER) {
         return;
     }
     set_viewport_scissor(cmd, a->swapchain_extent.width, a->swapchain_extent.height);
@@ -12483,9 +12695,9 @@ static void record_gpu_revolver(app* a, VkCommandBuffer cmd, float t, int front_
     } else {
         pc.p1[0] = 0.08f; pc.p1[1] = 0.46f; pc.p1[2] = 0.16f;
     }
-    pc.p1[3] = a->game.camera_x;
-    pc.p2[0] = a->game.world_w;
-    pc.p2[1] = a->game.world_h;
+    pc.p1[3] = a->render_game->camera_x;
+    pc.p2[0] = a->render_game->world_w;
+    pc.p2[1] = a->render_game->world_h;
     pc.p2[2] = (float)a->industry_w / fmaxf((float)a->industry_h, 1.0f);
     pc.p2[3] = front_only ? 1.0f : 0.0f;
     vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, a->revolver_pipeline);
@@ -12501,8 +12713,8 @@ static void record_gpu_high_plains_terrain(app* a, VkCommandBuffer cmd) {
         return;
     }
     if (!a || !cmd ||
-        (a->game.render_style != LEVEL_RENDER_DRIFTER_SHADED &&
-         a->game.render_style != LEVEL_RENDER_DRIFTER)) {
+        (a->render_game->render_style != LEVEL_RENDER_DRIFTER_SHADED &&
+         a->render_game->render_style != LEVEL_RENDER_DRIFTER)) {
         return;
     }
     if (!a->terrain_fill_pipeline || !a->terrain_line_pipeline || !a->terrain_vertex_buffer) {
@@ -12532,7 +12744,7 @@ static void record_gpu_high_plains_terrain(app* a, VkCommandBuffer cmd) {
     pc.tune[2] = a->terrain_tuning.normal_variation;
     pc.tune[3] = a->terrain_tuning.depth_fade;
 
-    const int draw_fill = (a->game.render_style == LEVEL_RENDER_DRIFTER_SHADED);
+    const int draw_fill = (a->render_game->render_style == LEVEL_RENDER_DRIFTER_SHADED);
     if (draw_fill) {
         vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, a->terrain_fill_pipeline);
         vkCmdPushConstants(cmd, a->terrain_layout, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(pc), &pc);
@@ -12540,7 +12752,7 @@ static void record_gpu_high_plains_terrain(app* a, VkCommandBuffer cmd) {
         vkCmdDrawIndexed(cmd, a->terrain_tri_index_count, 1, 0, 0, 0);
     }
 
-    const int draw_wire = (a->game.render_style == LEVEL_RENDER_DRIFTER) ? 1 : a->terrain_wire_enabled;
+    const int draw_wire = (a->render_game->render_style == LEVEL_RENDER_DRIFTER) ? 1 : a->terrain_wire_enabled;
     if (draw_wire) {
         const float wire_boost = 1.28f;
         pc.color[0] = clampf(pc.color[0] * wire_boost, 0.0f, 1.0f);
@@ -12586,7 +12798,7 @@ static int record_submit_present(
     }
     {
         const int in_gameplay_scene = menu_is_gameplay(&a->menu);
-        const leveldef_level* lvl_bg = game_current_leveldef(&a->game);
+        const leveldef_level* lvl_bg = game_current_leveldef(a->render_game);
         const int use_gpu_grid = (lvl_bg && lvl_bg->background_style == LEVELDEF_BACKGROUND_GRID) ? 1 : 0;
         if (in_gameplay_scene && use_gpu_grid) {
             record_gpu_grid_sim(a, cmd, dt);
@@ -12596,7 +12808,7 @@ static int record_submit_present(
     }
     {
         const int in_gameplay_scene = menu_is_gameplay(&a->menu);
-        const leveldef_level* lvl_bg = game_current_leveldef(&a->game);
+        const leveldef_level* lvl_bg = game_current_leveldef(a->render_game);
         const int use_gpu_underwater = (lvl_bg && lvl_bg->background_style == LEVELDEF_BACKGROUND_UNDERWATER) ? 1 : 0;
         const int use_gpu_forest = (lvl_bg && lvl_bg->background_style == LEVELDEF_BACKGROUND_FOREST) ? 1 : 0;
         if (in_gameplay_scene && a->underwater_kelp_fb &&
@@ -12667,7 +12879,7 @@ static int record_submit_present(
         fprintf(stderr, "VG failure: vg_begin_frame -> %s (%d)\n", vg_result_string(vr), (int)vr);
         return 0;
     }
-    const leveldef_level* lvl_tune = game_current_leveldef(&a->game);
+    const leveldef_level* lvl_tune = game_current_leveldef(a->render_game);
     const int show_grid_tune =
         a->grid_tuning_enabled &&
         a->grid_tuning_show &&
@@ -12677,8 +12889,9 @@ static int record_submit_present(
     render_metrics metrics = {
         .fps = fps,
         .dt = dt,
-        .sim_alpha = clampf(a->sim_accum_s / fmaxf(a->sim_fixed_dt_s, 1.0e-6f), 0.0f, 1.0f),
+        .sim_alpha = a->render_sim_alpha,
         .show_fps = a->show_fps_counter,
+        .show_sim_profile = a->show_sim_profile,
         .ui_time_s = (float)SDL_GetTicks() * 0.001f,
         .force_clear = (a->force_clear_frames > 0) ? 1 : 0,
         .show_crt_ui = a->show_crt_ui,
@@ -12719,10 +12932,10 @@ static int record_submit_present(
         .shipyard_nav_column = a->shipyard_nav_column,
         .shipyard_link_selected = a->shipyard_link_selected,
         .shipyard_weapon_ammo = {
-            game_get_alt_weapon_ammo(&a->game, 0),
-            game_get_alt_weapon_ammo(&a->game, 1),
-            game_get_alt_weapon_ammo(&a->game, 2),
-            game_get_alt_weapon_ammo(&a->game, 3)
+            game_get_alt_weapon_ammo(a->render_game, 0),
+            game_get_alt_weapon_ammo(a->render_game, 1),
+            game_get_alt_weapon_ammo(a->render_game, 2),
+            game_get_alt_weapon_ammo(a->render_game, 3)
         },
         .shipyard_ship_svg_asset = a->shipyard_ship_svg_asset,
         .shipyard_weapon_svg_assets = {
@@ -12752,7 +12965,7 @@ static int record_submit_present(
             ? a->grid_tuning_text
             : ((a->fog_tuning_enabled &&
                                 a->fog_tuning_show &&
-                                a->game.render_style == LEVEL_RENDER_FOG &&
+                                a->render_game->render_style == LEVEL_RENDER_FOG &&
                                 menu_is_gameplay(&a->menu))
             ? a->fog_tuning_text
             : ((a->particle_tuning_enabled &&
@@ -12761,7 +12974,7 @@ static int record_submit_present(
                 ? a->particle_tuning_text
                 : ((a->terrain_tuning_enabled &&
                     a->terrain_tuning_show &&
-                    a->game.render_style == LEVEL_RENDER_DRIFTER_SHADED)
+                    a->render_game->render_style == LEVEL_RENDER_DRIFTER_SHADED)
                     ? a->terrain_tuning_text : NULL))),
         .use_gpu_particles = 0,
         .use_gpu_terrain = 0,
@@ -12954,28 +13167,28 @@ static int record_submit_present(
     {
         const int in_gameplay_scene = menu_is_gameplay(&a->menu);
         const int use_gpu_terrain =
-            (a->game.render_style == LEVEL_RENDER_DRIFTER_SHADED ||
-             a->game.render_style == LEVEL_RENDER_DRIFTER);
+            (a->render_game->render_style == LEVEL_RENDER_DRIFTER_SHADED ||
+             a->render_game->render_style == LEVEL_RENDER_DRIFTER);
         const int use_gpu_wormhole =
             a->use_gpu_wormhole &&
-            (a->game.level_style == LEVEL_STYLE_EVENT_HORIZON);
+            (a->render_game->level_style == LEVEL_STYLE_EVENT_HORIZON);
         const int use_gpu_radar =
             a->use_gpu_radar &&
-            (a->game.level_style == LEVEL_STYLE_ENEMY_RADAR);
+            (a->render_game->level_style == LEVEL_STYLE_ENEMY_RADAR);
         const int use_gpu_arc =
             a->use_gpu_arc &&
-            (a->game.render_style != LEVEL_RENDER_CYLINDER) &&
-            a->game.arc_node_count > 1;
+            (a->render_game->render_style != LEVEL_RENDER_CYLINDER) &&
+            a->render_game->arc_node_count > 1;
         const int use_gpu_particles = a->use_gpu_particles;
-        const leveldef_level* lvl_bg = game_current_leveldef(&a->game);
-        const int use_gpu_fog = (a->game.render_style == LEVEL_RENDER_FOG) ? 1 : 0;
+        const leveldef_level* lvl_bg = game_current_leveldef(a->render_game);
+        const int use_gpu_fog = (a->render_game->render_style == LEVEL_RENDER_FOG) ? 1 : 0;
         const int use_gpu_underwater = (lvl_bg && lvl_bg->background_style == LEVELDEF_BACKGROUND_UNDERWATER) ? 1 : 0;
         const int use_gpu_fire = (lvl_bg && lvl_bg->background_style == LEVELDEF_BACKGROUND_FIRE) ? 1 : 0;
         const int use_gpu_ice = (lvl_bg && lvl_bg->background_style == LEVELDEF_BACKGROUND_ICE) ? 1 : 0;
         const int use_gpu_forest = (lvl_bg && lvl_bg->background_style == LEVELDEF_BACKGROUND_FOREST) ? 1 : 0;
         const int use_gpu_grid = (lvl_bg && lvl_bg->background_style == LEVELDEF_BACKGROUND_GRID) ? 1 : 0;
-        const int use_gpu_industry = a->use_gpu_industry && (a->game.render_style == LEVEL_RENDER_DEFENDER);
-        const int use_gpu_revolver = a->use_gpu_revolver && (a->game.level_style == LEVEL_STYLE_REVOLVER);
+        const int use_gpu_industry = a->use_gpu_industry && (a->render_game->render_style == LEVEL_RENDER_DEFENDER);
+        const int use_gpu_revolver = a->use_gpu_revolver && (a->render_game->level_style == LEVEL_STYLE_REVOLVER);
         const int need_mid_scene_gpu = (use_gpu_terrain || use_gpu_wormhole || use_gpu_radar || use_gpu_revolver || use_gpu_arc || use_gpu_grid);
         const int split_scene =
             in_gameplay_scene &&
@@ -13003,7 +13216,7 @@ static int record_submit_present(
             record_gpu_structure_tiles(a, cmd, STRUCTURE_TILE_PASS_WORLD);
             metrics.scene_phase = 3; /* overlay-no-clear */
             {
-                vr = render_frame(a->vg, &a->game, &metrics);
+                vr = render_frame(a->vg, a->render_game, &metrics);
             }
             if (vr != VG_OK) {
                 fprintf(stderr, "VG failure: render_frame(overlay) -> %s (%d)\n", vg_result_string(vr), (int)vr);
@@ -13028,7 +13241,7 @@ static int record_submit_present(
             record_gpu_structure_tiles(a, cmd, STRUCTURE_TILE_PASS_WORLD);
             metrics.scene_phase = 3; /* overlay-no-clear */
             {
-                vr = render_frame(a->vg, &a->game, &metrics);
+                vr = render_frame(a->vg, a->render_game, &metrics);
             }
             if (vr != VG_OK) {
                 fprintf(stderr, "VG failure: render_frame(overlay) -> %s (%d)\n", vg_result_string(vr), (int)vr);
@@ -13056,7 +13269,7 @@ static int record_submit_present(
             } else {
                 metrics.scene_phase = 1; /* background-only */
                 {
-                    vr = render_frame(a->vg, &a->game, &metrics);
+                    vr = render_frame(a->vg, a->render_game, &metrics);
                 }
                 if (vr != VG_OK) {
                     fprintf(stderr, "VG failure: render_frame(background) -> %s (%d)\n", vg_result_string(vr), (int)vr);
@@ -13128,7 +13341,7 @@ static int record_submit_present(
             record_gpu_structure_tiles(a, cmd, STRUCTURE_TILE_PASS_WORLD);
             metrics.scene_phase = stable_underwater_overlay ? 3 : 2;
             {
-                vr = render_frame(a->vg, &a->game, &metrics);
+                vr = render_frame(a->vg, a->render_game, &metrics);
             }
             if (vr != VG_OK) {
                 fprintf(stderr,
@@ -13151,7 +13364,7 @@ static int record_submit_present(
             metrics.scene_phase = 0;
             record_gpu_structure_tiles(a, cmd, STRUCTURE_TILE_PASS_WORLD);
             {
-                vr = render_frame(a->vg, &a->game, &metrics);
+                vr = render_frame(a->vg, a->render_game, &metrics);
             }
             if (vr != VG_OK) {
                 fprintf(stderr, "VG failure: render_frame -> %s (%d)\n", vg_result_string(vr), (int)vr);
@@ -13228,12 +13441,12 @@ static int record_submit_present(
         vkCmdDraw(cmd, 3, 1, 0, 0);
     }
     if (menu_is_gameplay(&a->menu)) {
-        const leveldef_level* bloom_lvl = game_current_leveldef(&a->game);
+        const leveldef_level* bloom_lvl = game_current_leveldef(a->render_game);
         if (particle_bloom_enabled && bloom_lvl && bloom_lvl->background_style == LEVELDEF_BACKGROUND_FOREST) {
             record_gpu_particles_bloom(a, cmd, 0, 1);
         }
         if (particle_bloom_enabled) {
-            record_gpu_particles_bloom(a, cmd, 1, (a->game.level_style == LEVEL_STYLE_REVOLVER) ? 0 : 1);
+            record_gpu_particles_bloom(a, cmd, 1, (a->render_game->level_style == LEVEL_STYLE_REVOLVER) ? 0 : 1);
         }
     }
     vkCmdEndRenderPass(cmd);
@@ -13342,6 +13555,7 @@ static int record_submit_present(
 int main(void) {
     app a;
     memset(&a, 0, sizeof(a));
+    a.render_game = &a.game;
     a.sim_fixed_dt_s = 1.0f / 120.0f;
     a.sim_accum_s = 0.0f;
     a.sim_max_catchup_steps = 8;
@@ -13350,6 +13564,7 @@ int main(void) {
     a.crt_ui_selected = 0;
     a.crt_ui_mouse_drag = 0;
     a.show_fps_counter = 0;
+    a.show_sim_profile = env_flag_enabled("VTYPE_SIM_PROFILE");
     menu_init(&a.menu);
     a.terrain_wire_enabled = 1;
     a.terrain_tuning_enabled = env_flag_enabled("VTYPE_TERRAIN_TUNING");
@@ -13566,6 +13781,9 @@ int main(void) {
     }
 
     game_init(&a.game, (float)a.swapchain_extent.width, (float)a.swapchain_extent.height);
+    if (env_flag_enabled("VTYPE_AI_LOD_OFF")) {
+        game_set_ai_lod(&a.game, 0);
+    }
     sync_shipyard_weapon_to_game(&a);
     apply_video_lab_controls(&a);
     vg_text_fx_typewriter_set_rate(&a.wave_tty, 0.038f);
@@ -13593,6 +13811,38 @@ int main(void) {
     const float hitch_trace_trigger_ms = env_float_or_default("VTYPE_TRACE_TRIGGER_MS", hitch_trace_ms);
     hitch_trace_ring hitch_ring;
     memset(&hitch_ring, 0, sizeof(hitch_ring));
+    {
+        const char* replay_play_path = getenv("VTYPE_REPLAY_PLAY");
+        const char* replay_record_path = getenv("VTYPE_REPLAY_RECORD");
+        if (replay_play_path && replay_play_path[0]) {
+            a.replay_playing = replay_reader_open(&a.replay_play, replay_play_path);
+            if (a.replay_playing) {
+                fprintf(
+                    stderr,
+                    "replay: playing %s level=%s world=%.0fx%.0f\n",
+                    replay_play_path,
+                    a.replay_play.header.level_name,
+                    a.replay_play.header.world_w,
+                    a.replay_play.header.world_h
+                );
+            }
+        } else if (replay_record_path && replay_record_path[0]) {
+            if (replay_writer_open(&a.replay_rec, replay_record_path)) {
+                fprintf(stderr, "replay: recording to %s\n", replay_record_path);
+            }
+        }
+    }
+    {
+        /* Leave a core each for the render and sim threads. */
+        const int default_workers = (int)clampf((float)(SDL_GetCPUCount() - 2), 0.0f, 3.0f);
+        const int workers = enemy_set_worker_threads((int)env_float_or_default("VTYPE_SIM_WORKERS", (float)default_workers));
+        if (workers > 0) {
+            fprintf(stderr, "sim: %d enemy update helper thread(s)\n", workers);
+        }
+    }
+    if (!env_flag_enabled("VTYPE_SIM_INLINE")) {
+        (void)start_sim_thread(&a);
+    }
 
     while (running) {
         uint64_t hitch_frame_start = 0u;
@@ -13641,7 +13891,9 @@ int main(void) {
                 } else if (ev.key.keysym.sym == SDLK_ESCAPE) {
                     running = 0;
                 } else if (ev.key.keysym.sym == SDLK_n) {
+                    begin_game_edit(&a);
                     game_cycle_level(&a.game);
+                    end_game_edit(&a);
                     a.force_clear_frames = 2;
                     if (!sync_structure_tile_resources_after_state_change(&a, "level cycle")) {
                         running = 0;
@@ -13723,7 +13975,7 @@ int main(void) {
                         menu_back_screen(&a);
                     } else {
                         const leveldef_db* db = (const leveldef_db*)game_leveldef_get();
-                        const char* cur = game_current_level_name(&a.game);
+                        const char* cur = game_current_level_name(a.render_game);
                         if (cur && cur[0]) {
                             int should_reload = 1;
                             /* Preserve unsaved editor state when reopening the editor
@@ -13835,6 +14087,9 @@ int main(void) {
                         a.show_fps_counter = !a.show_fps_counter;
                         set_tty_message(&a, a.show_fps_counter ? "fps counter: on" : "fps counter: off");
                     }
+                } else if (ev.key.keysym.sym == SDLK_p && menu_is_gameplay(&a.menu)) {
+                    a.show_sim_profile = !a.show_sim_profile;
+                    set_tty_message(&a, a.show_sim_profile ? "sim profile: on" : "sim profile: off");
                 } else if (menu_is_screen(&a.menu, APP_SCREEN_ACOUSTICS) && ev.key.keysym.sym == SDLK_g) {
                     if (a.acoustics_page == ACOUSTICS_PAGE_COMBAT) {
                         trigger_explosion_test(&a);
@@ -14229,35 +14484,70 @@ int main(void) {
         if (dt_raw <= 0.0f) dt_raw = 1.0f / 60.0f;
         if (dt_raw > 0.25f) dt_raw = 0.25f;
         if (!controls_ui_active(&a)) {
-            const float max_sim_catchup_s = a.sim_fixed_dt_s * (float)a.sim_max_catchup_steps;
             mod_sync_gameplay_playlist(&a);
-            sync_shipyard_weapon_to_game(&a);
-            a.sim_accum_s += dt_raw;
-            if (a.sim_accum_s > max_sim_catchup_s) {
-                a.sim_accum_s = max_sim_catchup_s;
-            }
-            while (a.sim_accum_s >= a.sim_fixed_dt_s && sim_steps < a.sim_max_catchup_steps) {
-                game_update(&a.game, a.sim_fixed_dt_s, &in);
-                a.sim_accum_s -= a.sim_fixed_dt_s;
-                sim_steps++;
+        }
+        /* Input/command handoff: the only part of the frame that holds sim_lock. */
+        lock_sim(&a);
+        if (!controls_ui_active(&a)) {
+            const float max_sim_catchup_s = a.sim_fixed_dt_s * (float)a.sim_max_catchup_steps;
+            if (!a.replay_playing) {
+                sync_shipyard_weapon_to_game(&a);
+            }
+            if (a.sim_thread) {
+                /* Hold a restart press until a tick has consumed it. */
+                const int restart_pending = a.sim_input.restart || in.restart;
+                a.sim_input = in;
+                a.sim_input.restart = restart_pending;
+                a.sim_thread_run = 1;
+                sim_steps = a.sim_thread_steps;
+                a.sim_thread_steps = 0;
+            } else {
+                a.sim_accum_s += dt_raw;
+                if (a.sim_accum_s > max_sim_catchup_s) {
+                    a.sim_accum_s = max_sim_catchup_s;
+                }
+                while (a.sim_accum_s >= a.sim_fixed_dt_s && sim_steps < a.sim_max_catchup_steps) {
+                    step_game(&a, &in);
+                    a.sim_accum_s -= a.sim_fixed_dt_s;
+                    sim_steps++;
+                }
             }
-            update_level_start_teletype(&a);
         } else {
             a.sim_accum_s = 0.0f;
+            a.sim_thread_run = 0;
+            memset(&a.sim_input, 0, sizeof(a.sim_input));
         }
         if (hitch_trace_enabled || hitch_trace_ring_enabled) {
             hitch_after_sim = SDL_GetPerformanceCounter();
         }
+        game_audio_event game_events[MAX_AUDIO_EVENTS];
+        char wave_msg[160];
+        const int fire_events = game_pop_fire_sfx_count(&a.game);
+        const int game_event_count = game_pop_audio_events(&a.game, game_events, MAX_AUDIO_EVENTS);
+        const int wave_announced = game_pop_wave_announcement(&a.game, wave_msg, sizeof(wave_msg));
+        /* Re-applied every frame: restarts via game_init and replay playback clear the flag. */
+        game_profile_set_enabled(&a.game.profile, a.show_sim_profile || hitch_trace_enabled || hitch_trace_ring_enabled);
+        if (a.sim_thread && !a.sim_thread_run) {
+            /* Menus and editors change game while the sim is parked; show them immediately. */
+            publish_sim_snapshot(&a);
+        }
+        unlock_sim(&a);
+        acquire_render_snapshot(&a);
+
+        if (!controls_ui_active(&a)) {
+            update_level_start_teletype(&a);
+        }
         if (a.audio_ready) {
+            const game_state* ag = a.render_game;
             const int thrust_on = (!controls_ui_active(&a)) &&
-                                  (in.left || in.right || in.up || in.down) && (a.game.lives > 0);
+                                  (in.left || in.right || in.up || in.down) && (ag->lives > 0);
             const float speed01 = clampf(
-                sqrtf(a.game.player.b.vx * a.game.player.b.vx + a.game.player.b.vy * a.game.player.b.vy) /
-                    fmaxf(a.game.player.max_speed, 1.0f),
+                sqrtf(ag->player.b.vx * ag->player.b.vx + ag->player.b.vy * ag->player.b.vy) /
+                    fmaxf(ag->player.max_speed, 1.0f),
                 0.0f,
                 1.0f
             );
-            const float height01 = clampf(a.game.player.b.y / fmaxf(a.game.world_h, 1.0f), 0.0f, 1.0f);
+            const float height01 = clampf(ag->player.b.y / fmaxf(ag->world_h, 1.0f), 0.0f, 1.0f);
             const float thruster_cutoff_mod01 = clampf(speed01 * 0.58f + height01 * 0.42f, 0.0f, 1.0f);
             atomic_store_explicit(&a.thrust_gate, thrust_on ? 1 : 0, memory_order_release);
             atomic_store_explicit(
@@ -14265,12 +14555,12 @@ int main(void) {
                 (uint32_t)clampf(thruster_cutoff_mod01 * 65535.0f, 0.0f, 65535.0f),
                 memory_order_release
             );
-            atomic_store_explicit(&a.shield_gate, a.game.shield_active ? 1 : 0, memory_order_release);
-            atomic_store_explicit(&a.lightning_gate, a.game.lightning_active ? 1 : 0, memory_order_release);
+            atomic_store_explicit(&a.shield_gate, ag->shield_active ? 1 : 0, memory_order_release);
+            atomic_store_explicit(&a.lightning_gate, ag->lightning_active ? 1 : 0, memory_order_release);
             {
-                const uint32_t g16 = (uint32_t)clampf(a.game.lightning_audio_gain * 65535.0f, 0.0f, 65535.0f);
+                const uint32_t g16 = (uint32_t)clampf(ag->lightning_audio_gain * 65535.0f, 0.0f, 65535.0f);
                 atomic_store_explicit(&a.lightning_gain_u16, g16, memory_order_release);
-                const int p16 = (int)clampf(a.game.lightning_audio_pan * 32767.0f, -32767.0f, 32767.0f);
+                const int p16 = (int)clampf(ag->lightning_audio_pan * 32767.0f, -32767.0f, 32767.0f);
                 atomic_store_explicit(&a.lightning_pan_i16, p16, memory_order_release);
             }
             {
@@ -14279,36 +14569,22 @@ int main(void) {
                 const uint32_t u16 = (uint32_t)clampf(phase01 * 65535.0f, 0.0f, 65535.0f);
                 atomic_store_explicit(&a.shield_lfo_phase_u16, u16, memory_order_release);
             }
-        }
-        if (a.audio_ready) {
-            const int fire_events = game_pop_fire_sfx_count(&a.game);
             if (fire_events > 0) {
                 atomic_fetch_add_explicit(&a.pending_fire_events, (unsigned int)fire_events, memory_order_acq_rel);
             }
-            game_audio_event game_events[MAX_AUDIO_EVENTS];
-            const int game_event_count = game_pop_audio_events(&a.game, game_events, MAX_AUDIO_EVENTS);
             for (int i = 0; i < game_event_count; ++i) {
                 float pan = 0.0f;
                 float gain = 1.0f;
                 audio_spatial_params_from_world(&a, game_events[i].x, game_events[i].y, &pan, &gain);
                 (void)audio_spatial_enqueue(&a, (uint8_t)game_events[i].type, pan, gain);
             }
-            atomic_store_explicit(&a.audio_weapon_level, a.game.weapon_level, memory_order_release);
-        } else {
-            (void)game_pop_fire_sfx_count(&a.game);
-            {
-                game_audio_event sink[MAX_AUDIO_EVENTS];
-                (void)game_pop_audio_events(&a.game, sink, MAX_AUDIO_EVENTS);
-            }
+            atomic_store_explicit(&a.audio_weapon_level, ag->weapon_level, memory_order_release);
         }
-        {
-            char wave_msg[160];
-            if (game_pop_wave_announcement(&a.game, wave_msg, sizeof(wave_msg))) {
-                set_tty_message(&a, wave_msg);
-            }
-            (void)vg_text_fx_typewriter_update(&a.wave_tty, dt_raw);
-            (void)vg_text_fx_typewriter_copy_visible(&a.wave_tty, a.wave_tty_visible, sizeof(a.wave_tty_visible));
+        if (wave_announced) {
+            set_tty_message(&a, wave_msg);
         }
+        (void)vg_text_fx_typewriter_update(&a.wave_tty, dt_raw);
+        (void)vg_text_fx_typewriter_copy_visible(&a.wave_tty, a.wave_tty_visible, sizeof(a.wave_tty_visible));
         vg_text_fx_marquee_update(&a.planetarium_marquee, dt_raw);
         if (a.audio_ready) {
             float rb_tmp[256];
@@ -14416,14 +14692,18 @@ int main(void) {
             hitch_frame.submit_present_ms = (float)(hitch_after_submit_present - hitch_after_image_wait) * 1000.0f / freq;
             hitch_frame.submit = submit_trace_data;
             hitch_frame.menu_screen = a.menu.current;
-            SDL_strlcpy(hitch_frame.level_name, game_current_level_name(&a.game), sizeof(hitch_frame.level_name));
+            SDL_strlcpy(hitch_frame.level_name, game_current_level_name(a.render_game), sizeof(hitch_frame.level_name));
+            hitch_frame.sim_profile_valid = a.render_game->profile.enabled;
+            for (int s = 0; hitch_frame.sim_profile_valid && s < GAME_PROFILE_SECTION_COUNT; ++s) {
+                hitch_frame.sim_section_ms[s] = game_profile_recent_us(&a.render_game->profile, s, sim_steps) * 0.001f;
+            }
             if (hitch_trace_ring_enabled) {
                 hitch_trace_ring_push(&hitch_ring, &hitch_frame);
             }
             if (hitch_trace_enabled && hitch_frame.total_ms >= hitch_trace_ms) {
                 fprintf(
                     stderr,
-                    "[hitch] total=%.2fms dt=%.2fms sim_steps=%d sim=%.2f audio_ui=%.2f frame_wait=%.2f structure_tiles=%.2f acquire=%.2f image_wait=%.2f submit_present=%.2f record=%.2f vg=%.2f post=%.2f end_cmd=%.2f submit=%.2f present=%.2f gpu_total=%.2f gpu_scene=%.2f gpu_bloom=%.2f gpu_comp=%.2f gpu_valid=%d menu=%d level=%s\n",
+                    "[hitch] total=%.2fms dt=%.2fms sim_steps=%d sim=%.2f audio_ui=%.2f frame_wait=%.2f structure_tiles=%.2f acquire=%.2f image_wait=%.2f submit_present=%.2f record=%.2f vg=%.2f post=%.2f end_cmd=%.2f submit=%.2f present=%.2f gpu_total=%.2f gpu_scene=%.2f gpu_bloom=%.2f gpu_comp=%.2f gpu_valid=%d menu=%d level=%s",
                     hitch_frame.total_ms,
                     hitch_frame.dt_ms,
                     hitch_frame.sim_steps,
@@ -14448,6 +14728,7 @@ int main(void) {
                     hitch_frame.menu_screen,
                     hitch_frame.level_name
                 );
+                hitch_trace_print_sim_sections(stderr, &hitch_frame);
             }
             if (hitch_trace_ring_enabled && hitch_frame.total_ms >= hitch_trace_trigger_ms) {
                 hitch_trace_ring_dump(&hitch_ring, &hitch_frame);
@@ -0,0 +1,135 @@
+#include "particle_store.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+void particle_store_clear(particle_store* s) {
+    if (!s) {
+        return;
+    }
+    s->count = 0;
+}
+
+/* Appends a zeroed particle and returns its index, or -1 when full. */
+int particle_store_alloc(particle_store* s) {
+    int i;
+    if (!s || s->count >= PARTICLE_STORE_CAP) {
+        return -1;
+    }
+    i = s->count++;
+    s->x[i] = 0.0f;
+    s->y[i] = 0.0f;
+    s->vx[i] = 0.0f;
+    s->vy[i] = 0.0f;
+    s->ax[i] = 0.0f;
+    s->ay[i] = 0.0f;
+    s->age_s[i] = 0.0f;
+    s->life_s[i] = 0.0f;
+    s->size[i] = 0.0f;
+    s->spin[i] = 0.0f;
+    s->spin_rate[i] = 0.0f;
+    s->r[i] = 0.0f;
+    s->g[i] = 0.0f;
+    s->b[i] = 0.0f;
+    s->a[i] = 0.0f;
+    s->type[i] = 0u;
+    return i;
+}
+
+void particle_store_remove(particle_store* s, int i) {
+    int last;
+    if (!s || i < 0 || i >= s->count) {
+        return;
+    }
+    last = --s->count;
+    if (i == last) {
+        return;
+    }
+    s->x[i] = s->x[last];
+    s->y[i] = s->y[last];
+    s->vx[i] = s->vx[last];
+    s->vy[i] = s->vy[last];
+    s->ax[i] = s->ax[last];
+    s->ay[i] = s->ay[last];
+    s->age_s[i] = s->age_s[last];
+    s->life_s[i] = s->life_s[last];
+    s->size[i] = s->size[last];
+    s->spin[i] = s->spin[last];
+    s->spin_rate[i] = s->spin_rate[last];
+    s->r[i] = s->r[last];
+    s->g[i] = s->g[last];
+    s->b[i] = s->b[last];
+    s->a[i] = s->a[last];
+    s->type[i] = s->type[last];
+}
+
+/*
+ * Ages every particle and advances spin and body by one explicit Euler step.
+ * Vector lanes do the same mul-then-add per element as the scalar tail, so
+ * results match the scalar path bit for bit.
+ */
+void particle_store_integrate(particle_store* s, float dt) {
+    int i = 0;
+    int n;
+    if (!s) {
+        return;
+    }
+    n = s->count;
+#if defined(__AVX__)
+    {
+        const __m256 vdt = _mm256_set1_ps(dt);
+        for (; i + 8 <= n; i += 8) {
+            const __m256 vx = _mm256_add_ps(_mm256_loadu_ps(&s->vx[i]), _mm256_mul_ps(_mm256_loadu_ps(&s->ax[i]), vdt));
+            const __m256 vy = _mm256_add_ps(_mm256_loadu_ps(&s->vy[i]), _mm256_mul_ps(_mm256_loadu_ps(&s->ay[i]), vdt));
+            _mm256_storeu_ps(&s->age_s[i], _mm256_add_ps(_mm256_loadu_ps(&s->age_s[i]), vdt));
+            _mm256_storeu_ps(&s->spin[i], _mm256_add_ps(_mm256_loadu_ps(&s->spin[i]), _mm256_mul_ps(_mm256_loadu_ps(&s->spin_rate[i]), vdt)));
+            _mm256_storeu_ps(&s->vx[i], vx);
+            _mm256_storeu_ps(&s->vy[i], vy);
+            _mm256_storeu_ps(&s->x[i], _mm256_add_ps(_mm256_loadu_ps(&s->x[i]), _mm256_mul_ps(vx, vdt)));
+            _mm256_storeu_ps(&s->y[i], _mm256_add_ps(_mm256_loadu_ps(&s->y[i]), _mm256_mul_ps(vy, vdt)));
+        }
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    {
+        const __m128 vdt = _mm_set1_ps(dt);
+        for (; i + 4 <= n; i += 4) {
+            const __m128 vx = _mm_add_ps(_mm_loadu_ps(&s->vx[i]), _mm_mul_ps(_mm_loadu_ps(&s->ax[i]), vdt));
+            const __m128 vy = _mm_add_ps(_mm_loadu_ps(&s->vy[i]), _mm_mul_ps(_mm_loadu_ps(&s->ay[i]), vdt));
+            _mm_storeu_ps(&s->age_s[i], _mm_add_ps(_mm_loadu_ps(&s->age_s[i]), vdt));
+            _mm_storeu_ps(&s->spin[i], _mm_add_ps(_mm_loadu_ps(&s->spin[i]), _mm_mul_ps(_mm_loadu_ps(&s->spin_rate[i]), vdt)));
+            _mm_storeu_ps(&s->vx[i], vx);
+            _mm_storeu_ps(&s->vy[i], vy);
+            _mm_storeu_ps(&s->x[i], _mm_add_ps(_mm_loadu_ps(&s->x[i]), _mm_mul_ps(vx, vdt)));
+            _mm_storeu_ps(&s->y[i], _mm_add_ps(_mm_loadu_ps(&s->y[i]), _mm_mul_ps(vy, vdt)));
+        }
+    }
+#elif defined(__ARM_NEON)
+    {
+        /* vmulq + vaddq rather than vfmaq so rounding matches the scalar tail. */
+        const float32x4_t vdt = vdupq_n_f32(dt);
+        for (; i + 4 <= n; i += 4) {
+            const float32x4_t vx = vaddq_f32(vld1q_f32(&s->vx[i]), vmulq_f32(vld1q_f32(&s->ax[i]), vdt));
+            const float32x4_t vy = vaddq_f32(vld1q_f32(&s->vy[i]), vmulq_f32(vld1q_f32(&s->ay[i]), vdt));
+            vst1q_f32(&s->age_s[i], vaddq_f32(vld1q_f32(&s->age_s[i]), vdt));
+            vst1q_f32(&s->spin[i], vaddq_f32(vld1q_f32(&s->spin[i]), vmulq_f32(vld1q_f32(&s->spin_rate[i]), vdt)));
+            vst1q_f32(&s->vx[i], vx);
+            vst1q_f32(&s->vy[i], vy);
+            vst1q_f32(&s->x[i], vaddq_f32(vld1q_f32(&s->x[i]), vmulq_f32(vx, vdt)));
+            vst1q_f32(&s->y[i], vaddq_f32(vld1q_f32(&s->y[i]), vmulq_f32(vy, vdt)));
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        s->age_s[i] += dt;
+        s->spin[i] += s->spin_rate[i] * dt;
+        s->vx[i] += s->ax[i] * dt;
+        s->vy[i] += s->ay[i] * dt;
+        s->x[i] += s->vx[i] * dt;
+        s->y[i] += s->vy[i] * dt;
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef V_TYPE_PARTICLE_STORE_H
+#define V_TYPE_PARTICLE_STORE_H
+
+#include <stdint.h>
+
+#ifndef PARTICLE_STORE_CAP
+#define PARTICLE_STORE_CAP 1024 /* game_state holds the store inline; stress builds raise it. */
+#endif
+
+/*
+ * Live particles stored column-wise and densely packed: entries [0, count)
+ * are alive, removal swaps the last entry into the hole. Render and GPU
+ * upload walk the same dense range, so they never touch dead slots.
+ */
+typedef struct particle_store {
+    int count;
+    float x[PARTICLE_STORE_CAP];
+    float y[PARTICLE_STORE_CAP];
+    float vx[PARTICLE_STORE_CAP];
+    float vy[PARTICLE_STORE_CAP];
+    float ax[PARTICLE_STORE_CAP];
+    float ay[PARTICLE_STORE_CAP];
+    float age_s[PARTICLE_STORE_CAP];
+    float life_s[PARTICLE_STORE_CAP];
+    float size[PARTICLE_STORE_CAP];
+    float spin[PARTICLE_STORE_CAP];
+    float spin_rate[PARTICLE_STORE_CAP];
+    float r[PARTICLE_STORE_CAP];
+    float g[PARTICLE_STORE_CAP];
+    float b[PARTICLE_STORE_CAP];
+    float a[PARTICLE_STORE_CAP];
+    uint8_t type[PARTICLE_STORE_CAP]; /* enum particle_type */
+} particle_store;
+
+void particle_store_clear(particle_store* s);
+int particle_store_alloc(particle_store* s);
+void particle_store_remove(particle_store* s, int i);
+void particle_store_integrate(particle_store* s, float dt);
+
+#endif
@@ -46,12 +46,40 @@ typedef struct wormhole_cache {
     float row_fade[WORMHOLE_ROWS];
 } wormhole_cache;
 
+typedef struct render_enemy_pose {
+    float x;
+    float y;
+    float facing_x;
+    float facing_y;
+} render_enemy_pose;
+
+/*
+ * Interpolated poses for one render_frame call, filled for live entities only.
+ * Everything that does not move between ticks is read from the current state.
+ */
+typedef struct render_view {
+    const game_state* g;
+    float camera_x;
+    float player_x;
+    float player_y;
+    float player_facing_x;
+    vg_vec2 bullets[MAX_BULLETS];
+    vg_vec2 enemy_bullets[MAX_ENEMY_BULLETS];
+    vg_vec2 missiles[MAX_MISSILES];
+    float missile_heading[MAX_MISSILES];
+    render_enemy_pose enemies[MAX_ENEMIES];
+    enemy_eel_spine eel_spines[MAX_ENEMIES]; /* Filled for live eels only. */
+    int live_enemies[MAX_ENEMIES]; /* Live enemy slots in ascending order. */
+    int live_enemy_count;
+} render_view;
+
 static float repeatf(float v, float period);
 static int wrapi(int i, int n);
 static float lerpf(float a, float b, float t);
 static int level_uses_cylinder_render(const game_state* g);
 static float cylinder_period(const game_state* g);
 static vg_vec2 project_cylinder_point(const game_state* g, float x, float y, float* depth01);
+static vg_vec2 project_view_point(const render_view* v, float x, float y, float* depth01);
 static vg_result draw_structure_prefab_tile(
     vg_context* ctx,
     int prefab_id,
@@ -169,7 +197,7 @@ static int rects_intersect(
 }
 
 static void world_view_bounds(
-    const game_state* g,
+    const render_view* v,
     float pad_x,
     float pad_y,
     float* out_min_x,
@@ -177,16 +205,17 @@ static void world_view_bounds(
     float* out_max_x,
     float* out_max_y
 ) {
+    const game_state* g = v->g;
     const float hw = g->world_w * 0.5f;
     const float hh = g->world_h * 0.5f;
     if (out_min_x) {
-        *out_min_x = g->camera_x - hw - pad_x;
+        *out_min_x = v->camera_x - hw - pad_x;
     }
     if (out_min_y) {
         *out_min_y = g->camera_y - hh - pad_y;
     }
     if (out_max_x) {
-        *out_max_x = g->camera_x + hw + pad_x;
+        *out_max_x = v->camera_x + hw + pad_x;
     }
     if (out_max_y) {
         *out_max_y = g->camera_y + hh + pad_y;
@@ -898,53 +927,95 @@ static float lerp_world_x(const game_state* g, float prev_x, float curr_x, float
     return lerpf(prev_x, curr_x, t);
 }
 
-static void interpolate_body_render(const game_state* g, body* dst, const body* prev, const body* curr, float alpha) {
-    if (!dst || !curr) {
-        return;
-    }
-    if (!prev) {
-        *dst = *curr;
-        return;
-    }
-    *dst = *curr;
-    dst->x = lerp_world_x(g, prev->x, curr->x, alpha);
-    dst->y = lerpf(prev->y, curr->y, alpha);
+static vg_vec2 lerp_body_render(const game_state* g, const render_pose* prev, const body* curr, float alpha) {
+    return (vg_vec2){lerp_world_x(g, prev->x, curr->x, alpha), lerpf(prev->y, curr->y, alpha)};
 }
 
-static void interpolate_enemy_render(enemy* dst, const game_state* g, const enemy* prev, const enemy* curr, float alpha) {
-    if (!dst || !curr) {
-        return;
-    }
-    *dst = *curr;
-    if (!prev || !prev->active || !curr->active) {
-        return;
+static void build_render_view(render_view* v, const game_state* g, float alpha) {
+    v->g = g;
+    v->camera_x = lerpf(g->prev_camera_x, g->camera_x, alpha);
+    {
+        const vg_vec2 pp = lerp_body_render(g, &g->prev_player, &g->player.b, alpha);
+        v->player_x = pp.x;
+        v->player_y = pp.y;
+    }
+    v->player_facing_x = lerpf(g->prev_player.facing_x, g->player.facing_x, alpha);
+    for (int i = slot_pool_next(&g->bullet_pool, 0); i >= 0; i = slot_pool_next(&g->bullet_pool, i + 1)) {
+        const body* curr = &g->bullets[i].b;
+        v->bullets[i] = slot_pool_has(&g->prev_bullet_pool, i) ? lerp_body_render(g, &g->prev_bullets[i], curr, alpha) : (vg_vec2){curr->x, curr->y};
+    }
+    for (int i = slot_pool_next(&g->enemy_bullet_pool, 0); i >= 0; i = slot_pool_next(&g->enemy_bullet_pool, i + 1)) {
+        const body* curr = &g->enemy_bullets[i].b;
+        v->enemy_bullets[i] =
+            slot_pool_has(&g->prev_enemy_bullet_pool, i) ? lerp_body_render(g, &g->prev_enemy_bullets[i], curr, alpha) : (vg_vec2){curr->x, curr->y};
+    }
+    for (int i = slot_pool_next(&g->missile_pool, 0); i >= 0; i = slot_pool_next(&g->missile_pool, i + 1)) {
+        const homing_missile* curr = &g->missiles[i];
+        if (slot_pool_has(&g->prev_missile_pool, i)) {
+            v->missiles[i] = lerp_body_render(g, &g->prev_missiles[i], &curr->b, alpha);
+            v->missile_heading[i] = lerpf(g->prev_missile_heading[i], curr->heading_rad, alpha);
+        } else {
+            v->missiles[i] = (vg_vec2){curr->b.x, curr->b.y};
+            v->missile_heading[i] = curr->heading_rad;
+        }
     }
-    interpolate_body_render(g, &dst->b, &prev->b, &curr->b, alpha);
-    dst->facing_x = lerpf(prev->facing_x, curr->facing_x, alpha);
-    dst->facing_y = lerpf(prev->facing_y, curr->facing_y, alpha);
-    if (curr->visual_kind == ENEMY_VISUAL_EEL && prev->visual_kind == ENEMY_VISUAL_EEL) {
-        const int spine_n = clampi(curr->eel_spine_count, 0, EEL_SPINE_POINTS);
-        const int prev_spine_n = clampi(prev->eel_spine_count, 0, EEL_SPINE_POINTS);
-        const int interp_n = (spine_n < prev_spine_n) ? spine_n : prev_spine_n;
-        for (int i = 0; i < interp_n; ++i) {
-            dst->eel_spine_x[i] = lerp_world_x(g, prev->eel_spine_x[i], curr->eel_spine_x[i], alpha);
-            dst->eel_spine_y[i] = lerpf(prev->eel_spine_y[i], curr->eel_spine_y[i], alpha);
+    v->live_enemy_count = 0;
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const render_enemy_prev* prev = &g->prev_enemies[i];
+        const enemy* curr = &g->enemies[i];
+        render_enemy_pose* p = &v->enemies[i];
+        if (!curr->active) {
+            continue;
         }
+        v->live_enemies[v->live_enemy_count++] = i;
+        if (curr->visual_kind == ENEMY_VISUAL_EEL) {
+            const enemy_eel_spine* cs = &g->eel_spines[i];
+            const enemy_eel_spine* ps = &g->prev_eel_spines[i];
+            enemy_eel_spine* vs = &v->eel_spines[i];
+            const int spine_n = clampi(cs->count, 0, EEL_SPINE_POINTS);
+            const int blend_n = prev->active ? ((spine_n < ps->count) ? spine_n : ps->count) : 0;
+            vs->count = spine_n;
+            for (int si = 0; si < blend_n; ++si) {
+                vs->x[si] = lerp_world_x(g, ps->x[si], cs->x[si], alpha);
+                vs->y[si] = lerpf(ps->y[si], cs->y[si], alpha);
+            }
+            memcpy(vs->x + blend_n, cs->x + blend_n, (size_t)(spine_n - blend_n) * sizeof(cs->x[0]));
+            memcpy(vs->y + blend_n, cs->y + blend_n, (size_t)(spine_n - blend_n) * sizeof(cs->y[0]));
+        }
+        if (!prev->active) {
+            p->x = curr->b.x;
+            p->y = curr->b.y;
+            p->facing_x = curr->facing_x;
+            p->facing_y = curr->facing_y;
+            continue;
+        }
+        {
+            const vg_vec2 ep = lerp_body_render(g, &prev->pose, &curr->b, alpha);
+            p->x = ep.x;
+            p->y = ep.y;
+        }
+        p->facing_x = lerpf(prev->pose.facing_x, curr->facing_x, alpha);
+        p->facing_y = lerpf(prev->pose.facing_y, curr->facing_y, alpha);
     }
 }
 
-static void interpolate_missile_render(homing_missile* dst, const game_state* g, const homing_missile* prev, const homing_missile* curr, float alpha) {
-    if (!dst || !curr) {
-        return;
-    }
-    *dst = *curr;
-    if (!prev || !prev->active || !curr->active) {
-        return;
+/* Copies enemy i into scratch with its interpolated pose applied. */
+static const enemy* view_enemy(const render_view* v, int i, enemy* scratch) {
+    const render_enemy_pose* p = &v->enemies[i];
+    *scratch = v->g->enemies[i];
+    scratch->b.x = p->x;
+    scratch->b.y = p->y;
+    scratch->facing_x = p->facing_x;
+    scratch->facing_y = p->facing_y;
+    return scratch;
+}
+
+/* Interpolated spine for enemy i, or NULL unless it is an eel. */
+static const enemy_eel_spine* view_eel_spine(const render_view* v, int i) {
+    if (v->g->enemies[i].visual_kind != ENEMY_VISUAL_EEL) {
+        return NULL;
     }
-    interpolate_body_render(g, &dst->b, &prev->b, &curr->b, alpha);
-    dst->heading_rad = lerpf(prev->heading_rad, curr->heading_rad, alpha);
-    dst->forward_x = lerpf(prev->forward_x, curr->forward_x, alpha);
-    dst->forward_y = lerpf(prev->forward_y, curr->forward_y, alpha);
+    return &v->eel_spines[i];
 }
 
 static int level_uses_cylinder_render(const game_state* g) {
@@ -1097,10 +1168,11 @@ static vg_result draw_window_frame_accents(
 
 static vg_result draw_background_window_mask_overlays(
     vg_context* ctx,
-    const game_state* g,
+    const render_view* v,
     const vg_stroke_style* halo,
     const vg_stroke_style* main
 ) {
+    const game_state* g = v->g;
     if (!ctx || !g || !halo || !main) {
         return VG_OK;
     }
@@ -1138,7 +1210,7 @@ static vg_result draw_background_window_mask_overlays(
     for (int i = 0; i < lvl->window_mask_count && i < LEVELDEF_MAX_WINDOW_MASKS; ++i) {
         const leveldef_window_mask* wm = &lvl->window_masks[i];
         const float center_world_x = wm->anchor_x01 * g->world_w;
-        const float cx = center_world_x - g->camera_x + g->world_w * 0.5f;
+        const float cx = center_world_x - v->camera_x + g->world_w * 0.5f;
         const float cy = wm->anchor_y01 * g->world_h;
         const float ww = wm->width_h01 * g->world_w;
         const float wh = wm->height_v01 * g->world_h;
@@ -1190,7 +1262,8 @@ static vg_result draw_background_window_mask_overlays(
     return VG_OK;
 }
 
-static int star_visible_with_mask(const game_state* g, float sx, float sy) {
+static int star_visible_with_mask(const render_view* v, float sx, float sy) {
+    const game_state* g = v->g;
     const int mask = level_background_mask_style(g);
     if (!g || mask == LEVELDEF_BG_MASK_NONE) {
         return 1;
@@ -1211,7 +1284,7 @@ static int star_visible_with_mask(const game_state* g, float sx, float sy) {
         for (int i = 0; i < lvl->window_mask_count && i < LEVELDEF_MAX_WINDOW_MASKS; ++i) {
             const leveldef_window_mask* wm = &lvl->window_masks[i];
             const float center_world_x = wm->anchor_x01 * g->world_w;
-            const float center_screen_x = center_world_x - g->camera_x + g->world_w * 0.5f;
+            const float center_screen_x = center_world_x - v->camera_x + g->world_w * 0.5f;
             const float center_screen_y = wm->anchor_y01 * g->world_h;
             const float ww = wm->width_h01 * g->world_w;
             const float wh = wm->height_v01 * g->world_h;
@@ -1971,11 +2044,12 @@ static vg_result draw_exit_portal(
 
 static vg_result draw_asteroid_storm(
     vg_context* ctx,
-    const game_state* g,
+    const render_view* v,
     const palette_theme* pal,
     const vg_stroke_style* land_halo,
     const vg_stroke_style* land_main
 ) {
+    const game_state* g = v->g;
     static const vg_vec2 k_shape[11] = {
         {-1.00f, -0.28f},
         {-0.78f, -0.84f},
@@ -2004,8 +2078,8 @@ static vg_result draw_asteroid_storm(
     vg_color fill_c = pal->primary_dim;
     fill_c.a = fminf(fill_c.a, 0.22f);
     const vg_fill_style fill = make_fill(0.55f, fill_c, VG_BLEND_ALPHA);
-    const float view_min_x = g->camera_x - g->world_w * 0.58f;
-    const float view_max_x = g->camera_x + g->world_w * 0.58f;
+    const float view_min_x = v->camera_x - g->world_w * 0.58f;
+    const float view_max_x = v->camera_x + g->world_w * 0.58f;
     const float view_min_y = g->camera_y - g->world_h * 0.58f;
     const float view_max_y = g->camera_y + g->world_h * 0.58f;
 
@@ -2052,12 +2126,13 @@ static vg_result draw_asteroid_storm(
 
 static vg_result draw_minefields(
     vg_context* ctx,
-    const game_state* g,
+    const render_view* v,
     const palette_theme* pal,
     const vg_stroke_style* land_halo,
     const vg_stroke_style* land_main,
     float t_s
 ) {
+    const game_state* g = v->g;
     if (!ctx || !g || !pal || !land_halo || !land_main || g->mine_count <= 0) {
         return VG_OK;
     }
@@ -2073,8 +2148,8 @@ static vg_result draw_minefields(
     vg_color fill_c = pal->primary_dim;
     fill_c.a = fminf(fill_c.a, 0.30f);
     const vg_fill_style classic_fill = make_fill(0.75f, fill_c, VG_BLEND_ALPHA);
-    const float view_x_min = g->camera_x - g->world_w * 0.5f;
-    const float view_x_max = g->camera_x + g->world_w * 0.5f;
+    const float view_x_min = v->camera_x - g->world_w * 0.5f;
+    const float view_x_max = v->camera_x + g->world_w * 0.5f;
     const float view_y_min = g->camera_y - g->world_h * 0.5f;
     const float view_y_max = g->camera_y + g->world_h * 0.5f;
 
@@ -2094,8 +2169,8 @@ static vg_result draw_minefields(
 
         const int style = clampi(m->style, MINE_STYLE_CLASSIC, MINE_STYLE_INDUSTRIAL);
         if (style == MINE_STYLE_ANEMONE) {
-            const float dx = g->player.b.x - m->b.x;
-            const float dy = g->player.b.y - m->b.y;
+            const float dx = v->player_x - m->b.x;
+            const float dy = v->player_y - m->b.y;
             const float d = sqrtf(dx * dx + dy * dy);
             const float r = fmaxf(m->radius, 1.0f);
             const float prox_range = fmaxf(r * 18.0f, 1.0f);
@@ -2400,13 +2475,14 @@ static void structure_prefab_dims_world(int prefab_id, int* out_w, int* out_h) {
 
 static vg_result draw_level_structures(
     vg_context* ctx,
-    const game_state* g,
+    const render_view* v,
     const render_metrics* metrics,
     const palette_theme* pal,
     const vg_stroke_style* land_halo,
     const vg_stroke_style* land_main,
     int draw_cpu_vent_smoke
 ) {
+    const game_state* g = v->g;
     if (!ctx || !g || !metrics || !pal || !land_halo || !land_main || g->render_style == LEVEL_RENDER_CYLINDER) {
         return VG_OK;
     }
@@ -2434,8 +2510,8 @@ static vg_result draw_level_structures(
 
     const float unit_w = g->world_w * (float)LEVELDEF_STRUCTURE_GRID_SCALE / (float)(LEVELDEF_STRUCTURE_GRID_W - 1);
     const float unit_h = g->world_h / (float)((LEVELDEF_STRUCTURE_GRID_H - 1) / LEVELDEF_STRUCTURE_GRID_SCALE);
-    const float view_min_x = g->camera_x - g->world_w * 0.58f;
-    const float view_max_x = g->camera_x + g->world_w * 0.58f;
+    const float view_min_x = v->camera_x - g->world_w * 0.58f;
+    const float view_max_x = v->camera_x + g->world_w * 0.58f;
     const float view_min_y = g->camera_y - g->world_h * 0.58f;
     const float view_max_y = g->camera_y + g->world_h * 0.58f;
 
@@ -2825,12 +2901,13 @@ static vg_result draw_missile_shape(
 
 static vg_result draw_missile_system(
     vg_context* ctx,
-    const game_state* g,
+    const render_view* v,
     const palette_theme* pal,
     const enemy_palette_theme* enemy_pal,
     const vg_stroke_style* land_halo,
     const vg_stroke_style* land_main
 ) {
+    const game_state* g = v->g;
     if (!ctx || !g || !pal || !enemy_pal || !land_halo || !land_main) {
         return VG_OK;
     }
@@ -2875,11 +2952,8 @@ static vg_result draw_missile_system(
     if (g->missile_count <= 0) {
         return VG_OK;
     }
-    for (int i = 0; i < MAX_MISSILES; ++i) {
+    for (int i = slot_pool_next(&g->missile_pool, 0); i >= 0; i = slot_pool_next(&g->missile_pool, i + 1)) {
         const homing_missile* m = &g->missiles[i];
-        if (!m->active) {
-            continue;
-        }
         vg_stroke_style m_halo = halo;
         vg_stroke_style m_main = main;
         vg_fill_style m_fill = fill;
@@ -2889,7 +2963,7 @@ static vg_result draw_missile_system(
             m_fill.color = (vg_color){enemy_pal->enemy.r * 0.35f, enemy_pal->enemy.g * 0.35f, enemy_pal->enemy.b * 0.35f, 0.48f};
         }
         vg_result r = draw_missile_shape(
-            ctx, m->b.x, m->b.y, m->heading_rad, m->radius, m->style, &m_halo, &m_main, &m_fill
+            ctx, v->missiles[i].x, v->missiles[i].y, v->missile_heading[i], m->radius, m->style, &m_halo, &m_main, &m_fill
         );
         if (r != VG_OK) return r;
     }
@@ -3013,6 +3087,46 @@ static vg_result draw_fps_overlay(
     );
 }
 
+/* Per-subsystem tick cost over the profile ring, stacked above the FPS counter. */
+static vg_result draw_sim_profile_overlay(
+    vg_context* ctx,
+    const game_state* g,
+    const vg_stroke_style* halo_style,
+    const vg_stroke_style* main_style
+) {
+    const float ui = ui_reference_scale(g->world_w, g->world_h);
+    const float lh = 13.0f * ui;
+    const int rows = GAME_PROFILE_TICK + 2;
+    char line[96];
+    if (!g->profile.enabled || g->profile.count <= 0) {
+        return VG_OK;
+    }
+    for (int row = 0; row < rows; ++row) {
+        const float y = 44.0f * ui + lh * (float)(rows - 1 - row);
+        vg_result r;
+        if (row == 0) {
+            snprintf(line, sizeof(line), "SIM US        AVG     P99     MAX");
+        } else {
+            game_profile_stats st;
+            (void)game_profile_get_stats(&g->profile, row - 1, &st);
+            snprintf(
+                line,
+                sizeof(line),
+                "%-12s %6.1f  %6.1f  %6.1f",
+                game_profile_section_name(row - 1),
+                st.avg_us,
+                st.p99_us,
+                st.max_us
+            );
+        }
+        r = draw_text_vector_glow(ctx, line, (vg_vec2){14.0f * ui, y}, 9.0f * ui, 0.60f * ui, halo_style, main_style);
+        if (r != VG_OK) {
+            return r;
+        }
+    }
+    return VG_OK;
+}
+
 static vg_result draw_top_meters(
     vg_context* ctx,
     const game_state* g,
@@ -7841,10 +7955,11 @@ static void horizon_segment_update(float* horizon, int bins, float w, vg_vec2 a,
 
 static vg_result draw_high_plains_drifter_terrain(
     vg_context* ctx,
-    const game_state* g,
+    const render_view* v,
     const vg_stroke_style* halo,
     const vg_stroke_style* main
 ) {
+    const game_state* g = v->g;
     enum { ROWS = 24, COLS = 70 };
     vg_vec2 pts[ROWS][COLS];
     float row_depth[ROWS];
@@ -7854,7 +7969,7 @@ static vg_result draw_high_plains_drifter_terrain(
     const float h = g->world_h;
     const float y_near = h * 0.04f;
     const float y_far = h * 0.34f;
-    const float cam = g->camera_x;
+    const float cam = v->camera_x;
     const int enable_horizon_cull = (g->render_style == LEVEL_RENDER_DRIFTER_SHADED);
     const float center_x = w * 0.50f;
     const float col_spacing = w * 0.050f;
@@ -8202,13 +8317,13 @@ static float cylinder_period(const game_state* g) {
     return fmaxf(1920.0f * su * 2.4f, 1.0f);
 }
 
-static vg_vec2 project_cylinder_point(const game_state* g, float x, float y, float* depth01) {
+static vg_vec2 project_cylinder_point_at(const game_state* g, float camera_x, float x, float y, float* depth01) {
     const float w = g->world_w;
     const float h = g->world_h;
     const float cx = w * 0.5f;
     const float cy = h * 0.50f;
     const float period = cylinder_period(g);
-    const float theta = (x - g->camera_x) / period * 6.28318530718f;
+    const float theta = (x - camera_x) / period * 6.28318530718f;
     const float depth = cosf(theta) * 0.5f + 0.5f;
     const float radius = w * 0.485f;
     const float y_scale = 0.44f + depth * 0.62f;
@@ -8221,13 +8336,22 @@ static vg_vec2 project_cylinder_point(const game_state* g, float x, float y, flo
     };
 }
 
+static vg_vec2 project_cylinder_point(const game_state* g, float x, float y, float* depth01) {
+    return project_cylinder_point_at(g, g->camera_x, x, y, depth01);
+}
+
+static vg_vec2 project_view_point(const render_view* v, float x, float y, float* depth01) {
+    return project_cylinder_point_at(v->g, v->camera_x, x, y, depth01);
+}
+
 static vg_result draw_cylinder_wire(
     vg_context* ctx,
-    const game_state* g,
+    const render_view* v,
     const vg_stroke_style* halo,
     const vg_stroke_style* main,
     int level_style
 ) {
+    const game_state* g = v->g;
     const float period = cylinder_period(g);
     enum { N = 96 };
     const float ring_y[] = {g->world_h * 0.06f, g->world_h * 0.46f, g->world_h * 0.86f};
@@ -8242,8 +8366,8 @@ static vg_result draw_cylinder_wire(
             float z01[N];
             for (int i = 0; i < N; ++i) {
                 const float u = (float)i / (float)(N - 1);
-                const float xw = g->camera_x + (u - 0.5f) * period;
-                line[i] = project_cylinder_point(g, xw, ring_y[r], &z01[i]);
+                const float xw = v->camera_x + (u - 0.5f) * period;
+                line[i] = project_view_point(v, xw, ring_y[r], &z01[i]);
             }
             for (int i = 0; i < N - 1; ++i) {
                 const float d = 0.5f * (z01[i] + z01[i + 1]);
@@ -8281,8 +8405,8 @@ static vg_result draw_cylinder_wire(
         float cy = 0.0f;
         for (int i = 0; i < N; ++i) {
             const float u = (float)i / (float)(N - 1);
-            const float xw = g->camera_x + (u - 0.5f) * period;
-            edge[i] = project_cylinder_point(g, xw, ring_y[0], &edge_depth[i]);
+            const float xw = v->camera_x + (u - 0.5f) * period;
+            edge[i] = project_view_point(v, xw, ring_y[0], &edge_depth[i]);
             cx += edge[i].x;
             cy += edge[i].y;
         }
@@ -8295,7 +8419,7 @@ static vg_result draw_cylinder_wire(
                 radar_edge[i].y = cy + (edge[i].y - cy) * radar_scale;
             }
         }
-        const float phase_turns = repeatf(-(g->player.b.x) / fmaxf(period * 0.85f, 1.0f), 1.0f);
+        const float phase_turns = repeatf(-(v->player_x) / fmaxf(period * 0.85f, 1.0f), 1.0f);
         const float radar_shift = phase_turns * (float)(N - 1);
 
         for (int ring = 0; ring < 8; ++ring) {
@@ -8406,11 +8530,11 @@ static vg_result draw_cylinder_wire(
 		        static wormhole_cache wh;
 		        wormhole_cache_ensure(&wh, g->world_w, g->world_h);
 
-		        const vg_vec2 vc = project_cylinder_point(g, g->camera_x, g->world_h * 0.50f, NULL);
+		        const vg_vec2 vc = project_view_point(v, v->camera_x, g->world_h * 0.50f, NULL);
 		        const float cx = vc.x;
 		        const float cy = vc.y;
                 const float spin_sign = (level_style == LEVEL_STYLE_EVENT_HORIZON_LEGACY) ? 1.0f : -1.0f;
-                const float phase_turns = repeatf(spin_sign * g->player.b.x / fmaxf(period * 0.85f, 1.0f), 1.0f);
+                const float phase_turns = repeatf(spin_sign * v->player_x / fmaxf(period * 0.85f, 1.0f), 1.0f);
                 const float loop_shift_legacy = phase_turns * (float)(WORMHOLE_VN - 1);
                 const float loop_shift_modern = phase_turns * (float)WORMHOLE_VN;
                 const float rail_shift = phase_turns * (float)WORMHOLE_COLS;
@@ -8670,15 +8794,18 @@ static vg_result draw_ship_thruster(vg_context* ctx, ship_pose p, const vg_fill_
 static vg_result draw_player_ship(
     vg_context* ctx,
     const game_state* g,
+    float x,
+    float y,
+    float facing_x,
     const render_metrics* metrics,
     const vg_stroke_style* ship_style,
     const vg_fill_style* thruster_fill
 ) {
     const float su = ui_reference_scale(g->world_w, g->world_h);
     ship_pose p = {
-        .x = g->player.b.x,
-        .y = g->player.b.y,
-        .fx = (g->player.facing_x < 0.0f) ? -1.0f : 1.0f,
+        .x = x,
+        .y = y,
+        .fx = (facing_x < 0.0f) ? -1.0f : 1.0f,
         .s = 0.65f * su
     };
     if (metrics &&
@@ -8998,11 +9125,12 @@ static vg_result draw_powerup_medallion(
 
 static vg_result draw_emp_blast(
     vg_context* ctx,
-    const game_state* g,
+    const render_view* v,
     const palette_theme* pal,
     float intensity_scale,
     int uses_cylinder
 ) {
+    const game_state* g = v->g;
     if (!g || !g->emp_effect_active || g->emp_effect_duration_s <= 0.0f) {
         return VG_OK;
     }
@@ -9048,7 +9176,7 @@ static vg_result draw_emp_blast(
         }
     } else {
         float depth = 0.0f;
-        const vg_vec2 cp = project_cylinder_point(g, g->emp_effect_x, g->emp_effect_y, &depth);
+        const vg_vec2 cp = project_view_point(v, g->emp_effect_x, g->emp_effect_y, &depth);
         r = vg_fill_circle(ctx, cp, r_primary * (0.08f + 0.12f * fade) * (0.35f + depth * 0.85f), &flash, 18);
         if (r != VG_OK) {
             return r;
@@ -9057,14 +9185,14 @@ static vg_result draw_emp_blast(
             const float a = ((float)i / (float)segs) * 6.2831853f;
             const float ca = cosf(a);
             const float sa = sinf(a);
-            pts[i] = project_cylinder_point(
-                g,
+            pts[i] = project_view_point(
+                v,
                 g->emp_effect_x + ca * r_primary,
                 g->emp_effect_y + sa * r_primary,
                 NULL
             );
-            pts2[i] = project_cylinder_point(
-                g,
+            pts2[i] = project_view_point(
+                v,
                 g->emp_effect_x + ca * r_blast,
                 g->emp_effect_y + sa * r_blast,
                 NULL
@@ -10540,7 +10668,15 @@ static vg_result draw_enemy_glyph_manta(vg_context* ctx, const enemy* e, float x
     return VG_OK;
 }
 
-static vg_result draw_enemy_glyph_eel(vg_context* ctx, const enemy* e, float x, float y, float rr, const vg_stroke_style* enemy_style) {
+static vg_result draw_enemy_glyph_eel(
+    vg_context* ctx,
+    const enemy* e,
+    const enemy_eel_spine* spine,
+    float x,
+    float y,
+    float rr,
+    const vg_stroke_style* enemy_style
+) {
     float fx = 0.0f;
     float fy = 0.0f;
     float nx = 0.0f;
@@ -10562,7 +10698,7 @@ static vg_result draw_enemy_glyph_eel(vg_context* ctx, const enemy* e, float x,
     float ribbon_wave[EEL_STRAND_N][EEL_SEG_N + 1];
     float normal_x[EEL_SEG_N + 1];
     float normal_y[EEL_SEG_N + 1];
-    const int spine_n = clampi(e->eel_spine_count, 0, EEL_SPINE_POINTS);
+    const int spine_n = spine ? clampi(spine->count, 0, EEL_SPINE_POINTS) : 0;
     vg_result r = VG_OK;
 
     enemy_glyph_basis(e, &fx, &fy, &nx, &ny);
@@ -10589,8 +10725,8 @@ static vg_result draw_enemy_glyph_eel(vg_context* ctx, const enemy* e, float x,
             const int i0 = clampi((int)floorf(s), 0, spine_n - 1);
             const int i1 = (i0 < spine_n - 1) ? (i0 + 1) : i0;
             const float t = s - (float)i0;
-            body[i].x = lerpf(e->eel_spine_x[i0], e->eel_spine_x[i1], t);
-            body[i].y = lerpf(e->eel_spine_y[i0], e->eel_spine_y[i1], t);
+            body[i].x = lerpf(spine->x[i0], spine->x[i1], t);
+            body[i].y = lerpf(spine->y[i0], spine->y[i1], t);
         } else {
             const float anchor_x = x - fx * (0.58f * rr);
             const float anchor_y = y - fy * (0.58f * rr);
@@ -11229,7 +11365,15 @@ static vg_result draw_enemy_glyph_boss_vent(vg_context* ctx, const enemy* e, flo
     }
 }
 
-static vg_result draw_enemy_glyph(vg_context* ctx, const enemy* e, float x, float y, float rr, const vg_stroke_style* enemy_style) {
+static vg_result draw_enemy_glyph(
+    vg_context* ctx,
+    const enemy* e,
+    const enemy_eel_spine* spine,
+    float x,
+    float y,
+    float rr,
+    const vg_stroke_style* enemy_style
+) {
     switch (e->visual_kind) {
         case ENEMY_VISUAL_BOSS_CORE:
             return draw_enemy_glyph_boss_core(ctx, e, x, y, rr, enemy_style);
@@ -11252,7 +11396,7 @@ static vg_result draw_enemy_glyph(vg_context* ctx, const enemy* e, float x, floa
         case ENEMY_VISUAL_BOID_RAZOR:
             return draw_enemy_glyph_razor(ctx, e, x, y, rr, enemy_style);
         case ENEMY_VISUAL_EEL:
-            return draw_enemy_glyph_eel(ctx, e, x, y, rr, enemy_style);
+            return draw_enemy_glyph_eel(ctx, e, spine, x, y, rr, enemy_style);
         case ENEMY_VISUAL_MANTA:
             return draw_enemy_glyph_manta(ctx, e, x, y, rr, enemy_style);
         case ENEMY_VISUAL_JELLY:
@@ -11265,13 +11409,14 @@ static vg_result draw_enemy_glyph(vg_context* ctx, const enemy* e, float x, floa
 
 static vg_result draw_boss_connector_struts(
     vg_context* ctx,
-    const game_state* g,
+    const render_view* v,
     float world_cull_min_x,
     float world_cull_min_y,
     float world_cull_max_x,
     float world_cull_max_y,
     const vg_stroke_style* enemy_style
 ) {
+    const game_state* g = v->g;
     vg_stroke_style halo;
     vg_stroke_style main;
     if (!ctx || !g || !enemy_style) {
@@ -11291,6 +11436,8 @@ static vg_result draw_boss_connector_struts(
         const boss_enemy_attachment* attachment = &g->boss_attachments[i];
         const enemy* child;
         const enemy* owner;
+        const render_enemy_pose* child_pose;
+        const render_enemy_pose* owner_pose;
         float dx;
         float dy;
         float d;
@@ -11313,8 +11460,10 @@ static vg_result draw_boss_connector_struts(
         if (!child->active || !owner->active) {
             continue;
         }
-        dx = child->b.x - owner->b.x;
-        dy = child->b.y - owner->b.y;
+        child_pose = &v->enemies[i];
+        owner_pose = &v->enemies[attachment->owner_index];
+        dx = child_pose->x - owner_pose->x;
+        dy = child_pose->y - owner_pose->y;
         d = sqrtf(dx * dx + dy * dy);
         if (d <= 1.0f) {
             continue;
@@ -11329,12 +11478,12 @@ static vg_result draw_boss_connector_struts(
         }
         bend = clampf(fabsf(attachment->local_y) * 0.10f, owner->radius * 0.10f, owner->radius * 0.32f);
         strut[0] = (vg_vec2){
-            owner->b.x + dir_x * (owner->radius * 0.58f),
-            owner->b.y + dir_y * (owner->radius * 0.58f)
+            owner_pose->x + dir_x * (owner->radius * 0.58f),
+            owner_pose->y + dir_y * (owner->radius * 0.58f)
         };
         strut[2] = (vg_vec2){
-            child->b.x - dir_x * (child->radius * 0.62f),
-            child->b.y - dir_y * (child->radius * 0.62f)
+            child_pose->x - dir_x * (child->radius * 0.62f),
+            child_pose->y - dir_y * (child->radius * 0.62f)
         };
         strut[1] = (vg_vec2){
             lerpf(strut[0].x, strut[2].x, 0.46f) + perp_x * bend * sign,
@@ -11374,42 +11523,12 @@ static vg_result draw_boss_connector_struts(
 
 vg_result render_frame(vg_context* ctx, const game_state* state, const render_metrics* metrics) {
     const game_state* g = state;
-    game_state interpolated_state;
+    render_view view;
+    const render_view* v = &view;
     if (!ctx || !state || !metrics) {
         return VG_ERROR_INVALID_ARGUMENT;
     }
-    interpolated_state = *state;
-    {
-        const float alpha = clampf(metrics->sim_alpha, 0.0f, 1.0f);
-        interpolated_state.camera_x = lerpf(state->prev_camera_x, state->camera_x, alpha);
-        interpolate_body_render(state, &interpolated_state.player.b, &state->prev_player.b, &state->player.b, alpha);
-        interpolated_state.player.facing_x = lerpf(state->prev_player.facing_x, state->player.facing_x, alpha);
-        for (int i = 0; i < MAX_BULLETS; ++i) {
-            if (!state->bullets[i].active || !state->prev_bullets[i].active) {
-                continue;
-            }
-            interpolate_body_render(state, &interpolated_state.bullets[i].b, &state->prev_bullets[i].b, &state->bullets[i].b, alpha);
-        }
-        for (int i = 0; i < MAX_ENEMY_BULLETS; ++i) {
-            if (!state->enemy_bullets[i].active || !state->prev_enemy_bullets[i].active) {
-                continue;
-            }
-            interpolate_body_render(
-                state,
-                &interpolated_state.enemy_bullets[i].b,
-                &state->prev_enemy_bullets[i].b,
-                &state->enemy_bullets[i].b,
-                alpha
-            );
-        }
-        for (int i = 0; i < MAX_ENEMIES; ++i) {
-            interpolate_enemy_render(&interpolated_state.enemies[i], state, &state->prev_enemies[i], &state->enemies[i], alpha);
-        }
-        for (int i = 0; i < MAX_MISSILES; ++i) {
-            interpolate_missile_render(&interpolated_state.missiles[i], state, &state->prev_missiles[i], &state->missiles[i], alpha);
-        }
-    }
-    g = &interpolated_state;
+    build_render_view(&view, state, clampf(metrics->sim_alpha, 0.0f, 1.0f));
     const palette_theme pal = get_palette_theme(metrics->palette_mode);
     int enemy_palette_mode = LEVELDEF_ENEMY_PALETTE_DEFAULT;
     {
@@ -11643,7 +11762,7 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             cyl_main.intensity *= 1.20f;
             if (!((metrics->use_gpu_wormhole && g->level_style == LEVEL_STYLE_EVENT_HORIZON) ||
                   (metrics->use_gpu_radar && g->level_style == LEVEL_STYLE_ENEMY_RADAR))) {
-                r = draw_cylinder_wire(ctx, g, &cyl_halo, &cyl_main, g->level_style);
+                r = draw_cylinder_wire(ctx, v, &cyl_halo, &cyl_main, g->level_style);
                 if (r != VG_OK) {
                     return r;
                 }
@@ -11651,11 +11770,11 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
 
             if (draw_star_background) {
                 for (size_t i = 0; i < MAX_STARS; ++i) {
-                    const float su = repeatf(g->stars[i].x - g->camera_x * 0.22f, g->world_w) / fmaxf(g->world_w, 1.0f);
-                    const float sx_world = g->camera_x + (su - 0.5f) * period;
+                    const float su = repeatf(g->stars[i].x - v->camera_x * 0.22f, g->world_w) / fmaxf(g->world_w, 1.0f);
+                    const float sx_world = v->camera_x + (su - 0.5f) * period;
                     float depth = 0.0f;
-                    const vg_vec2 sp = project_cylinder_point(g, sx_world, g->stars[i].y, &depth);
-                    if (!star_visible_with_mask(g, sp.x, sp.y)) {
+                    const vg_vec2 sp = project_view_point(v, sx_world, g->stars[i].y, &depth);
+                    if (!star_visible_with_mask(v, sp.x, sp.y)) {
                         continue;
                     }
                     vg_fill_style sf = star_fill;
@@ -11666,7 +11785,7 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
                     }
                 }
             }
-            r = draw_background_window_mask_overlays(ctx, g, &land_halo, &land_main);
+            r = draw_background_window_mask_overlays(ctx, v, &land_halo, &land_main);
             if (r != VG_OK) {
                 return r;
             }
@@ -11681,40 +11800,39 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
         const float cyl_cull_max_y = g->world_h + 64.0f;
 
         if (!metrics->use_gpu_particles) {
-            for (size_t i = 0; i < MAX_PARTICLES; ++i) {
-                /* Particle LOD: keep frame time stable under heavy explosion loads. */
-                const int active_particles = g->active_particles;
-                int stride = 1;
-                if (active_particles > 360) {
-                    stride = 2;
-                }
-                if (active_particles > 620) {
-                    stride = 3;
-                }
-                if (active_particles > 900) {
-                    stride = 4;
-                }
-                if ((int)(i % (size_t)stride) != 0) {
-                    continue;
-                }
-                const particle* p = &g->particles[i];
-                if (!p->active) {
-                    continue;
-                }
-                if (p->a <= 0.02f || p->size <= 0.15f) {
+            const particle_store* ps = &g->particles;
+            /* Particle LOD: keep frame time stable under heavy explosion loads. */
+            const int active_particles = ps->count;
+            int stride = 1;
+            if (active_particles > 360) {
+                stride = 2;
+            }
+            if (active_particles > 620) {
+                stride = 3;
+            }
+            if (active_particles > 900) {
+                stride = 4;
+            }
+            if (active_particles > 2400) {
+                stride = 8;
+            }
+            for (int i = 0; i < active_particles; i += stride) {
+                const float size = ps->size[i];
+                const float alpha = ps->a[i];
+                if (alpha <= 0.02f || size <= 0.15f) {
                     continue;
                 }
                 float depth = 0.0f;
-                const vg_vec2 pp = project_cylinder_point(g, p->b.x, p->b.y, &depth);
-                const float pr = p->size * (0.35f + 0.9f * depth);
+                const vg_vec2 pp = project_view_point(v, ps->x[i], ps->y[i], &depth);
+                const float pr = size * (0.35f + 0.9f * depth);
                 if (pp.x < -24.0f || pp.x > g->world_w + 24.0f || pp.y < -24.0f || pp.y > g->world_h + 24.0f) {
                     continue;
                 }
                 if (pr <= 0.10f) {
                     continue;
                 }
-                vg_fill_style pf = make_fill(1.0f, (vg_color){p->r, p->g, p->bcol, p->a}, VG_BLEND_ADDITIVE);
-                const float rr = (p->type == PARTICLE_FLASH) ? (pr * 1.7f) : pr;
+                vg_fill_style pf = make_fill(1.0f, (vg_color){ps->r[i], ps->g[i], ps->b[i], alpha}, VG_BLEND_ADDITIVE);
+                const float rr = (ps->type[i] == PARTICLE_FLASH) ? (pr * 1.7f) : pr;
                 r = vg_fill_circle(ctx, pp, rr, &pf, 8);
                 if (r != VG_OK) {
                     return r;
@@ -11723,25 +11841,17 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
         }
 
         if (g->lives > 0) {
-            game_state gp = *g;
-            gp.player.b = g->player.b;
             float player_depth = 1.0f;
-            {
-                float d = 0.0f;
-                const vg_vec2 pp = project_cylinder_point(g, g->player.b.x, g->player.b.y, &d);
-                gp.player.b.x = pp.x;
-                gp.player.b.y = pp.y;
-                player_depth = d;
-            }
-            r = draw_player_ship(ctx, &gp, metrics, &ship_style, &thruster_fill);
+            const vg_vec2 pp = project_view_point(v, v->player_x, v->player_y, &player_depth);
+            r = draw_player_ship(ctx, g, pp.x, pp.y, v->player_facing_x, metrics, &ship_style, &thruster_fill);
             if (r != VG_OK) {
                 return r;
             }
             if (g->shield_active && g->shield_time_remaining_s > 0.0f) {
                 r = draw_player_shield(
                     ctx,
-                    gp.player.b.x,
-                    gp.player.b.y,
+                    pp.x,
+                    pp.y,
                     g->shield_radius * (0.45f + player_depth * 0.90f),
                     g->t,
                     &shield_glow,
@@ -11752,15 +11862,12 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
                 }
             }
         }
-        for (int i = 0; i < MAX_POWERUPS; ++i) {
+        for (int i = slot_pool_next(&g->powerup_pool, 0); i >= 0; i = slot_pool_next(&g->powerup_pool, i + 1)) {
             const powerup_pickup* p = &g->powerups[i];
             float depth = 0.0f;
             vg_vec2 cp;
             float rr;
-            if (!p->active) {
-                continue;
-            }
-            cp = project_cylinder_point(g, p->b.x, p->b.y, &depth);
+            cp = project_view_point(v, p->b.x, p->b.y, &depth);
             if (cp.x < -36.0f || cp.x > g->world_w + 36.0f || cp.y < -36.0f || cp.y > g->world_h + 36.0f) {
                 continue;
             }
@@ -11783,17 +11890,15 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             }
         }
         if (g->emp_effect_active) {
-            r = draw_emp_blast(ctx, g, &pal, intensity_scale, 1);
+            r = draw_emp_blast(ctx, v, &pal, intensity_scale, 1);
             if (r != VG_OK) {
                 return r;
             }
         }
 
-        for (size_t i = 0; i < MAX_BULLETS; ++i) {
-            if (!g->bullets[i].active) {
-                continue;
-            }
+        for (int i = slot_pool_next(&g->bullet_pool, 0); i >= 0; i = slot_pool_next(&g->bullet_pool, i + 1)) {
             const bullet* b = &g->bullets[i];
+            const vg_vec2 bp = v->bullets[i];
             float ux = b->b.vx;
             float uy = b->b.vy;
             float speed = sqrtf(ux * ux + uy * uy);
@@ -11808,16 +11913,16 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             const float core_f = 13.5f;
             const float core_b = 8.0f;
             const float trail = 22.0f + clampf(speed * 0.030f, 10.0f, 34.0f);
-            const float x0w = b->b.x - ux * trail;
-            const float y0w = b->b.y - uy * trail;
-            const float x1w = b->b.x - ux * core_b;
-            const float y1w = b->b.y - uy * core_b;
-            const float x2w = b->b.x + ux * core_f;
-            const float y2w = b->b.y + uy * core_f;
+            const float x0w = bp.x - ux * trail;
+            const float y0w = bp.y - uy * trail;
+            const float x1w = bp.x - ux * core_b;
+            const float y1w = bp.y - uy * core_b;
+            const float x2w = bp.x + ux * core_f;
+            const float y2w = bp.y + uy * core_f;
             float d0 = 0.0f, d1 = 0.0f, d2 = 0.0f;
-            const vg_vec2 p0 = project_cylinder_point(g, x0w, y0w, &d0);
-            const vg_vec2 p1 = project_cylinder_point(g, x1w, y1w, &d1);
-            const vg_vec2 p2 = project_cylinder_point(g, x2w, y2w, &d2);
+            const vg_vec2 p0 = project_view_point(v, x0w, y0w, &d0);
+            const vg_vec2 p1 = project_view_point(v, x1w, y1w, &d1);
+            const vg_vec2 p2 = project_view_point(v, x2w, y2w, &d2);
             {
                 const float min_x = fminf(p0.x, fminf(p1.x, p2.x));
                 const float min_y = fminf(p0.y, fminf(p1.y, p2.y));
@@ -11870,11 +11975,9 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             }
         }
 
-        for (size_t i = 0; i < MAX_ENEMY_BULLETS; ++i) {
-            if (!g->enemy_bullets[i].active) {
-                continue;
-            }
+        for (int i = slot_pool_next(&g->enemy_bullet_pool, 0); i >= 0; i = slot_pool_next(&g->enemy_bullet_pool, i + 1)) {
             const enemy_bullet* b = &g->enemy_bullets[i];
+            const vg_vec2 bp = v->enemy_bullets[i];
             float ux = b->b.vx;
             float uy = b->b.vy;
             float speed = sqrtf(ux * ux + uy * uy);
@@ -11889,16 +11992,16 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             const float core_f = 10.5f;
             const float core_b = 6.2f;
             const float trail = 16.0f + clampf(speed * 0.026f, 7.0f, 24.0f);
-            const float x0w = b->b.x - ux * trail;
-            const float y0w = b->b.y - uy * trail;
-            const float x1w = b->b.x - ux * core_b;
-            const float y1w = b->b.y - uy * core_b;
-            const float x2w = b->b.x + ux * core_f;
-            const float y2w = b->b.y + uy * core_f;
+            const float x0w = bp.x - ux * trail;
+            const float y0w = bp.y - uy * trail;
+            const float x1w = bp.x - ux * core_b;
+            const float y1w = bp.y - uy * core_b;
+            const float x2w = bp.x + ux * core_f;
+            const float y2w = bp.y + uy * core_f;
             float d0 = 0.0f, d1 = 0.0f, d2 = 0.0f;
-            const vg_vec2 p0 = project_cylinder_point(g, x0w, y0w, &d0);
-            const vg_vec2 p1 = project_cylinder_point(g, x1w, y1w, &d1);
-            const vg_vec2 p2 = project_cylinder_point(g, x2w, y2w, &d2);
+            const vg_vec2 p0 = project_view_point(v, x0w, y0w, &d0);
+            const vg_vec2 p1 = project_view_point(v, x1w, y1w, &d1);
+            const vg_vec2 p2 = project_view_point(v, x2w, y2w, &d2);
             {
                 const float min_x = fminf(p0.x, fminf(p1.x, p2.x));
                 const float min_y = fminf(p0.y, fminf(p1.y, p2.y));
@@ -11951,9 +12054,9 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             }
         }
 
-        for (size_t i = 0; i < MAX_EEL_ARCS; ++i) {
+        for (int i = slot_pool_next(&g->eel_arc_pool, 0); i >= 0; i = slot_pool_next(&g->eel_arc_pool, i + 1)) {
             const eel_arc_effect* arc = &g->eel_arcs[i];
-            if (!arc->active || !arc->pulse_emit_on || arc->point_count < 2 || !eel_arc_pulse_is_on(arc)) {
+            if (!arc->pulse_emit_on || arc->point_count < 2 || !eel_arc_pulse_is_on(arc)) {
                 continue;
             }
             {
@@ -11969,7 +12072,7 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
                 float arc_max_y = -1.0e9f;
                 for (int p = 0; p < arc->point_count; ++p) {
                     float dp = 0.0f;
-                    arc_line[p] = project_cylinder_point(g, arc->point_x[p], arc->point_y[p], &dp);
+                    arc_line[p] = project_view_point(v, arc->point_x[p], arc->point_y[p], &dp);
                     depth_line[p] = dp;
                     depth_sum += dp;
                     arc_min_x = fminf(arc_min_x, arc_line[p].x);
@@ -12042,9 +12145,9 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             }
         }
 
-        for (size_t i = 0; i < MAX_ENEMY_DEBRIS; ++i) {
+        for (int i = slot_pool_next(&g->debris_pool, 0); i >= 0; i = slot_pool_next(&g->debris_pool, i + 1)) {
             const enemy_debris* dbr = &g->debris[i];
-            if (!dbr->active || dbr->alpha <= 0.01f) {
+            if (dbr->alpha <= 0.01f) {
                 continue;
             }
             const float c = cosf(dbr->angle);
@@ -12053,8 +12156,8 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             const float hy = s * dbr->half_len;
             float d0 = 0.0f;
             float d1 = 0.0f;
-            const vg_vec2 a = project_cylinder_point(g, dbr->b.x - hx, dbr->b.y - hy, &d0);
-            const vg_vec2 b = project_cylinder_point(g, dbr->b.x + hx, dbr->b.y + hy, &d1);
+            const vg_vec2 a = project_view_point(v, dbr->b.x - hx, dbr->b.y - hy, &d0);
+            const vg_vec2 b = project_view_point(v, dbr->b.x + hx, dbr->b.y + hy, &d1);
             if (!rects_intersect(
                     fminf(a.x, b.x),
                     fminf(a.y, b.y),
@@ -12080,13 +12183,13 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             }
         }
 
-        for (size_t i = 0; i < MAX_ENEMIES; ++i) {
-            if (!g->enemies[i].active) {
-                continue;
-            }
-            const enemy* e = &g->enemies[i];
+        for (int k = 0; k < v->live_enemy_count; ++k) {
+            const int i = v->live_enemies[k];
+            enemy e_view;
+            const enemy* e = view_enemy(v, i, &e_view);
+            const enemy_eel_spine* spine = view_eel_spine(v, i);
             float d = 0.0f;
-            const vg_vec2 c = project_cylinder_point(g, e->b.x, e->b.y, &d);
+            const vg_vec2 c = project_view_point(v, e->b.x, e->b.y, &d);
             const float rr = e->radius * (0.45f + d * 0.9f);
             if (!rects_intersect(
                     c.x - rr,
@@ -12108,9 +12211,10 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
                  * derive on-screen facing from projected nearby points so
                  * the glyph flips naturally on the back half of the cylinder. */
                 enemy e_proj = *e;
+                enemy_eel_spine spine_proj;
                 const float sample = fmaxf(e->radius * 0.9f, 4.0f);
-                const vg_vec2 p_a = project_cylinder_point(
-                    g,
+                const vg_vec2 p_a = project_view_point(
+                    v,
                     e->b.x + e->facing_x * sample,
                     e->b.y + e->facing_y * sample,
                     NULL
@@ -12124,18 +12228,17 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
                     e_proj.facing_x = sfx;
                     e_proj.facing_y = sfy;
                 }
-                if (e->visual_kind == ENEMY_VISUAL_EEL && e->eel_spine_count >= 2) {
-                    const int spine_n = clampi(e->eel_spine_count, 0, EEL_SPINE_POINTS);
-                    e_proj.eel_spine_count = spine_n;
+                spine_proj.count = 0;
+                if (spine && spine->count >= 2) {
+                    const int spine_n = clampi(spine->count, 0, EEL_SPINE_POINTS);
+                    spine_proj.count = spine_n;
                     for (int si = 0; si < spine_n; ++si) {
-                        const vg_vec2 sp = project_cylinder_point(g, e->eel_spine_x[si], e->eel_spine_y[si], NULL);
-                        e_proj.eel_spine_x[si] = sp.x;
-                        e_proj.eel_spine_y[si] = sp.y;
+                        const vg_vec2 sp = project_view_point(v, spine->x[si], spine->y[si], NULL);
+                        spine_proj.x[si] = sp.x;
+                        spine_proj.y[si] = sp.y;
                     }
-                } else {
-                    e_proj.eel_spine_count = 0;
                 }
-                r = draw_enemy_glyph(ctx, &e_proj, c.x, c.y, rr, &es);
+                r = draw_enemy_glyph(ctx, &e_proj, &spine_proj, c.x, c.y, rr, &es);
             }
             if (r != VG_OK) {
                 return r;
@@ -12146,6 +12249,9 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
         if (r == VG_OK && metrics->show_fps) {
             r = draw_fps_overlay(ctx, g->world_w, g->world_h, metrics->fps, &txt_halo, &txt_main);
         }
+        if (r == VG_OK && metrics->show_sim_profile) {
+            r = draw_sim_profile_overlay(ctx, g, &txt_halo, &txt_main);
+        }
         if (r == VG_OK && metrics->show_crt_ui) {
             vg_crt_profile crt_ui;
             vg_get_crt_profile(ctx, &crt_ui);
@@ -12213,14 +12319,14 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             const float parallax = 0.08f + u * 0.28f;
             const float persistence_trail = 1.0f + (1.0f - crt.persistence_decay) * 2.8f;
             const float dt_safe = fmaxf(metrics->dt, 1e-4f);
-            const float camera_dx = g->camera_x - g->prev_camera_x;
+            const float camera_dx = v->camera_x - g->prev_camera_x;
             const float vx = ((g->stars[i].prev_x - g->stars[i].x) + camera_dx * parallax) / dt_safe;
             const float vy = (g->stars[i].prev_y - g->stars[i].y) / dt_safe;
             const float exposure_s = (1.0f / 60.0f) * (1.4f + 2.6f * u) * persistence_trail;
             float tx = g->stars[i].x + vx * exposure_s;
             const float ty = g->stars[i].y + vy * exposure_s;
-            float sx = repeatf(g->stars[i].x - g->camera_x * parallax, g->world_w);
-            float stx = repeatf(tx - g->camera_x * parallax, g->world_w);
+            float sx = repeatf(g->stars[i].x - v->camera_x * parallax, g->world_w);
+            float stx = repeatf(tx - v->camera_x * parallax, g->world_w);
             if (stx - sx > g->world_w * 0.5f) {
                 stx -= g->world_w;
             } else if (sx - stx > g->world_w * 0.5f) {
@@ -12230,8 +12336,8 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
                 {stx, ty},
                 {sx, g->stars[i].y}
             };
-            const int vis_head = star_visible_with_mask(g, sx, g->stars[i].y);
-            const int vis_tail = star_visible_with_mask(g, stx, ty);
+            const int vis_head = star_visible_with_mask(v, sx, g->stars[i].y);
+            const int vis_tail = star_visible_with_mask(v, stx, ty);
             if (!vis_head) {
                 continue;
             }
@@ -12283,7 +12389,7 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             /* Draw seam-duplicate heads near edges for continuous wrap. */
             if (sx < 8.0f) {
                 const float sx2 = sx + g->world_w;
-                if (star_visible_with_mask(g, sx2, g->stars[i].y)) {
+                if (star_visible_with_mask(v, sx2, g->stars[i].y)) {
                     r = vg_fill_circle(ctx, (vg_vec2){sx2, g->stars[i].y}, g->stars[i].size + 0.4f * u, &star_fill, 10);
                     if (r != VG_OK) {
                         return r;
@@ -12291,7 +12397,7 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
                 }
             } else if (sx > g->world_w - 8.0f) {
                 const float sx2 = sx - g->world_w;
-                if (star_visible_with_mask(g, sx2, g->stars[i].y)) {
+                if (star_visible_with_mask(v, sx2, g->stars[i].y)) {
                     r = vg_fill_circle(ctx, (vg_vec2){sx2, g->stars[i].y}, g->stars[i].size + 0.4f * u, &star_fill, 10);
                     if (r != VG_OK) {
                         return r;
@@ -12307,7 +12413,7 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
         }
     }
     if (!foreground_only) {
-        r = draw_background_window_mask_overlays(ctx, g, &land_halo, &land_main);
+        r = draw_background_window_mask_overlays(ctx, v, &land_halo, &land_main);
         if (r != VG_OK) {
             return r;
         }
@@ -12323,7 +12429,7 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
                 plains_halo.width_px *= 1.08f;
                 plains_main.width_px *= 1.04f;
                 plains_main.color = (vg_color){pal.secondary.r, pal.secondary.g, pal.secondary.b, 0.92f};
-                r = draw_high_plains_drifter_terrain(ctx, g, &plains_halo, &plains_main);
+                r = draw_high_plains_drifter_terrain(ctx, v, &plains_halo, &plains_main);
                 if (r != VG_OK) {
                     return r;
                 }
@@ -12339,7 +12445,7 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
                     ctx,
                     g->world_w,
                     g->world_h,
-                    g->camera_x,
+                    v->camera_x,
                     fmaxf(game_current_leveldef(g) ? game_current_leveldef(g)->defender_industry_parallax_speed : 1.0f, 0.0f),
                     &pal,
                     &land_halo,
@@ -12353,7 +12459,7 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             /* Foreground vector landscape layers for depth/parallax. */
             vg_stroke_style land1_halo = land_halo;
             vg_stroke_style land1_main = land_main;
-            r = draw_parallax_landscape(ctx, g->world_w, g->world_h, g->camera_x, 1.20f, g->world_h * 0.18f, 22.0f, &land1_halo, &land1_main);
+            r = draw_parallax_landscape(ctx, g->world_w, g->world_h, v->camera_x, 1.20f, g->world_h * 0.18f, 22.0f, &land1_halo, &land1_main);
             if (r != VG_OK) {
                 return r;
             }
@@ -12364,7 +12470,7 @@ vg_result render_frame(vg_context* ctx, const game_state* state, const render_me
             land2_halo.intensity *= 1.05f;
             land2_main.intensity *= 1.08f;
             land2_main.color = (vg_color){pal.secondary.r, pal.secondary.g, pal.secondary.b, 0.9f};
-            r = draw_parallax_landscape(ctx, g->world_w, g->world_h, g->camera_x, 1.55f, g->world_h * 0.10f, 30.0f, &land2_halo, &land2_main);
+            r = draw_parallax_landscape(ctx, g->world_w, g->world_h, v->camera_x, 1.55f, g->world_h * 0.10f, 30.0f, &land2_halo, &land2_main);
             if (r != VG_OK) {
                 return r;
             }
@@ -12380,12 +12486,12 @@ skip_legacy_landscape:
     if (r != VG_OK) {
         return r;
     }
-    vg_transform_translate(ctx, g->world_w * 0.5f - g->camera_x, g->world_h * 0.5f - g->camera_y);
+    vg_transform_translate(ctx, g->world_w * 0.5f - v->camera_x, g->world_h * 0.5f - g->camera_y);
     float world_cull_min_x = 0.0f;
     float world_cull_min_y = 0.0f;
     float world_cull_max_x = 0.0f;
     float world_cull_max_y = 0.0f;
-    world_view_bounds(g, 48.0f, 48.0f, &world_cull_min_x, &world_cull_min_y, &world_cull_max_x, &world_cull_max_y);
+    world_view_bounds(v, 48.0f, 48.0f, &world_cull_min_x, &world_cull_min_y, &world_cull_max_x, &world_cull_max_y);
 
     if (g->searchlight_count > 0) {
         r = draw_searchlights(ctx, g, &pal, &enemy_pal, intensity_scale, &land_halo, &land_main);
@@ -12402,26 +12508,26 @@ skip_legacy_landscape:
         }
     }
     if (g->asteroid_storm_enabled && g->asteroid_count > 0) {
-        r = draw_asteroid_storm(ctx, g, &pal, &land_halo, &land_main);
+        r = draw_asteroid_storm(ctx, v, &pal, &land_halo, &land_main);
         if (r != VG_OK) {
             (void)vg_transform_pop(ctx);
             return r;
         }
     }
     if (g->mine_count > 0) {
-        r = draw_minefields(ctx, g, &pal, &land_halo, &land_main, metrics ? metrics->ui_time_s : 0.0f);
+        r = draw_minefields(ctx, v, &pal, &land_halo, &land_main, metrics ? metrics->ui_time_s : 0.0f);
         if (r != VG_OK) {
             (void)vg_transform_pop(ctx);
             return r;
         }
     }
-    r = draw_level_structures(ctx, g, metrics, &pal, &land_halo, &land_main, metrics->use_gpu_particles ? 0 : 1);
+    r = draw_level_structures(ctx, v, metrics, &pal, &land_halo, &land_main, metrics->use_gpu_particles ? 0 : 1);
     if (r != VG_OK) {
         (void)vg_transform_pop(ctx);
         return r;
     }
     if (g->missile_launcher_count > 0 || g->missile_count > 0) {
-        r = draw_missile_system(ctx, g, &pal, &enemy_pal, &land_halo, &land_main);
+        r = draw_missile_system(ctx, v, &pal, &enemy_pal, &land_halo, &land_main);
         if (r != VG_OK) {
             (void)vg_transform_pop(ctx);
             return r;
@@ -12436,59 +12542,61 @@ skip_legacy_landscape:
     }
 
     if (!metrics->use_gpu_particles) {
-    for (size_t i = 0; i < MAX_PARTICLES; ++i) {
-        /* Particle LOD: keep frame time stable under heavy explosion loads. */
-        const int active_particles = g->active_particles;
-        int stride = 1;
-        if (active_particles > 360) {
-            stride = 2;
-        }
-        if (active_particles > 620) {
-            stride = 3;
-        }
-        if (active_particles > 900) {
-            stride = 4;
-        }
-        if ((int)(i % (size_t)stride) != 0) {
-            continue;
-        }
-        const particle* p = &g->particles[i];
-        if (!p->active) {
-            continue;
-        }
-        if (p->a <= 0.02f || p->size <= 0.15f) {
+    const particle_store* ps = &g->particles;
+    /* Particle LOD: keep frame time stable under heavy explosion loads. */
+    const int active_particles = ps->count;
+    const int simplify_geom = (active_particles > 520);
+    int stride = 1;
+    if (active_particles > 360) {
+        stride = 2;
+    }
+    if (active_particles > 620) {
+        stride = 3;
+    }
+    if (active_particles > 900) {
+        stride = 4;
+    }
+    if (active_particles > 2400) {
+        stride = 8;
+    }
+    for (int i = 0; i < active_particles; i += stride) {
+        const float px = ps->x[i];
+        const float py = ps->y[i];
+        const float size = ps->size[i];
+        const int type = ps->type[i];
+        const vg_color col = {ps->r[i], ps->g[i], ps->b[i], ps->a[i]};
+        if (col.a <= 0.02f || size <= 0.15f) {
             continue;
         }
-        if (p->b.x < g->camera_x - g->world_w * 0.58f || p->b.x > g->camera_x + g->world_w * 0.58f ||
-            p->b.y < g->camera_y - g->world_h * 0.58f || p->b.y > g->camera_y + g->world_h * 0.58f) {
+        if (px < v->camera_x - g->world_w * 0.58f || px > v->camera_x + g->world_w * 0.58f ||
+            py < g->camera_y - g->world_h * 0.58f || py > g->camera_y + g->world_h * 0.58f) {
             continue;
         }
-        vg_fill_style pf = make_fill(1.0f, (vg_color){p->r, p->g, p->bcol, p->a}, VG_BLEND_ADDITIVE);
-        vg_stroke_style ps = make_stroke(1.0f, 1.0f, (vg_color){p->r, p->g, p->bcol, p->a}, VG_BLEND_ADDITIVE);
-        const int simplify_geom = (active_particles > 520);
-        if (p->type == PARTICLE_POINT || p->type == PARTICLE_FLASH || simplify_geom) {
-            const float rr = (p->type == PARTICLE_FLASH) ? (p->size * 1.7f) : p->size;
-            r = vg_fill_circle(ctx, (vg_vec2){p->b.x, p->b.y}, rr, &pf, 8);
+        vg_fill_style pf = make_fill(1.0f, col, VG_BLEND_ADDITIVE);
+        vg_stroke_style ps_stroke = make_stroke(1.0f, 1.0f, col, VG_BLEND_ADDITIVE);
+        if (type == PARTICLE_POINT || type == PARTICLE_FLASH || simplify_geom) {
+            const float rr = (type == PARTICLE_FLASH) ? (size * 1.7f) : size;
+            r = vg_fill_circle(ctx, (vg_vec2){px, py}, rr, &pf, 8);
             if (r != VG_OK) {
                 (void)vg_transform_pop(ctx);
                 return r;
             }
         } else {
-            const float c = cosf(p->spin);
-            const float s = sinf(p->spin);
-            const float r0 = p->size * 1.25f;
+            const float c = cosf(ps->spin[i]);
+            const float s = sinf(ps->spin[i]);
+            const float r0 = size * 1.25f;
             const vg_vec2 geom[] = {
-                {p->b.x + c * r0, p->b.y + s * r0},
-                {p->b.x - s * p->size, p->b.y + c * p->size},
-                {p->b.x - c * r0, p->b.y - s * r0},
-                {p->b.x + s * p->size, p->b.y - c * p->size}
+                {px + c * r0, py + s * r0},
+                {px - s * size, py + c * size},
+                {px - c * r0, py - s * r0},
+                {px + s * size, py - c * size}
             };
             r = vg_fill_convex(ctx, geom, 4, &pf);
             if (r != VG_OK) {
                 (void)vg_transform_pop(ctx);
                 return r;
             }
-            r = vg_draw_polyline(ctx, geom, 4, &ps, 1);
+            r = vg_draw_polyline(ctx, geom, 4, &ps_stroke, 1);
             if (r != VG_OK) {
                 (void)vg_transform_pop(ctx);
                 return r;
@@ -12498,7 +12606,7 @@ skip_legacy_landscape:
     }
 
     if (g->lives > 0) {
-        r = draw_player_ship(ctx, g, metrics, &ship_style, &thruster_fill);
+        r = draw_player_ship(ctx, g, v->player_x, v->player_y, v->player_facing_x, metrics, &ship_style, &thruster_fill);
         if (r != VG_OK) {
             (void)vg_transform_pop(ctx);
             return r;
@@ -12506,8 +12614,8 @@ skip_legacy_landscape:
         if (g->shield_active && g->shield_time_remaining_s > 0.0f) {
             r = draw_player_shield(
                 ctx,
-                g->player.b.x,
-                g->player.b.y,
+                v->player_x,
+                v->player_y,
                 g->shield_radius,
                 g->t,
                 &shield_glow,
@@ -12519,11 +12627,8 @@ skip_legacy_landscape:
             }
         }
     }
-    for (int i = 0; i < MAX_POWERUPS; ++i) {
+    for (int i = slot_pool_next(&g->powerup_pool, 0); i >= 0; i = slot_pool_next(&g->powerup_pool, i + 1)) {
         const powerup_pickup* p = &g->powerups[i];
-        if (!p->active) {
-            continue;
-        }
         if (!rects_intersect(
                 p->b.x - p->radius,
                 p->b.y - p->radius,
@@ -12554,18 +12659,16 @@ skip_legacy_landscape:
         }
     }
     if (g->emp_effect_active) {
-        r = draw_emp_blast(ctx, g, &pal, intensity_scale, 0);
+        r = draw_emp_blast(ctx, v, &pal, intensity_scale, 0);
         if (r != VG_OK) {
             (void)vg_transform_pop(ctx);
             return r;
         }
     }
 
-    for (size_t i = 0; i < MAX_BULLETS; ++i) {
-        if (!g->bullets[i].active) {
-            continue;
-        }
+    for (int i = slot_pool_next(&g->bullet_pool, 0); i >= 0; i = slot_pool_next(&g->bullet_pool, i + 1)) {
         const bullet* b = &g->bullets[i];
+        const vg_vec2 bp = v->bullets[i];
         float ux = b->b.vx;
         float uy = b->b.vy;
         float speed = sqrtf(ux * ux + uy * uy);
@@ -12581,12 +12684,12 @@ skip_legacy_landscape:
         const float core_b = 8.0f;
         const float trail = 22.0f + clampf(speed * 0.030f, 10.0f, 34.0f);
         const vg_vec2 seg_tail[] = {
-            {b->b.x - ux * trail, b->b.y - uy * trail},
-            {b->b.x - ux * core_b, b->b.y - uy * core_b}
+            {bp.x - ux * trail, bp.y - uy * trail},
+            {bp.x - ux * core_b, bp.y - uy * core_b}
         };
         const vg_vec2 seg_core[] = {
-            {b->b.x - ux * core_b, b->b.y - uy * core_b},
-            {b->b.x + ux * core_f, b->b.y + uy * core_f}
+            {bp.x - ux * core_b, bp.y - uy * core_b},
+            {bp.x + ux * core_f, bp.y + uy * core_f}
         };
         {
             const float min_x = fminf(seg_tail[0].x, fminf(seg_tail[1].x, seg_core[1].x));
@@ -12635,11 +12738,9 @@ skip_legacy_landscape:
         }
     }
 
-    for (size_t i = 0; i < MAX_ENEMY_BULLETS; ++i) {
-        if (!g->enemy_bullets[i].active) {
-            continue;
-        }
+    for (int i = slot_pool_next(&g->enemy_bullet_pool, 0); i >= 0; i = slot_pool_next(&g->enemy_bullet_pool, i + 1)) {
         const enemy_bullet* b = &g->enemy_bullets[i];
+        const vg_vec2 bp = v->enemy_bullets[i];
         float ux = b->b.vx;
         float uy = b->b.vy;
         float speed = sqrtf(ux * ux + uy * uy);
@@ -12655,12 +12756,12 @@ skip_legacy_landscape:
         const float core_b = 6.2f;
         const float trail = 16.0f + clampf(speed * 0.026f, 7.0f, 24.0f);
         const vg_vec2 seg_tail[] = {
-            {b->b.x - ux * trail, b->b.y - uy * trail},
-            {b->b.x - ux * core_b, b->b.y - uy * core_b}
+            {bp.x - ux * trail, bp.y - uy * trail},
+            {bp.x - ux * core_b, bp.y - uy * core_b}
         };
         const vg_vec2 seg_core[] = {
-            {b->b.x - ux * core_b, b->b.y - uy * core_b},
-            {b->b.x + ux * core_f, b->b.y + uy * core_f}
+            {bp.x - ux * core_b, bp.y - uy * core_b},
+            {bp.x + ux * core_f, bp.y + uy * core_f}
         };
         {
             const float min_x = fminf(seg_tail[0].x, fminf(seg_tail[1].x, seg_core[1].x));
@@ -12709,9 +12810,9 @@ skip_legacy_landscape:
         }
     }
 
-    for (size_t i = 0; i < MAX_EEL_ARCS; ++i) {
+    for (int i = slot_pool_next(&g->eel_arc_pool, 0); i >= 0; i = slot_pool_next(&g->eel_arc_pool, i + 1)) {
         const eel_arc_effect* arc = &g->eel_arcs[i];
-        if (!arc->active || !arc->pulse_emit_on || arc->point_count < 2 || !eel_arc_pulse_is_on(arc)) {
+        if (!arc->pulse_emit_on || arc->point_count < 2 || !eel_arc_pulse_is_on(arc)) {
             continue;
         }
         {
@@ -12796,9 +12897,9 @@ skip_legacy_landscape:
         }
     }
 
-    for (size_t i = 0; i < MAX_ENEMY_DEBRIS; ++i) {
+    for (int i = slot_pool_next(&g->debris_pool, 0); i >= 0; i = slot_pool_next(&g->debris_pool, i + 1)) {
         const enemy_debris* dbr = &g->debris[i];
-        if (!dbr->active || dbr->alpha <= 0.01f) {
+        if (dbr->alpha <= 0.01f) {
             continue;
         }
         const float c = cosf(dbr->angle);
@@ -12833,7 +12934,7 @@ skip_legacy_landscape:
 
     r = draw_boss_connector_struts(
         ctx,
-        g,
+        v,
         world_cull_min_x,
         world_cull_min_y,
         world_cull_max_x,
@@ -12845,11 +12946,10 @@ skip_legacy_landscape:
         return r;
     }
 
-    for (size_t i = 0; i < MAX_ENEMIES; ++i) {
-        if (!g->enemies[i].active) {
-            continue;
-        }
-        const enemy* e = &g->enemies[i];
+    for (int k = 0; k < v->live_enemy_count; ++k) {
+        const int i = v->live_enemies[k];
+        enemy e_view;
+        const enemy* e = view_enemy(v, i, &e_view);
         const float rr = e->radius;
         if (!rects_intersect(
                 e->b.x - rr,
@@ -12862,7 +12962,7 @@ skip_legacy_landscape:
                 world_cull_max_y)) {
             continue;
         }
-        r = draw_enemy_glyph(ctx, e, e->b.x, e->b.y, rr, &enemy_style);
+        r = draw_enemy_glyph(ctx, e, view_eel_spine(v, i), e->b.x, e->b.y, rr, &enemy_style);
         if (r != VG_OK) {
             (void)vg_transform_pop(ctx);
             return r;
@@ -12877,6 +12977,9 @@ skip_legacy_landscape:
     if (r == VG_OK && metrics->show_fps) {
         r = draw_fps_overlay(ctx, g->world_w, g->world_h, metrics->fps, &txt_halo, &txt_main);
     }
+    if (r == VG_OK && metrics->show_sim_profile) {
+        r = draw_sim_profile_overlay(ctx, g, &txt_halo, &txt_main);
+    }
     if (r == VG_OK && metrics->show_crt_ui) {
         vg_crt_profile crt_ui;
         vg_get_crt_profile(ctx, &crt_ui);
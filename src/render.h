@@ -58,6 +58,7 @@ typedef struct render_metrics {
     float dt;
     float sim_alpha;
     int show_fps;
+    int show_sim_profile;
     float ui_time_s;
     int force_clear;
     int show_crt_ui;
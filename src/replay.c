@@ -0,0 +1,287 @@
+#include "replay.h"
+
+#include <string.h>
+
+#define REPLAY_MAGIC "VSRP"
+#define REPLAY_VERSION 2u
+
+/* Tick byte: bits 0-6 are game_input fields, bit 7 means events precede the tick. */
+#define REPLAY_TICK_EVENTS 0x80u
+
+enum replay_event_kind {
+    REPLAY_EVENT_END = 0,
+    REPLAY_EVENT_LEVEL = 1,
+    REPLAY_EVENT_ALT_WEAPON = 2,
+    REPLAY_EVENT_WORLD_SIZE = 3
+};
+
+static void put_u32(FILE* f, uint32_t v) {
+    const unsigned char b[4] = {
+        (unsigned char)(v & 0xffu),
+        (unsigned char)((v >> 8) & 0xffu),
+        (unsigned char)((v >> 16) & 0xffu),
+        (unsigned char)((v >> 24) & 0xffu)
+    };
+    fwrite(b, 1, sizeof(b), f);
+}
+
+static void put_f32(FILE* f, float v) {
+    uint32_t u;
+    memcpy(&u, &v, sizeof(u));
+    put_u32(f, u);
+}
+
+static int get_u32(FILE* f, uint32_t* out) {
+    unsigned char b[4];
+    if (fread(b, 1, sizeof(b), f) != sizeof(b)) {
+        return 0;
+    }
+    *out = (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+    return 1;
+}
+
+static int get_f32(FILE* f, float* out) {
+    uint32_t u;
+    if (!get_u32(f, &u)) {
+        return 0;
+    }
+    memcpy(out, &u, sizeof(*out));
+    return 1;
+}
+
+static unsigned int pack_input(const game_input* in) {
+    return (in->left ? 0x01u : 0u) |
+           (in->right ? 0x02u : 0u) |
+           (in->up ? 0x04u : 0u) |
+           (in->down ? 0x08u : 0u) |
+           (in->fire ? 0x10u : 0u) |
+           (in->secondary_fire ? 0x20u : 0u) |
+           (in->restart ? 0x40u : 0u);
+}
+
+static void unpack_input(unsigned int bits, game_input* in) {
+    memset(in, 0, sizeof(*in));
+    in->left = (bits & 0x01u) ? 1 : 0;
+    in->right = (bits & 0x02u) ? 1 : 0;
+    in->up = (bits & 0x04u) ? 1 : 0;
+    in->down = (bits & 0x08u) ? 1 : 0;
+    in->fire = (bits & 0x10u) ? 1 : 0;
+    in->secondary_fire = (bits & 0x20u) ? 1 : 0;
+    in->restart = (bits & 0x40u) ? 1 : 0;
+}
+
+/* Both sides rebuild the start state the same way so the first tick matches. */
+static void apply_start_state(game_state* g, const replay_header* h) {
+    const game_capacity caps = g->caps;
+    game_init_with_capacity(g, h->world_w, h->world_h, &caps);
+    game_set_ai_lod(g, h->ai_lod);
+    (void)game_set_level_by_name(g, h->level_name);
+    game_set_rng_seed(g, h->seed);
+    game_set_alt_weapon(g, h->alt_weapon);
+}
+
+int replay_writer_open(replay_writer* w, const char* path) {
+    if (!w || !path) {
+        return 0;
+    }
+    memset(w, 0, sizeof(*w));
+    w->f = fopen(path, "wb");
+    if (!w->f) {
+        fprintf(stderr, "replay: could not open %s for writing\n", path);
+        return 0;
+    }
+    return 1;
+}
+
+static void writer_begin(replay_writer* w, game_state* g, float dt) {
+    replay_header h;
+    memset(&h, 0, sizeof(h));
+    h.seed = g->rng_seed;
+    h.dt_s = dt;
+    h.world_w = g->world_w;
+    h.world_h = g->world_h;
+    h.alt_weapon = game_get_alt_weapon(g);
+    h.ai_lod = g->ai_lod;
+    snprintf(h.level_name, sizeof(h.level_name), "%s", game_current_level_name(g));
+    apply_start_state(g, &h);
+
+    fwrite(REPLAY_MAGIC, 1, 4, w->f);
+    put_u32(w->f, REPLAY_VERSION);
+    put_u32(w->f, h.seed);
+    put_f32(w->f, h.dt_s);
+    put_f32(w->f, h.world_w);
+    put_f32(w->f, h.world_h);
+    put_u32(w->f, (uint32_t)h.alt_weapon);
+    put_u32(w->f, (uint32_t)h.ai_lod);
+    fwrite(h.level_name, 1, sizeof(h.level_name), w->f);
+    w->started = 1;
+}
+
+static void writer_note_state(replay_writer* w, const game_state* g) {
+    w->last_level_index = g->level_index;
+    w->last_alt_weapon = g->alt_weapon_equipped;
+    w->last_world_w = g->world_w;
+    w->last_world_h = g->world_h;
+}
+
+/* Logs the tick (and any outside changes since the last one), then steps the game. */
+void replay_writer_update(replay_writer* w, game_state* g, float dt, const game_input* in) {
+    unsigned int bits;
+    int level_changed;
+    int weapon_changed;
+    int size_changed;
+    if (!w || !w->f || !g || !in) {
+        if (g && in) {
+            game_update(g, dt, in);
+        }
+        return;
+    }
+    if (!w->started) {
+        writer_begin(w, g, dt);
+        writer_note_state(w, g);
+    }
+    level_changed = g->level_index != w->last_level_index;
+    weapon_changed = g->alt_weapon_equipped != w->last_alt_weapon;
+    size_changed = g->world_w != w->last_world_w || g->world_h != w->last_world_h;
+    bits = pack_input(in);
+    if (level_changed || weapon_changed || size_changed) {
+        fputc((int)(bits | REPLAY_TICK_EVENTS), w->f);
+        if (level_changed) {
+            const char* name = game_current_level_name(g);
+            size_t n = strlen(name);
+            if (n > REPLAY_LEVEL_NAME_CAP - 1) {
+                n = REPLAY_LEVEL_NAME_CAP - 1;
+            }
+            fputc(REPLAY_EVENT_LEVEL, w->f);
+            fputc((int)n, w->f);
+            fwrite(name, 1, n, w->f);
+        }
+        if (weapon_changed) {
+            fputc(REPLAY_EVENT_ALT_WEAPON, w->f);
+            fputc(g->alt_weapon_equipped, w->f);
+        }
+        if (size_changed) {
+            fputc(REPLAY_EVENT_WORLD_SIZE, w->f);
+            put_f32(w->f, g->world_w);
+            put_f32(w->f, g->world_h);
+        }
+        fputc(REPLAY_EVENT_END, w->f);
+    } else {
+        fputc((int)bits, w->f);
+    }
+    game_update(g, dt, in);
+    writer_note_state(w, g);
+    w->ticks += 1u;
+}
+
+void replay_writer_close(replay_writer* w) {
+    if (!w || !w->f) {
+        return;
+    }
+    fclose(w->f);
+    w->f = NULL;
+}
+
+int replay_reader_open(replay_reader* r, const char* path) {
+    char magic[4];
+    uint32_t version = 0u;
+    uint32_t alt = 0u;
+    uint32_t ai_lod = 0u;
+    if (!r || !path) {
+        return 0;
+    }
+    memset(r, 0, sizeof(*r));
+    r->f = fopen(path, "rb");
+    if (!r->f) {
+        fprintf(stderr, "replay: could not open %s\n", path);
+        return 0;
+    }
+    if (fread(magic, 1, sizeof(magic), r->f) != sizeof(magic) || memcmp(magic, REPLAY_MAGIC, sizeof(magic)) != 0 ||
+        !get_u32(r->f, &version) || version != REPLAY_VERSION ||
+        !get_u32(r->f, &r->header.seed) ||
+        !get_f32(r->f, &r->header.dt_s) ||
+        !get_f32(r->f, &r->header.world_w) ||
+        !get_f32(r->f, &r->header.world_h) ||
+        !get_u32(r->f, &alt) ||
+        !get_u32(r->f, &ai_lod) ||
+        fread(r->header.level_name, 1, sizeof(r->header.level_name), r->f) != sizeof(r->header.level_name) ||
+        r->header.dt_s <= 0.0f || r->header.world_w <= 0.0f || r->header.world_h <= 0.0f) {
+        fprintf(stderr, "replay: %s is not a version %u replay\n", path, REPLAY_VERSION);
+        fclose(r->f);
+        r->f = NULL;
+        return 0;
+    }
+    r->header.alt_weapon = (int)alt;
+    r->header.ai_lod = ai_lod ? 1 : 0;
+    r->header.level_name[REPLAY_LEVEL_NAME_CAP - 1] = '\0';
+    return 1;
+}
+
+static int reader_apply_events(replay_reader* r, game_state* g) {
+    for (;;) {
+        const int kind = fgetc(r->f);
+        if (kind == REPLAY_EVENT_END) {
+            return 1;
+        }
+        if (kind == REPLAY_EVENT_LEVEL) {
+            char name[REPLAY_LEVEL_NAME_CAP];
+            const int n = fgetc(r->f);
+            if (n < 0 || n >= REPLAY_LEVEL_NAME_CAP || fread(name, 1, (size_t)n, r->f) != (size_t)n) {
+                return 0;
+            }
+            name[n] = '\0';
+            if (!game_set_level_by_name(g, name)) {
+                fprintf(stderr, "replay: unknown level '%s' at tick %u\n", name, (unsigned int)r->ticks);
+            }
+        } else if (kind == REPLAY_EVENT_ALT_WEAPON) {
+            const int weapon = fgetc(r->f);
+            if (weapon < 0) {
+                return 0;
+            }
+            game_set_alt_weapon(g, weapon);
+        } else if (kind == REPLAY_EVENT_WORLD_SIZE) {
+            float ww = 0.0f;
+            float wh = 0.0f;
+            if (!get_f32(r->f, &ww) || !get_f32(r->f, &wh)) {
+                return 0;
+            }
+            game_set_world_size(g, ww, wh);
+        } else {
+            return 0;
+        }
+    }
+}
+
+/* Steps the game by one recorded tick; returns 0 once the recording is exhausted. */
+int replay_reader_update(replay_reader* r, game_state* g) {
+    game_input in;
+    int c;
+    if (!r || !r->f || !g) {
+        return 0;
+    }
+    if (!r->started) {
+        apply_start_state(g, &r->header);
+        r->started = 1;
+    }
+    c = fgetc(r->f);
+    if (c == EOF) {
+        return 0;
+    }
+    if (((unsigned int)c & REPLAY_TICK_EVENTS) && !reader_apply_events(r, g)) {
+        fprintf(stderr, "replay: corrupt event block at tick %u\n", (unsigned int)r->ticks);
+        return 0;
+    }
+    unpack_input((unsigned int)c, &in);
+    r->tick_level_index = g->level_index;
+    game_update(g, r->header.dt_s, &in);
+    r->ticks += 1u;
+    return 1;
+}
+
+void replay_reader_close(replay_reader* r) {
+    if (!r || !r->f) {
+        return;
+    }
+    fclose(r->f);
+    r->f = NULL;
+}
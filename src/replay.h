@@ -0,0 +1,56 @@
+#ifndef V_TYPE_REPLAY_H
+#define V_TYPE_REPLAY_H
+
+#include "game.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define REPLAY_LEVEL_NAME_CAP 64
+
+/*
+ * Input capture for deterministic re-runs. A file holds the start state
+ * (level, RNG seed, world size, alt weapon, AI LOD, step size) and then one byte of
+ * game_input per tick. Level, alt-weapon and world-size changes made outside
+ * game_update are logged as events ahead of the tick they precede.
+ *
+ * Both sides start from game_init + level + seed + alt weapon, so recording
+ * resets the game on its first tick.
+ */
+typedef struct replay_header {
+    uint32_t seed;
+    float dt_s;
+    float world_w;
+    float world_h;
+    int alt_weapon;
+    int ai_lod; /* LOD changes how the simulation plays out, so playback uses the recorder's setting. */
+    char level_name[REPLAY_LEVEL_NAME_CAP];
+} replay_header;
+
+typedef struct replay_writer {
+    FILE* f;
+    int started;
+    uint32_t ticks;
+    int last_level_index;
+    int last_alt_weapon;
+    float last_world_w;
+    float last_world_h;
+} replay_writer;
+
+typedef struct replay_reader {
+    FILE* f;
+    replay_header header;
+    int started;
+    uint32_t ticks;
+    int tick_level_index; /* level the last tick started on, after its events */
+} replay_reader;
+
+int replay_writer_open(replay_writer* w, const char* path);
+void replay_writer_update(replay_writer* w, game_state* g, float dt, const game_input* in);
+void replay_writer_close(replay_writer* w);
+
+int replay_reader_open(replay_reader* r, const char* path);
+int replay_reader_update(replay_reader* r, game_state* g);
+void replay_reader_close(replay_reader* r);
+
+#endif
@@ -0,0 +1,20 @@
+#include "sim_script.h"
+
+#include <string.h>
+
+void sim_script_sweep_input(int tick, game_input* in) {
+    const int weave_period = 180;
+    const int drift_period = 600;
+    const int weave = tick % weave_period;
+    const int drift = tick % drift_period;
+    if (!in) {
+        return;
+    }
+    memset(in, 0, sizeof(*in));
+    in->fire = 1;
+    in->up = (weave < weave_period / 2) ? 1 : 0;
+    in->down = in->up ? 0 : 1;
+    in->right = (drift < drift_period - 90) ? 1 : 0;
+    in->left = in->right ? 0 : 1;
+    in->secondary_fire = ((tick % 480) < 30) ? 1 : 0;
+}
@@ -0,0 +1,12 @@
+#ifndef V_TYPE_SIM_SCRIPT_H
+#define V_TYPE_SIM_SCRIPT_H
+
+#include "game.h"
+
+/*
+ * Deterministic pilot shared by vs_headless --script sweep and the golden
+ * test: holds fire, weaves vertically and drifts forward with short reversals.
+ */
+void sim_script_sweep_input(int tick, game_input* in);
+
+#endif
@@ -0,0 +1,112 @@
+#include "slot_pool.h"
+
+#include <string.h>
+
+static int lowest_bit(uint64_t w) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(w);
+#else
+    int b = 0;
+    while ((w & 1u) == 0u) {
+        w >>= 1;
+        ++b;
+    }
+    return b;
+#endif
+}
+
+void slot_pool_clear(slot_pool* p) {
+    if (!p) {
+        return;
+    }
+    memset(p, 0, sizeof(*p));
+}
+
+int slot_pool_alloc(slot_pool* p, int capacity) {
+    if (!p) {
+        return -1;
+    }
+    if (capacity > SLOT_POOL_MAX_SLOTS) {
+        capacity = SLOT_POOL_MAX_SLOTS;
+    }
+    for (int w = 0; w * 64 < capacity; ++w) {
+        const uint64_t free_bits = ~p->bits[w];
+        if (free_bits != 0u) {
+            const int slot = w * 64 + lowest_bit(free_bits);
+            if (slot >= capacity) {
+                return -1;
+            }
+            p->bits[w] |= (uint64_t)1u << (slot & 63);
+            p->live += 1;
+            return slot;
+        }
+    }
+    return -1;
+}
+
+void slot_pool_mark(slot_pool* p, int slot) {
+    uint64_t bit;
+    if (!p || slot < 0 || slot >= SLOT_POOL_MAX_SLOTS) {
+        return;
+    }
+    bit = (uint64_t)1u << (slot & 63);
+    if ((p->bits[slot >> 6] & bit) == 0u) {
+        p->bits[slot >> 6] |= bit;
+        p->live += 1;
+    }
+}
+
+void slot_pool_release(slot_pool* p, int slot) {
+    uint64_t bit;
+    if (!p || slot < 0 || slot >= SLOT_POOL_MAX_SLOTS) {
+        return;
+    }
+    bit = (uint64_t)1u << (slot & 63);
+    if ((p->bits[slot >> 6] & bit) != 0u) {
+        p->bits[slot >> 6] &= ~bit;
+        p->live -= 1;
+    }
+}
+
+/* Returns the first live slot >= from, or -1. */
+int slot_pool_next(const slot_pool* p, int from) {
+    int w;
+    uint64_t bits;
+    if (!p || from < 0 || from >= SLOT_POOL_MAX_SLOTS) {
+        return -1;
+    }
+    w = from >> 6;
+    bits = p->bits[w] & (~(uint64_t)0u << (from & 63));
+    for (;;) {
+        if (bits != 0u) {
+            return w * 64 + lowest_bit(bits);
+        }
+        if (++w >= SLOT_POOL_WORDS) {
+            return -1;
+        }
+        bits = p->bits[w];
+    }
+}
+
+int slot_pool_has(const slot_pool* p, int slot) {
+    if (!p || slot < 0 || slot >= SLOT_POOL_MAX_SLOTS) {
+        return 0;
+    }
+    return (p->bits[slot >> 6] >> (slot & 63)) & 1u ? 1 : 0;
+}
+
+/* Writes up to cap live slots to out in ascending order; returns how many. */
+int slot_pool_collect(const slot_pool* p, int* out, int cap) {
+    int n = 0;
+    if (!p || !out) {
+        return 0;
+    }
+    for (int w = 0; w < SLOT_POOL_WORDS && n < cap; ++w) {
+        uint64_t bits = p->bits[w];
+        while (bits != 0u && n < cap) {
+            out[n++] = w * 64 + lowest_bit(bits);
+            bits &= bits - 1u;
+        }
+    }
+    return n;
+}
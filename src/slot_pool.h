@@ -0,0 +1,30 @@
+#ifndef V_TYPE_SLOT_POOL_H
+#define V_TYPE_SLOT_POOL_H
+
+#include <stdint.h>
+
+#ifndef SLOT_POOL_MAX_SLOTS
+#define SLOT_POOL_MAX_SLOTS 1024 /* Must be a multiple of 64. */
+#endif
+#define SLOT_POOL_WORDS (SLOT_POOL_MAX_SLOTS / 64)
+
+/*
+ * Live-slot bitset for a fixed entity array. A zeroed pool is empty.
+ * Allocation hands out the lowest free slot, matching the old "first
+ * !active" scans so slot order (and therefore update order) is unchanged.
+ * Iteration skips whole empty words, so sparse arrays cost almost nothing.
+ */
+typedef struct slot_pool {
+    int live;
+    uint64_t bits[SLOT_POOL_WORDS];
+} slot_pool;
+
+void slot_pool_clear(slot_pool* p);
+int slot_pool_alloc(slot_pool* p, int capacity);
+void slot_pool_mark(slot_pool* p, int slot);
+void slot_pool_release(slot_pool* p, int slot);
+int slot_pool_next(const slot_pool* p, int from);
+int slot_pool_has(const slot_pool* p, int slot);
+int slot_pool_collect(const slot_pool* p, int* out, int cap);
+
+#endif
@@ -0,0 +1,596 @@
+#include "snapshot.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define SNAPSHOT_MAGIC "VSSS"
+#define SNAPSHOT_VERSION 5u
+
+typedef struct snapshot_writer {
+    uint8_t* out;
+    size_t cap;
+    size_t n;
+} snapshot_writer;
+
+typedef struct snapshot_reader {
+    const uint8_t* data;
+    size_t size;
+    size_t n;
+    int ok;
+} snapshot_reader;
+
+typedef struct snapshot_range {
+    size_t offset;
+    size_t size;
+} snapshot_range;
+
+/* Largest array written with a live-slot bitmask. */
+#define SNAPSHOT_MASK_CAP ((MAX_ENEMIES > MAX_ASTEROIDS) ? MAX_ENEMIES : MAX_ASTEROIDS)
+#if MAX_ENEMIES > SNAPSHOT_MASK_CAP || MAX_MISSILE_LAUNCHERS > SNAPSHOT_MASK_CAP || MAX_ARC_NODES > SNAPSHOT_MASK_CAP || \
+    MAX_SEARCHLIGHTS > SNAPSHOT_MASK_CAP
+#error "SNAPSHOT_MASK_CAP must cover every array written with put_active_entries"
+#endif
+
+#define SNAPSHOT_FIELD(f) { offsetof(game_state, f), sizeof(((const game_state*)0)->f) }
+
+/* Fields written entry-by-entry below, in declaration order; every other byte of game_state is copied as is. */
+static const snapshot_range k_compact_fields[] = {
+    SNAPSHOT_FIELD(bullets),
+    SNAPSHOT_FIELD(prev_bullets),
+    SNAPSHOT_FIELD(enemy_bullets),
+    SNAPSHOT_FIELD(prev_enemy_bullets),
+    SNAPSHOT_FIELD(enemies),
+    SNAPSHOT_FIELD(prev_enemies),
+    SNAPSHOT_FIELD(eel_spines),
+    SNAPSHOT_FIELD(prev_eel_spines),
+    SNAPSHOT_FIELD(particles),
+    SNAPSHOT_FIELD(debris),
+    SNAPSHOT_FIELD(audio_events),
+    SNAPSHOT_FIELD(searchlights),
+    SNAPSHOT_FIELD(asteroids),
+    SNAPSHOT_FIELD(mines),
+    SNAPSHOT_FIELD(missile_launchers),
+    SNAPSHOT_FIELD(missiles),
+    SNAPSHOT_FIELD(prev_missiles),
+    SNAPSHOT_FIELD(prev_missile_heading),
+    SNAPSHOT_FIELD(arc_nodes),
+    SNAPSHOT_FIELD(powerups),
+    SNAPSHOT_FIELD(eel_arcs),
+    SNAPSHOT_FIELD(boss_attachments),
+    SNAPSHOT_FIELD(boss_controllers),
+    SNAPSHOT_FIELD(enemy_hash),
+    SNAPSHOT_FIELD(bullet_hash),
+    SNAPSHOT_FIELD(swarm_hash),
+    /* Level-derived: never written, rebuilt from the level once a load succeeds. */
+    SNAPSHOT_FIELD(structure_index),
+    SNAPSHOT_FIELD(enemy_structure_index),
+    SNAPSHOT_FIELD(structure_field),
+    SNAPSHOT_FIELD(profile) /* Timing, not state: never written, and left alone on load. */
+};
+
+static void put(snapshot_writer* w, const void* p, size_t len) {
+    if (w->out && len <= w->cap && w->n <= w->cap - len) {
+        memcpy(w->out + w->n, p, len);
+    }
+    w->n += len;
+}
+
+static void put_u32(snapshot_writer* w, uint32_t v) {
+    put(w, &v, sizeof(v));
+}
+
+static void get(snapshot_reader* r, void* p, size_t len) {
+    if (!r->ok || len > r->size || r->n > r->size - len) {
+        r->ok = 0;
+        return;
+    }
+    memcpy(p, r->data + r->n, len);
+    r->n += len;
+}
+
+static uint32_t get_u32(snapshot_reader* r) {
+    uint32_t v = 0u;
+    get(r, &v, sizeof(v));
+    return v;
+}
+
+static void put_scalars(snapshot_writer* w, const game_state* g) {
+    const uint8_t* base = (const uint8_t*)g;
+    size_t at = 0;
+    for (size_t i = 0; i < sizeof(k_compact_fields) / sizeof(k_compact_fields[0]); ++i) {
+        put(w, base + at, k_compact_fields[i].offset - at);
+        at = k_compact_fields[i].offset + k_compact_fields[i].size;
+    }
+    put(w, base + at, sizeof(*g) - at);
+}
+
+static void get_scalars(snapshot_reader* r, game_state* g) {
+    uint8_t* base = (uint8_t*)g;
+    size_t at = 0;
+    for (size_t i = 0; i < sizeof(k_compact_fields) / sizeof(k_compact_fields[0]); ++i) {
+        get(r, base + at, k_compact_fields[i].offset - at);
+        at = k_compact_fields[i].offset + k_compact_fields[i].size;
+    }
+    get(r, base + at, sizeof(*g) - at);
+}
+
+/* Pool-tracked arrays: the pool itself is a scalar, so only its live slots are written. */
+static void put_pool_entries(snapshot_writer* w, const slot_pool* p, const void* base, size_t stride) {
+    const uint8_t* b = (const uint8_t*)base;
+    for (int i = slot_pool_next(p, 0); i >= 0; i = slot_pool_next(p, i + 1)) {
+        put(w, b + (size_t)i * stride, stride);
+    }
+}
+
+static void get_pool_entries(snapshot_reader* r, const slot_pool* p, void* base, size_t stride, int cap) {
+    uint8_t* b = (uint8_t*)base;
+    int next = 0;
+    for (int i = slot_pool_next(p, 0); i >= 0 && r->ok; i = slot_pool_next(p, i + 1)) {
+        if (i >= cap) {
+            r->ok = 0;
+            return;
+        }
+        memset(b + (size_t)next * stride, 0, (size_t)(i - next) * stride);
+        get(r, b + (size_t)i * stride, stride);
+        next = i + 1;
+    }
+    memset(b + (size_t)next * stride, 0, (size_t)(cap - next) * stride);
+}
+
+/* Arrays whose entries lead with an `int active` flag: a live-slot bitmask, then the live entries. */
+static int entry_active(const uint8_t* entry) {
+    int active;
+    memcpy(&active, entry, sizeof(active));
+    return active;
+}
+
+static void put_active_entries(snapshot_writer* w, const void* base, size_t stride, int cap) {
+    const uint8_t* b = (const uint8_t*)base;
+    uint8_t mask[(SNAPSHOT_MASK_CAP + 7) / 8];
+    memset(mask, 0, sizeof(mask));
+    for (int i = 0; i < cap; ++i) {
+        if (entry_active(b + (size_t)i * stride)) {
+            mask[i >> 3] |= (uint8_t)(1u << (i & 7));
+        }
+    }
+    put(w, mask, (size_t)(cap + 7) / 8);
+    for (int i = 0; i < cap; ++i) {
+        if (mask[i >> 3] & (1u << (i & 7))) {
+            put(w, b + (size_t)i * stride, stride);
+        }
+    }
+}
+
+static void get_active_entries(snapshot_reader* r, void* base, size_t stride, int cap) {
+    uint8_t* b = (uint8_t*)base;
+    uint8_t mask[(SNAPSHOT_MASK_CAP + 7) / 8];
+    get(r, mask, (size_t)(cap + 7) / 8);
+    if (!r->ok) {
+        return;
+    }
+    for (int i = 0; i < cap; ++i) {
+        uint8_t* e = b + (size_t)i * stride;
+        if (mask[i >> 3] & (1u << (i & 7))) {
+            get(r, e, stride);
+        } else {
+            memset(e, 0, stride);
+        }
+    }
+}
+
+/* One spine per live owner (enemies or prev_enemies), cut to its point count; the rest is stale. */
+static void put_eel_spines(snapshot_writer* w, const void* owners, size_t stride, const enemy_eel_spine* spines) {
+    const uint8_t* b = (const uint8_t*)owners;
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const enemy_eel_spine* s = &spines[i];
+        if (!entry_active(b + (size_t)i * stride)) {
+            continue;
+        }
+        put(w, &s->count, sizeof(s->count));
+        put(w, s->x, (size_t)s->count * sizeof(s->x[0]));
+        put(w, s->y, (size_t)s->count * sizeof(s->y[0]));
+    }
+}
+
+static void get_eel_spines(snapshot_reader* r, const void* owners, size_t stride, enemy_eel_spine* spines) {
+    const uint8_t* b = (const uint8_t*)owners;
+    for (int i = 0; i < MAX_ENEMIES && r->ok; ++i) {
+        enemy_eel_spine* s = &spines[i];
+        memset(s, 0, sizeof(*s));
+        if (!entry_active(b + (size_t)i * stride)) {
+            continue;
+        }
+        get(r, &s->count, sizeof(s->count));
+        if (!r->ok || s->count < 0 || s->count > EEL_SPINE_POINTS) {
+            r->ok = 0;
+            return;
+        }
+        get(r, s->x, (size_t)s->count * sizeof(s->x[0]));
+        get(r, s->y, (size_t)s->count * sizeof(s->y[0]));
+    }
+}
+
+#define PARTICLE_COLUMNS(X) X(x) X(y) X(vx) X(vy) X(ax) X(ay) X(age_s) X(life_s) X(size) X(spin) X(spin_rate) X(r) X(g) X(b) X(a) X(type)
+
+static void put_particles(snapshot_writer* w, const particle_store* s) {
+    const size_t n = (size_t)s->count;
+    put(w, &s->count, sizeof(s->count));
+#define PUT_COLUMN(c) put(w, s->c, n * sizeof(s->c[0]));
+    PARTICLE_COLUMNS(PUT_COLUMN)
+#undef PUT_COLUMN
+}
+
+static void get_particles(snapshot_reader* r, particle_store* s) {
+    size_t n;
+    get(r, &s->count, sizeof(s->count));
+    if (!r->ok || s->count < 0 || s->count > PARTICLE_STORE_CAP) {
+        r->ok = 0;
+        s->count = 0;
+        return;
+    }
+    n = (size_t)s->count;
+#define GET_COLUMN(c) get(r, s->c, n * sizeof(s->c[0]));
+    PARTICLE_COLUMNS(GET_COLUMN)
+#undef GET_COLUMN
+}
+
+/* Staged entries are build scratch; queries only read the buckets and the first `count` entries. */
+static void put_spatial_hash(snapshot_writer* w, const spatial_hash* h) {
+    const size_t n = (size_t)h->count;
+    put(w, h, offsetof(spatial_hash, entry_index));
+    put(w, h->entry_index, n * sizeof(h->entry_index[0]));
+    put(w, h->entry_cx, n * sizeof(h->entry_cx[0]));
+    put(w, h->entry_cy, n * sizeof(h->entry_cy[0]));
+    put(w, h->entry_x, n * sizeof(h->entry_x[0]));
+    put(w, h->entry_y, n * sizeof(h->entry_y[0]));
+}
+
+static void get_spatial_hash(snapshot_reader* r, spatial_hash* h) {
+    size_t n;
+    get(r, h, offsetof(spatial_hash, entry_index));
+    if (!r->ok || h->count < 0 || h->count > SPATIAL_HASH_CAP) {
+        r->ok = 0;
+        return;
+    }
+    n = (size_t)h->count;
+    get(r, h->entry_index, n * sizeof(h->entry_index[0]));
+    get(r, h->entry_cx, n * sizeof(h->entry_cx[0]));
+    get(r, h->entry_cy, n * sizeof(h->entry_cy[0]));
+    get(r, h->entry_x, n * sizeof(h->entry_x[0]));
+    get(r, h->entry_y, n * sizeof(h->entry_y[0]));
+}
+
+/* Returns the blob size; the blob was only written if that is <= out_cap (pass NULL to measure). */
+size_t game_snapshot_save(const game_state* g, uint8_t* out, size_t out_cap) {
+    snapshot_writer w;
+    if (!g) {
+        return 0;
+    }
+    w.out = out;
+    w.cap = out ? out_cap : 0;
+    w.n = 0;
+    put(&w, SNAPSHOT_MAGIC, 4);
+    put_u32(&w, SNAPSHOT_VERSION);
+    put_u32(&w, (uint32_t)sizeof(game_state));
+    put_scalars(&w, g);
+
+    put_pool_entries(&w, &g->bullet_pool, g->bullets, sizeof(g->bullets[0]));
+    put_pool_entries(&w, &g->enemy_bullet_pool, g->enemy_bullets, sizeof(g->enemy_bullets[0]));
+    put_pool_entries(&w, &g->debris_pool, g->debris, sizeof(g->debris[0]));
+    put_pool_entries(&w, &g->missile_pool, g->missiles, sizeof(g->missiles[0]));
+    put_pool_entries(&w, &g->mine_pool, g->mines, sizeof(g->mines[0]));
+    put_pool_entries(&w, &g->powerup_pool, g->powerups, sizeof(g->powerups[0]));
+    put_pool_entries(&w, &g->eel_arc_pool, g->eel_arcs, sizeof(g->eel_arcs[0]));
+    put_pool_entries(&w, &g->prev_bullet_pool, g->prev_bullets, sizeof(g->prev_bullets[0]));
+    put_pool_entries(&w, &g->prev_enemy_bullet_pool, g->prev_enemy_bullets, sizeof(g->prev_enemy_bullets[0]));
+    put_pool_entries(&w, &g->prev_missile_pool, g->prev_missiles, sizeof(g->prev_missiles[0]));
+    put_pool_entries(&w, &g->prev_missile_pool, g->prev_missile_heading, sizeof(g->prev_missile_heading[0]));
+
+    put_active_entries(&w, g->enemies, sizeof(g->enemies[0]), MAX_ENEMIES);
+    put_active_entries(&w, g->prev_enemies, sizeof(g->prev_enemies[0]), MAX_ENEMIES);
+    put_eel_spines(&w, g->enemies, sizeof(g->enemies[0]), g->eel_spines);
+    put_eel_spines(&w, g->prev_enemies, sizeof(g->prev_enemies[0]), g->prev_eel_spines);
+    put_active_entries(&w, g->searchlights, sizeof(g->searchlights[0]), MAX_SEARCHLIGHTS);
+    put_active_entries(&w, g->asteroids, sizeof(g->asteroids[0]), MAX_ASTEROIDS);
+    put_active_entries(&w, g->missile_launchers, sizeof(g->missile_launchers[0]), MAX_MISSILE_LAUNCHERS);
+    put_active_entries(&w, g->arc_nodes, sizeof(g->arc_nodes[0]), MAX_ARC_NODES);
+    put_active_entries(&w, g->boss_attachments, sizeof(g->boss_attachments[0]), MAX_ENEMIES);
+    put_active_entries(&w, g->boss_controllers, sizeof(g->boss_controllers[0]), MAX_ENEMIES);
+
+    put_particles(&w, &g->particles);
+    put(&w, g->audio_events, (size_t)g->audio_event_count * sizeof(g->audio_events[0]));
+    put_spatial_hash(&w, &g->enemy_hash);
+    put_spatial_hash(&w, &g->bullet_hash);
+    put_spatial_hash(&w, &g->swarm_hash);
+    return w.n;
+}
+
+/* Returns 0 on a foreign or truncated blob; g is then only partly restored and should be reinitialised. */
+int game_snapshot_load(game_state* g, const uint8_t* data, size_t size) {
+    snapshot_reader r;
+    char magic[4];
+    if (!g || !data) {
+        return 0;
+    }
+    r.data = data;
+    r.size = size;
+    r.n = 0;
+    r.ok = 1;
+    get(&r, magic, sizeof(magic));
+    if (!r.ok || memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0 ||
+        get_u32(&r) != SNAPSHOT_VERSION || get_u32(&r) != (uint32_t)sizeof(game_state)) {
+        return 0;
+    }
+    get_scalars(&r, g);
+    if (!r.ok || g->audio_event_count < 0 || g->audio_event_count > MAX_AUDIO_EVENTS) {
+        return 0;
+    }
+
+    get_pool_entries(&r, &g->bullet_pool, g->bullets, sizeof(g->bullets[0]), MAX_BULLETS);
+    get_pool_entries(&r, &g->enemy_bullet_pool, g->enemy_bullets, sizeof(g->enemy_bullets[0]), MAX_ENEMY_BULLETS);
+    get_pool_entries(&r, &g->debris_pool, g->debris, sizeof(g->debris[0]), MAX_ENEMY_DEBRIS);
+    get_pool_entries(&r, &g->missile_pool, g->missiles, sizeof(g->missiles[0]), MAX_MISSILES);
+    get_pool_entries(&r, &g->mine_pool, g->mines, sizeof(g->mines[0]), MAX_MINES);
+    get_pool_entries(&r, &g->powerup_pool, g->powerups, sizeof(g->powerups[0]), MAX_POWERUPS);
+    get_pool_entries(&r, &g->eel_arc_pool, g->eel_arcs, sizeof(g->eel_arcs[0]), MAX_EEL_ARCS);
+    get_pool_entries(&r, &g->prev_bullet_pool, g->prev_bullets, sizeof(g->prev_bullets[0]), MAX_BULLETS);
+    get_pool_entries(&r, &g->prev_enemy_bullet_pool, g->prev_enemy_bullets, sizeof(g->prev_enemy_bullets[0]), MAX_ENEMY_BULLETS);
+    get_pool_entries(&r, &g->prev_missile_pool, g->prev_missiles, sizeof(g->prev_missiles[0]), MAX_MISSILES);
+    get_pool_entries(&r, &g->prev_missile_pool, g->prev_missile_heading, sizeof(g->prev_missile_heading[0]), MAX_MISSILES);
+
+    get_active_entries(&r, g->enemies, sizeof(g->enemies[0]), MAX_ENEMIES);
+    get_active_entries(&r, g->prev_enemies, sizeof(g->prev_enemies[0]), MAX_ENEMIES);
+    get_eel_spines(&r, g->enemies, sizeof(g->enemies[0]), g->eel_spines);
+    get_eel_spines(&r, g->prev_enemies, sizeof(g->prev_enemies[0]), g->prev_eel_spines);
+    get_active_entries(&r, g->searchlights, sizeof(g->searchlights[0]), MAX_SEARCHLIGHTS);
+    get_active_entries(&r, g->asteroids, sizeof(g->asteroids[0]), MAX_ASTEROIDS);
+    get_active_entries(&r, g->missile_launchers, sizeof(g->missile_launchers[0]), MAX_MISSILE_LAUNCHERS);
+    get_active_entries(&r, g->arc_nodes, sizeof(g->arc_nodes[0]), MAX_ARC_NODES);
+    get_active_entries(&r, g->boss_attachments, sizeof(g->boss_attachments[0]), MAX_ENEMIES);
+    get_active_entries(&r, g->boss_controllers, sizeof(g->boss_controllers[0]), MAX_ENEMIES);
+
+    get_particles(&r, &g->particles);
+    get(&r, g->audio_events, (size_t)g->audio_event_count * sizeof(g->audio_events[0]));
+    get_spatial_hash(&r, &g->enemy_hash);
+    get_spatial_hash(&r, &g->bullet_hash);
+    get_spatial_hash(&r, &g->swarm_hash);
+    if (!r.ok || r.n != r.size) {
+        return 0;
+    }
+    game_rebuild_structure_caches(g);
+    return 1;
+}
+
+static void copy_scalars(game_state* dst, const game_state* src) {
+    uint8_t* d = (uint8_t*)dst;
+    const uint8_t* s = (const uint8_t*)src;
+    size_t at = 0;
+    for (size_t i = 0; i < sizeof(k_compact_fields) / sizeof(k_compact_fields[0]); ++i) {
+        memcpy(d + at, s + at, k_compact_fields[i].offset - at);
+        at = k_compact_fields[i].offset + k_compact_fields[i].size;
+    }
+    memcpy(d + at, s + at, sizeof(*dst) - at);
+}
+
+static void copy_pool_entries(const slot_pool* p, void* dst, const void* src, size_t stride) {
+    uint8_t* d = (uint8_t*)dst;
+    const uint8_t* s = (const uint8_t*)src;
+    for (int i = slot_pool_next(p, 0); i >= 0; i = slot_pool_next(p, i + 1)) {
+        memcpy(d + (size_t)i * stride, s + (size_t)i * stride, stride);
+    }
+}
+
+/*
+ * Pooled entities also lead with `int active`, and some render loops test that
+ * rather than the pool. `was` is dst's pool before the copy, so only the flags
+ * of slots freed since then need clearing.
+ */
+static void copy_pool_entities(const slot_pool* was, const slot_pool* p, void* dst, const void* src, size_t stride) {
+    uint8_t* d = (uint8_t*)dst;
+    const int inactive = 0;
+    slot_pool gone;
+    memset(&gone, 0, sizeof(gone));
+    for (int w = 0; w < SLOT_POOL_WORDS; ++w) {
+        gone.bits[w] = was->bits[w] & ~p->bits[w];
+    }
+    for (int i = slot_pool_next(&gone, 0); i >= 0; i = slot_pool_next(&gone, i + 1)) {
+        memcpy(d + (size_t)i * stride, &inactive, sizeof(inactive));
+    }
+    copy_pool_entries(p, dst, src, stride);
+}
+
+static void copy_active_entries(void* dst, const void* src, size_t stride, int cap) {
+    uint8_t* d = (uint8_t*)dst;
+    const uint8_t* s = (const uint8_t*)src;
+    const int inactive = 0;
+    for (int i = 0; i < cap; ++i) {
+        if (entry_active(s + (size_t)i * stride)) {
+            memcpy(d + (size_t)i * stride, s + (size_t)i * stride, stride);
+        } else {
+            memcpy(d + (size_t)i * stride, &inactive, sizeof(inactive));
+        }
+    }
+}
+
+static void copy_eel_spines(enemy_eel_spine* dst, const enemy_eel_spine* src, const void* owners, size_t stride) {
+    const uint8_t* b = (const uint8_t*)owners;
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const enemy_eel_spine* s = &src[i];
+        if (!entry_active(b + (size_t)i * stride)) {
+            continue;
+        }
+        dst[i].count = s->count;
+        memcpy(dst[i].x, s->x, (size_t)s->count * sizeof(s->x[0]));
+        memcpy(dst[i].y, s->y, (size_t)s->count * sizeof(s->y[0]));
+    }
+}
+
+static void copy_particles(particle_store* dst, const particle_store* src) {
+    const size_t n = (size_t)src->count;
+    dst->count = src->count;
+#define COPY_COLUMN(c) memcpy(dst->c, src->c, n * sizeof(src->c[0]));
+    PARTICLE_COLUMNS(COPY_COLUMN)
+#undef COPY_COLUMN
+}
+
+void game_snapshot_copy_render(game_state* dst, const game_state* src) {
+    if (!dst || !src || dst == src) {
+        return;
+    }
+    const slot_pool bullets_was = dst->bullet_pool;
+    const slot_pool enemy_bullets_was = dst->enemy_bullet_pool;
+    const slot_pool debris_was = dst->debris_pool;
+    const slot_pool missiles_was = dst->missile_pool;
+    const slot_pool mines_was = dst->mine_pool;
+    const slot_pool powerups_was = dst->powerup_pool;
+    const slot_pool eel_arcs_was = dst->eel_arc_pool;
+    copy_scalars(dst, src);
+
+    copy_pool_entities(&bullets_was, &src->bullet_pool, dst->bullets, src->bullets, sizeof(src->bullets[0]));
+    copy_pool_entities(&enemy_bullets_was, &src->enemy_bullet_pool, dst->enemy_bullets, src->enemy_bullets, sizeof(src->enemy_bullets[0]));
+    copy_pool_entities(&debris_was, &src->debris_pool, dst->debris, src->debris, sizeof(src->debris[0]));
+    copy_pool_entities(&missiles_was, &src->missile_pool, dst->missiles, src->missiles, sizeof(src->missiles[0]));
+    copy_pool_entities(&mines_was, &src->mine_pool, dst->mines, src->mines, sizeof(src->mines[0]));
+    copy_pool_entities(&powerups_was, &src->powerup_pool, dst->powerups, src->powerups, sizeof(src->powerups[0]));
+    copy_pool_entities(&eel_arcs_was, &src->eel_arc_pool, dst->eel_arcs, src->eel_arcs, sizeof(src->eel_arcs[0]));
+    copy_pool_entries(&src->prev_bullet_pool, dst->prev_bullets, src->prev_bullets, sizeof(src->prev_bullets[0]));
+    copy_pool_entries(&src->prev_enemy_bullet_pool, dst->prev_enemy_bullets, src->prev_enemy_bullets, sizeof(src->prev_enemy_bullets[0]));
+    copy_pool_entries(&src->prev_missile_pool, dst->prev_missiles, src->prev_missiles, sizeof(src->prev_missiles[0]));
+    copy_pool_entries(&src->prev_missile_pool, dst->prev_missile_heading, src->prev_missile_heading, sizeof(src->prev_missile_heading[0]));
+
+    copy_active_entries(dst->enemies, src->enemies, sizeof(src->enemies[0]), MAX_ENEMIES);
+    copy_active_entries(dst->prev_enemies, src->prev_enemies, sizeof(src->prev_enemies[0]), MAX_ENEMIES);
+    copy_eel_spines(dst->eel_spines, src->eel_spines, src->enemies, sizeof(src->enemies[0]));
+    copy_eel_spines(dst->prev_eel_spines, src->prev_eel_spines, src->prev_enemies, sizeof(src->prev_enemies[0]));
+    copy_active_entries(dst->searchlights, src->searchlights, sizeof(src->searchlights[0]), MAX_SEARCHLIGHTS);
+    copy_active_entries(dst->asteroids, src->asteroids, sizeof(src->asteroids[0]), MAX_ASTEROIDS);
+    copy_active_entries(dst->missile_launchers, src->missile_launchers, sizeof(src->missile_launchers[0]), MAX_MISSILE_LAUNCHERS);
+    copy_active_entries(dst->arc_nodes, src->arc_nodes, sizeof(src->arc_nodes[0]), MAX_ARC_NODES);
+    copy_active_entries(dst->boss_attachments, src->boss_attachments, sizeof(src->boss_attachments[0]), MAX_ENEMIES);
+
+    copy_particles(&dst->particles, &src->particles);
+    if (src->profile.enabled) {
+        dst->profile = src->profile;
+    } else {
+        dst->profile.enabled = 0;
+    }
+}
+
+static void history_note_state(game_history* h, const game_state* g) {
+    h->last_level_index = g->level_index;
+    h->last_alt_weapon = g->alt_weapon_equipped;
+    h->last_world_w = g->world_w;
+    h->last_world_h = g->world_h;
+}
+
+static void history_restart(game_history* h) {
+    for (int i = 0; i < GAME_HISTORY_CHECKPOINTS; ++i) {
+        h->checkpoints[i].valid = 0;
+    }
+    h->base_tick = h->tick;
+}
+
+static void history_save_checkpoint(game_history* h, const game_state* g) {
+    const uint32_t index = ((h->tick - h->base_tick) / GAME_HISTORY_INTERVAL) % GAME_HISTORY_CHECKPOINTS;
+    game_history_checkpoint* cp = &h->checkpoints[index];
+    size_t size = game_snapshot_save(g, cp->data, cp->cap);
+    if (size > cp->cap) {
+        const size_t cap = size + size / 4;
+        uint8_t* data = (uint8_t*)realloc(cp->data, cap);
+        if (!data) {
+            cp->valid = 0;
+            return;
+        }
+        cp->data = data;
+        cp->cap = cap;
+        size = game_snapshot_save(g, cp->data, cp->cap);
+    }
+    cp->valid = 1;
+    cp->tick = h->tick;
+    cp->size = size;
+}
+
+void game_history_init(game_history* h, float dt) {
+    if (!h) {
+        return;
+    }
+    memset(h, 0, sizeof(*h));
+    h->dt_s = dt;
+    h->last_level_index = -1;
+}
+
+/* Records the tick (checkpointing on interval boundaries), then steps the game. */
+void game_history_update(game_history* h, game_state* g, const game_input* in) {
+    if (!h || !g || !in) {
+        return;
+    }
+    if (g->level_index != h->last_level_index || g->alt_weapon_equipped != h->last_alt_weapon ||
+        g->world_w != h->last_world_w || g->world_h != h->last_world_h) {
+        history_restart(h);
+    }
+    if ((h->tick - h->base_tick) % GAME_HISTORY_INTERVAL == 0u) {
+        history_save_checkpoint(h, g);
+    }
+    h->inputs[h->tick % GAME_HISTORY_TICKS] = *in;
+    game_update(g, h->dt_s, in);
+    h->tick += 1u;
+    history_note_state(h, g);
+}
+
+void game_history_free(game_history* h) {
+    if (!h) {
+        return;
+    }
+    for (int i = 0; i < GAME_HISTORY_CHECKPOINTS; ++i) {
+        free(h->checkpoints[i].data);
+        h->checkpoints[i].data = NULL;
+        h->checkpoints[i].cap = 0;
+        h->checkpoints[i].valid = 0;
+    }
+}
+
+/* Rewinds at most to the oldest checkpoint; later checkpoints are dropped since the future may change. */
+int game_rollback(game_state* g, game_history* h, int n_ticks) {
+    const game_history_checkpoint* from = NULL;
+    const game_history_checkpoint* oldest = NULL;
+    uint32_t target;
+    if (!g || !h || n_ticks <= 0) {
+        return 0;
+    }
+    target = ((uint32_t)n_ticks < h->tick - h->base_tick) ? h->tick - (uint32_t)n_ticks : h->base_tick;
+    for (int i = 0; i < GAME_HISTORY_CHECKPOINTS; ++i) {
+        const game_history_checkpoint* cp = &h->checkpoints[i];
+        if (!cp->valid) {
+            continue;
+        }
+        if (!oldest || cp->tick < oldest->tick) {
+            oldest = cp;
+        }
+        if (cp->tick <= target && (!from || cp->tick > from->tick)) {
+            from = cp;
+        }
+    }
+    if (!from) {
+        from = oldest;
+    }
+    if (!from || !game_snapshot_load(g, from->data, from->size)) {
+        return 0;
+    }
+    if (from->tick > target) {
+        target = from->tick;
+    }
+    for (uint32_t t = from->tick; t < target; ++t) {
+        game_update(g, h->dt_s, &h->inputs[t % GAME_HISTORY_TICKS]);
+    }
+    {
+        const int rewound = (int)(h->tick - target);
+        h->tick = target;
+        for (int i = 0; i < GAME_HISTORY_CHECKPOINTS; ++i) {
+            if (h->checkpoints[i].valid && h->checkpoints[i].tick > target) {
+                h->checkpoints[i].valid = 0;
+            }
+        }
+        history_note_state(h, g);
+        return rewound;
+    }
+}
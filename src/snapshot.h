@@ -0,0 +1,68 @@
+#ifndef V_TYPE_SNAPSHOT_H
+#define V_TYPE_SNAPSHOT_H
+
+#include "game.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Binary game_state snapshots. The blob is the scalar state (player, waves,
+ * RNG, boss runtime, slot pools...) followed by only the live entries of each
+ * entity array, so its size and the cost of saving/loading track live
+ * entities rather than MAX_* capacities. Loading zeroes dead slots.
+ *
+ * Blobs are tied to the build: the header carries a format version and
+ * sizeof(game_state), and loading rejects anything else.
+ */
+size_t game_snapshot_save(const game_state* g, uint8_t* out, size_t out_cap);
+int game_snapshot_load(game_state* g, const uint8_t* data, size_t size);
+
+/*
+ * Copies what the render path reads (scalars, live entity slots, prev_*
+ * poses and, while enabled, the profile) straight into dst. Spatial hashes,
+ * structure caches, boss controllers and audio events are not copied, and
+ * dead slots keep stale contents behind a clear pool bit or active flag, so
+ * dst is only fit for drawing. dst must start zeroed or hold an earlier copy
+ * (or a whole game_state). Cost tracks live entities, like a save.
+ */
+void game_snapshot_copy_render(game_state* dst, const game_state* src);
+
+#define GAME_HISTORY_CHECKPOINTS 8
+#define GAME_HISTORY_INTERVAL 30 /* Ticks between checkpoints: 0.25 s at 120 Hz. */
+#define GAME_HISTORY_TICKS (GAME_HISTORY_CHECKPOINTS * GAME_HISTORY_INTERVAL)
+
+typedef struct game_history_checkpoint {
+    int valid;
+    uint32_t tick;
+    size_t size;
+    size_t cap;
+    uint8_t* data;
+} game_history_checkpoint;
+
+/*
+ * Rolling record of recent ticks: a snapshot every GAME_HISTORY_INTERVAL
+ * ticks plus the input of every tick since the oldest one. Level, alt-weapon
+ * and world-size changes made outside game_update are not replayable, so the
+ * history restarts when one is seen.
+ */
+typedef struct game_history {
+    float dt_s;
+    uint32_t tick;
+    uint32_t base_tick; /* First tick that can be rolled back to. */
+    int last_level_index;
+    int last_alt_weapon;
+    float last_world_w;
+    float last_world_h;
+    game_history_checkpoint checkpoints[GAME_HISTORY_CHECKPOINTS];
+    game_input inputs[GAME_HISTORY_TICKS];
+} game_history;
+
+void game_history_init(game_history* h, float dt);
+void game_history_update(game_history* h, game_state* g, const game_input* in);
+void game_history_free(game_history* h);
+
+/* Restores the nearest checkpoint and re-simulates to n_ticks ago; returns the ticks actually rewound. */
+int game_rollback(game_state* g, game_history* h, int n_ticks);
+
+#endif
@@ -0,0 +1,427 @@
+#include "spatial_hash.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+static int cell_coord(float v, float inv_cell_size) {
+    float c = floorf(v * inv_cell_size);
+    if (c < -1.0e9f) {
+        c = -1.0e9f;
+    } else if (c > 1.0e9f) {
+        c = 1.0e9f;
+    }
+    return (int)c;
+}
+
+static int wrap_cell_x(const spatial_hash* h, int cx) {
+    if (h->wrap_cells <= 0) {
+        return cx;
+    }
+    cx %= h->wrap_cells;
+    if (cx < 0) {
+        cx += h->wrap_cells;
+    }
+    return cx;
+}
+
+static int lowest_bit(uint64_t w) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(w);
+#else
+    int b = 0;
+    while ((w & 1u) == 0u) {
+        w >>= 1;
+        ++b;
+    }
+    return b;
+#endif
+}
+
+static int bucket_of(int cx, int cy) {
+    const uint32_t k = ((uint32_t)cx * 73856093u) ^ ((uint32_t)cy * 19349663u);
+    return (int)(k & (uint32_t)(SPATIAL_HASH_BUCKETS - 1));
+}
+
+/*
+ * Query hits are marked in a bitset over entry indices and read back in word
+ * order, which yields them ascending and unique in time linear in the hits
+ * plus the words between the lowest and highest one.
+ */
+typedef struct hash_hits {
+    uint64_t bits[SPATIAL_HASH_WORDS];
+    int lo;
+    int hi;
+} hash_hits;
+
+static void hits_begin(hash_hits* s) {
+    memset(s->bits, 0, sizeof(s->bits));
+    s->lo = SPATIAL_HASH_WORDS;
+    s->hi = -1;
+}
+
+static void mark_cell(const spatial_hash* h, int cx, int cy, hash_hits* s) {
+    const int b = bucket_of(cx, cy);
+    for (int i = h->bucket_start[b]; i < h->bucket_start[b + 1]; ++i) {
+        if (h->entry_cx[i] == cx && h->entry_cy[i] == cy) {
+            const int index = h->entry_index[i];
+            const int w = index >> 6;
+            s->bits[w] |= (uint64_t)1u << (index & 63);
+            if (w < s->lo) s->lo = w;
+            if (w > s->hi) s->hi = w;
+        }
+    }
+}
+
+static int hits_emit(const hash_hits* s, int* out, int out_cap) {
+    int n = 0;
+    for (int w = s->lo; w <= s->hi; ++w) {
+        uint64_t bits = s->bits[w];
+        while (bits != 0u && n < out_cap) {
+            out[n++] = (w << 6) + lowest_bit(bits);
+            bits &= bits - 1u;
+        }
+    }
+    return n;
+}
+
+void spatial_hash_begin(spatial_hash* h, float cell_size, int uses_cylinder, float period) {
+    if (!h) {
+        return;
+    }
+    if (cell_size < 1.0f) {
+        cell_size = 1.0f;
+    }
+    h->wrap_cells = 0;
+    if (uses_cylinder && period > cell_size) {
+        h->wrap_cells = (int)floorf(period / cell_size);
+        cell_size = period / (float)h->wrap_cells;
+    }
+    h->cell_size = cell_size;
+    h->inv_cell_size = 1.0f / cell_size;
+    h->count = 0;
+    h->min_cx = 0;
+    h->max_cx = -1;
+    h->min_cy = 0;
+    h->max_cy = -1;
+    h->max_radius = 0.0f;
+}
+
+int spatial_hash_add(spatial_hash* h, int index, float x, float y, float radius) {
+    int cx;
+    int cy;
+    if (!h || h->count >= SPATIAL_HASH_CAP || index < 0 || index >= SPATIAL_HASH_CAP) {
+        return 0;
+    }
+    cx = wrap_cell_x(h, cell_coord(x, h->inv_cell_size));
+    cy = cell_coord(y, h->inv_cell_size);
+    if (h->count == 0) {
+        h->min_cx = h->max_cx = cx;
+        h->min_cy = h->max_cy = cy;
+    } else {
+        if (cx < h->min_cx) h->min_cx = cx;
+        if (cx > h->max_cx) h->max_cx = cx;
+        if (cy < h->min_cy) h->min_cy = cy;
+        if (cy > h->max_cy) h->max_cy = cy;
+    }
+    if (radius > h->max_radius) {
+        h->max_radius = radius;
+    }
+    h->staged_index[h->count] = index;
+    h->staged_cx[h->count] = cx;
+    h->staged_cy[h->count] = cy;
+    h->staged_x[h->count] = x;
+    h->staged_y[h->count] = y;
+    h->staged_bucket[h->count] = bucket_of(cx, cy);
+    h->count += 1;
+    return 1;
+}
+
+void spatial_hash_finish(spatial_hash* h) {
+    int fill[SPATIAL_HASH_BUCKETS];
+    if (!h) {
+        return;
+    }
+    memset(h->bucket_start, 0, sizeof(h->bucket_start));
+    for (int i = 0; i < h->count; ++i) {
+        h->bucket_start[h->staged_bucket[i] + 1] += 1;
+    }
+    for (int b = 0; b < SPATIAL_HASH_BUCKETS; ++b) {
+        h->bucket_start[b + 1] += h->bucket_start[b];
+        fill[b] = h->bucket_start[b];
+    }
+    /* Stable scatter keeps ascending caller order inside each bucket. */
+    for (int i = 0; i < h->count; ++i) {
+        const int slot = fill[h->staged_bucket[i]]++;
+        h->entry_index[slot] = h->staged_index[i];
+        h->entry_cx[slot] = h->staged_cx[i];
+        h->entry_cy[slot] = h->staged_cy[i];
+        h->entry_x[slot] = h->staged_x[i];
+        h->entry_y[slot] = h->staged_y[i];
+    }
+}
+
+int spatial_hash_query(const spatial_hash* h, float x, float y, float radius, int* out, int out_cap) {
+    hash_hits hits;
+    int cx0;
+    int cx1;
+    int cy0;
+    int cy1;
+    if (!h || !out || out_cap <= 0 || h->count <= 0) {
+        return 0;
+    }
+    if (radius < 0.0f) {
+        radius = 0.0f;
+    }
+    cx0 = cell_coord(x - radius, h->inv_cell_size);
+    cx1 = cell_coord(x + radius, h->inv_cell_size);
+    cy0 = cell_coord(y - radius, h->inv_cell_size);
+    cy1 = cell_coord(y + radius, h->inv_cell_size);
+    if (cy0 < h->min_cy) cy0 = h->min_cy;
+    if (cy1 > h->max_cy) cy1 = h->max_cy;
+    if (h->wrap_cells > 0) {
+        if (cx1 - cx0 + 1 >= h->wrap_cells) {
+            cx0 = 0;
+            cx1 = h->wrap_cells - 1;
+        }
+    } else {
+        if (cx0 < h->min_cx) cx0 = h->min_cx;
+        if (cx1 > h->max_cx) cx1 = h->max_cx;
+    }
+    hits_begin(&hits);
+    for (int cy = cy0; cy <= cy1; ++cy) {
+        for (int c = cx0; c <= cx1; ++c) {
+            mark_cell(h, wrap_cell_x(h, c), cy, &hits);
+        }
+    }
+    return hits_emit(&hits, out, out_cap);
+}
+
+int spatial_hash_query_ring(const spatial_hash* h, float x, float y, int ring, int* out, int out_cap) {
+    hash_hits hits;
+    int qcx;
+    int qcy;
+    if (!h || !out || out_cap <= 0 || h->count <= 0 || ring < 0) {
+        return 0;
+    }
+    qcx = cell_coord(x, h->inv_cell_size);
+    qcy = cell_coord(y, h->inv_cell_size);
+    hits_begin(&hits);
+    for (int dy = -ring; dy <= ring; ++dy) {
+        const int cy = qcy + dy;
+        const int full_row = (dy == -ring || dy == ring);
+        const int step = (full_row || ring == 0) ? 1 : (2 * ring);
+        int dx0 = -ring;
+        int dx1 = ring;
+        if (cy < h->min_cy || cy > h->max_cy) {
+            continue;
+        }
+        if (full_row && h->wrap_cells <= 0) {
+            if (dx0 < h->min_cx - qcx) dx0 = h->min_cx - qcx;
+            if (dx1 > h->max_cx - qcx) dx1 = h->max_cx - qcx;
+        }
+        for (int dx = dx0; dx <= dx1; dx += step) {
+            const int cx = wrap_cell_x(h, qcx + dx);
+            if (h->wrap_cells <= 0 && (cx < h->min_cx || cx > h->max_cx)) {
+                continue;
+            }
+            mark_cell(h, cx, cy, &hits);
+        }
+    }
+    return hits_emit(&hits, out, out_cap);
+}
+
+typedef struct nearest_hit {
+    float d2;
+    int index;
+} nearest_hit;
+
+static int nearest_before(const nearest_hit* a, const nearest_hit* b) {
+    return (a->d2 < b->d2) || (a->d2 == b->d2 && a->index < b->index);
+}
+
+/* Partitions v so that its first k entries are the k nearest. */
+static void select_nearest(nearest_hit* v, int n, int k) {
+    int lo = 0;
+    int hi = n - 1;
+    while (lo < hi) {
+        const nearest_hit pivot = v[lo + (hi - lo) / 2];
+        int i = lo;
+        int j = hi;
+        while (i <= j) {
+            while (nearest_before(&v[i], &pivot)) ++i;
+            while (nearest_before(&pivot, &v[j])) --j;
+            if (i <= j) {
+                const nearest_hit t = v[i];
+                v[i] = v[j];
+                v[j] = t;
+                ++i;
+                --j;
+            }
+        }
+        if (k - 1 <= j) {
+            hi = j;
+        } else if (k - 1 >= i) {
+            lo = i;
+        } else {
+            break;
+        }
+    }
+}
+
+static int gather_cell_within(
+    const spatial_hash* h,
+    int cx,
+    int cy,
+    float x,
+    float y,
+    float r2,
+    hash_hits* seen,
+    nearest_hit* hits,
+    int n
+) {
+    const int b = bucket_of(cx, cy);
+    const float period = (float)h->wrap_cells * h->cell_size;
+    for (int i = h->bucket_start[b]; i < h->bucket_start[b + 1]; ++i) {
+        const int index = h->entry_index[i];
+        const uint64_t bit = (uint64_t)1u << (index & 63);
+        float dx;
+        float dy;
+        float d2;
+        if (h->entry_cx[i] != cx || h->entry_cy[i] != cy || (seen->bits[index >> 6] & bit) != 0u) {
+            continue;
+        }
+        seen->bits[index >> 6] |= bit;
+        dx = h->entry_x[i] - x;
+        dy = h->entry_y[i] - y;
+        if (h->wrap_cells > 0) {
+            dx -= period * floorf(dx / period + 0.5f);
+        }
+        d2 = dx * dx + dy * dy;
+        if (d2 <= r2) {
+            hits[n].d2 = d2;
+            hits[n].index = index;
+            n += 1;
+        }
+    }
+    return n;
+}
+
+int spatial_hash_query_nearest(
+    const spatial_hash* h,
+    float x,
+    float y,
+    float radius,
+    int max_count,
+    int* out,
+    int out_cap
+) {
+    nearest_hit hits[SPATIAL_HASH_CAP];
+    hash_hits seen;
+    int n = 0;
+    int qcx;
+    int qcy;
+    int max_ring;
+    float r2;
+    float edge;
+    if (!h || !out || out_cap <= 0 || h->count <= 0 || max_count <= 0) {
+        return 0;
+    }
+    if (radius < 0.0f) {
+        radius = 0.0f;
+    }
+    r2 = radius * radius;
+    qcx = cell_coord(x, h->inv_cell_size);
+    qcy = cell_coord(y, h->inv_cell_size);
+    max_ring = spatial_hash_max_ring(h, x, y);
+    {
+        /* Distance from (x, y) to the nearest side of its own cell. */
+        const float fx = x - (float)qcx * h->cell_size;
+        const float fy = y - (float)qcy * h->cell_size;
+        edge = fminf(fminf(fx, h->cell_size - fx), fminf(fy, h->cell_size - fy));
+        if (edge < 0.0f) {
+            edge = 0.0f;
+        }
+    }
+    memset(seen.bits, 0, sizeof(seen.bits));
+    for (int ring = 0; ring <= max_ring; ++ring) {
+        float reach;
+        int settled = 0;
+        for (int dy = -ring; dy <= ring; ++dy) {
+            const int cy = qcy + dy;
+            const int step = (dy == -ring || dy == ring || ring == 0) ? 1 : (2 * ring);
+            if (cy < h->min_cy || cy > h->max_cy) {
+                continue;
+            }
+            for (int dx = -ring; dx <= ring; dx += step) {
+                const int cx = wrap_cell_x(h, qcx + dx);
+                if (h->wrap_cells <= 0 && (cx < h->min_cx || cx > h->max_cx)) {
+                    continue;
+                }
+                n = gather_cell_within(h, cx, cy, x, y, r2, &seen, hits, n);
+            }
+        }
+        /* Anything not gathered yet lies outside the rings so far, at least `reach` away. */
+        reach = ((float)ring * h->cell_size + edge) * 0.999f;
+        if (reach > radius) {
+            break;
+        }
+        if (n < max_count) {
+            continue;
+        }
+        for (int k = 0; k < n; ++k) {
+            settled += (hits[k].d2 <= reach * reach) ? 1 : 0;
+        }
+        if (settled >= max_count) {
+            /* The nearest max_count are all settled, so the rest can go. */
+            int w = 0;
+            for (int k = 0; k < n; ++k) {
+                if (hits[k].d2 <= reach * reach) {
+                    hits[w++] = hits[k];
+                }
+            }
+            n = w;
+            break;
+        }
+    }
+    if (n > max_count) {
+        select_nearest(hits, n, max_count);
+        n = max_count;
+    }
+    hits_begin(&seen);
+    for (int k = 0; k < n; ++k) {
+        const int w = hits[k].index >> 6;
+        seen.bits[w] |= (uint64_t)1u << (hits[k].index & 63);
+        if (w < seen.lo) seen.lo = w;
+        if (w > seen.hi) seen.hi = w;
+    }
+    return hits_emit(&seen, out, out_cap);
+}
+
+int spatial_hash_max_ring(const spatial_hash* h, float x, float y) {
+    int qcx;
+    int qcy;
+    int r = 0;
+    if (!h || h->count <= 0) {
+        return -1;
+    }
+    qcx = cell_coord(x, h->inv_cell_size);
+    qcy = cell_coord(y, h->inv_cell_size);
+    if (h->wrap_cells > 0) {
+        r = h->wrap_cells / 2 + 1;
+    } else {
+        if (qcx - h->min_cx > r) r = qcx - h->min_cx;
+        if (h->max_cx - qcx > r) r = h->max_cx - qcx;
+    }
+    if (qcy - h->min_cy > r) r = qcy - h->min_cy;
+    if (h->max_cy - qcy > r) r = h->max_cy - qcy;
+    return r;
+}
+
+float spatial_hash_ring_min_dist(const spatial_hash* h, int ring) {
+    if (!h || ring <= 1) {
+        return 0.0f;
+    }
+    /* Small slack absorbs floor() rounding at cell boundaries. */
+    return (float)(ring - 1) * h->cell_size * 0.999f;
+}
@@ -0,0 +1,67 @@
+#ifndef V_TYPE_SPATIAL_HASH_H
+#define V_TYPE_SPATIAL_HASH_H
+
+#ifndef SPATIAL_HASH_CAP
+#define SPATIAL_HASH_CAP 512
+#endif
+#ifndef SPATIAL_HASH_BUCKETS
+#define SPATIAL_HASH_BUCKETS 256 /* Power of two. */
+#endif
+#define SPATIAL_HASH_WORDS ((SPATIAL_HASH_CAP + 63) / 64)
+
+/*
+ * Uniform grid hashed into a fixed bucket table, rebuilt once per tick.
+ * Entries are caller indices in [0, SPATIAL_HASH_CAP); queries return them
+ * sorted ascending and unique so callers can keep "first match in pool order"
+ * semantics. When wrap_cells is non-zero the x axis repeats every wrap_cells
+ * cells (cylinder levels).
+ */
+typedef struct spatial_hash {
+    float cell_size;
+    float inv_cell_size;
+    int wrap_cells;
+    int count;
+    int min_cx;
+    int max_cx;
+    int min_cy;
+    int max_cy;
+    float max_radius;
+    int bucket_start[SPATIAL_HASH_BUCKETS + 1];
+    int entry_index[SPATIAL_HASH_CAP];
+    int entry_cx[SPATIAL_HASH_CAP];
+    int entry_cy[SPATIAL_HASH_CAP];
+    float entry_x[SPATIAL_HASH_CAP];
+    float entry_y[SPATIAL_HASH_CAP];
+    int staged_bucket[SPATIAL_HASH_CAP];
+    int staged_index[SPATIAL_HASH_CAP];
+    int staged_cx[SPATIAL_HASH_CAP];
+    int staged_cy[SPATIAL_HASH_CAP];
+    float staged_x[SPATIAL_HASH_CAP];
+    float staged_y[SPATIAL_HASH_CAP];
+} spatial_hash;
+
+void spatial_hash_begin(spatial_hash* h, float cell_size, int uses_cylinder, float period);
+int spatial_hash_add(spatial_hash* h, int index, float x, float y, float radius);
+void spatial_hash_finish(spatial_hash* h);
+int spatial_hash_query(const spatial_hash* h, float x, float y, float radius, int* out, int out_cap);
+int spatial_hash_query_ring(const spatial_hash* h, float x, float y, int ring, int* out, int out_cap);
+/*
+ * Entries whose added position lies within radius of (x, y), keeping only the
+ * max_count nearest (ties to the lower index) when more qualify. Cells are
+ * searched outward ring by ring and the search stops once the nearest
+ * max_count are settled, so cost follows max_count rather than crowd size.
+ * Output is ascending like the other queries.
+ */
+int spatial_hash_query_nearest(
+    const spatial_hash* h,
+    float x,
+    float y,
+    float radius,
+    int max_count,
+    int* out,
+    int out_cap
+);
+int spatial_hash_max_ring(const spatial_hash* h, float x, float y);
+float spatial_hash_ring_min_dist(const spatial_hash* h, int ring);
+
+#endif
@@ -0,0 +1,284 @@
+#include "structure_index.h"
+
+#include <math.h>
+#include <string.h>
+
+static int column_of(const structure_index* si, float x) {
+    const float c = floorf((x - si->origin_x) * si->inv_column_w);
+    if (c < 0.0f) {
+        return 0;
+    }
+    if (c > (float)(si->column_count - 1)) {
+        return si->column_count - 1;
+    }
+    return (int)c;
+}
+
+static int lowest_bit(uint64_t w) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(w);
+#else
+    int b = 0;
+    while ((w & 1u) == 0u) {
+        w >>= 1;
+        ++b;
+    }
+    return b;
+#endif
+}
+
+void structure_index_begin(structure_index* si) {
+    if (!si) {
+        return;
+    }
+    si->count = 0;
+    si->column_count = 0;
+    si->origin_x = 0.0f;
+    si->inv_column_w = 0.0f;
+    si->max_diag = 0.0f;
+}
+
+int structure_index_add(structure_index* si, float min_x, float min_y, float max_x, float max_y) {
+    float w;
+    float h;
+    if (!si || si->count >= STRUCTURE_INDEX_CAP) {
+        return 0;
+    }
+    si->min_x[si->count] = min_x;
+    si->min_y[si->count] = min_y;
+    si->max_x[si->count] = max_x;
+    si->max_y[si->count] = max_y;
+    w = max_x - min_x;
+    h = max_y - min_y;
+    si->max_diag = fmaxf(si->max_diag, sqrtf(w * w + h * h));
+    si->count += 1;
+    return 1;
+}
+
+void structure_index_finish(structure_index* si) {
+    float lo;
+    float hi;
+    if (!si || si->count <= 0) {
+        return;
+    }
+    lo = si->min_x[0];
+    hi = si->max_x[0];
+    for (int i = 1; i < si->count; ++i) {
+        lo = fminf(lo, si->min_x[i]);
+        hi = fmaxf(hi, si->max_x[i]);
+    }
+    si->column_count = STRUCTURE_INDEX_COLUMNS;
+    si->origin_x = lo;
+    si->inv_column_w = (float)STRUCTURE_INDEX_COLUMNS / fmaxf(hi - lo, 1.0f);
+    memset(si->columns, 0, sizeof(si->columns));
+    for (int i = 0; i < si->count; ++i) {
+        const int c0 = column_of(si, si->min_x[i]);
+        const int c1 = column_of(si, si->max_x[i]);
+        for (int c = c0; c <= c1; ++c) {
+            si->columns[c][i >> 6] |= (uint64_t)1u << (i & 63);
+        }
+    }
+}
+
+static int mask_entries(const uint64_t* mask, int* out, int out_cap) {
+    int n = 0;
+    for (int w = 0; w < STRUCTURE_INDEX_WORDS; ++w) {
+        uint64_t bits = mask[w];
+        while (bits != 0u && n < out_cap) {
+            out[n++] = (w << 6) + lowest_bit(bits);
+            bits &= bits - 1u;
+        }
+    }
+    return n;
+}
+
+int structure_index_columns_x(const structure_index* si, float x0, float x1, int* out_c0, int* out_c1) {
+    if (!si || si->count <= 0 || si->column_count <= 0) {
+        return 0;
+    }
+    /* One unit of slack so callers' exact tests never lose a touching box to rounding. */
+    x0 -= 1.0f;
+    x1 += 1.0f;
+    if (x1 < si->origin_x || x0 > si->origin_x + (float)si->column_count / si->inv_column_w) {
+        return 0;
+    }
+    if (out_c0) {
+        *out_c0 = column_of(si, x0);
+    }
+    if (out_c1) {
+        *out_c1 = column_of(si, x1);
+    }
+    return 1;
+}
+
+int structure_index_column_entries(const structure_index* si, int column, int* out, int out_cap) {
+    if (!si || !out || out_cap <= 0 || column < 0 || column >= si->column_count) {
+        return 0;
+    }
+    return mask_entries(si->columns[column], out, out_cap);
+}
+
+int structure_index_query_x(const structure_index* si, float x0, float x1, int* out, int out_cap) {
+    uint64_t mask[STRUCTURE_INDEX_WORDS];
+    int c0;
+    int c1;
+    if (!out || out_cap <= 0 || !structure_index_columns_x(si, x0, x1, &c0, &c1)) {
+        return 0;
+    }
+    memcpy(mask, si->columns[c0], sizeof(mask));
+    for (int c = c0 + 1; c <= c1; ++c) {
+        for (int w = 0; w < STRUCTURE_INDEX_WORDS; ++w) {
+            mask[w] |= si->columns[c][w];
+        }
+    }
+    return mask_entries(mask, out, out_cap);
+}
+
+static float box_signed_distance(const structure_index* si, int i, float x, float y) {
+    const float dx = fmaxf(si->min_x[i] - x, x - si->max_x[i]);
+    const float dy = fmaxf(si->min_y[i] - y, y - si->max_y[i]);
+    if (dx <= 0.0f && dy <= 0.0f) {
+        return fmaxf(dx, dy);
+    }
+    {
+        const float ox = fmaxf(dx, 0.0f);
+        const float oy = fmaxf(dy, 0.0f);
+        return sqrtf(ox * ox + oy * oy);
+    }
+}
+
+static void field_layout(structure_field* out, const structure_index* si, float cell_size) {
+    float lo_x = si->min_x[0];
+    float hi_x = si->max_x[0];
+    float lo_y = si->min_y[0];
+    float hi_y = si->max_y[0];
+    for (int i = 1; i < si->count; ++i) {
+        lo_x = fminf(lo_x, si->min_x[i]);
+        hi_x = fmaxf(hi_x, si->max_x[i]);
+        lo_y = fminf(lo_y, si->min_y[i]);
+        hi_y = fmaxf(hi_y, si->max_y[i]);
+    }
+    if (cell_size < 1.0f) {
+        cell_size = 1.0f;
+    }
+    for (;;) {
+        const float reach = cell_size * (float)STRUCTURE_FIELD_REACH_CELLS;
+        const int w = (int)ceilf((hi_x - lo_x + 2.0f * reach) / cell_size);
+        const int h = (int)ceilf((hi_y - lo_y + 2.0f * reach) / cell_size);
+        if ((long)w * (long)h <= STRUCTURE_FIELD_CAP) {
+            out->w = w;
+            out->h = h;
+            out->origin_x = lo_x - reach;
+            out->origin_y = lo_y - reach;
+            out->cell_size = cell_size;
+            out->inv_cell_size = 1.0f / cell_size;
+            out->reach = reach;
+            /* Half a cell diagonal plus slack for float rounding in the exact tests. */
+            out->error = cell_size * 0.7072f + 0.01f * cell_size;
+            return;
+        }
+        cell_size *= 1.25f;
+    }
+}
+
+static void field_fill(structure_field* f, const structure_index* si, int cx0, int cy0, int cx1, int cy1) {
+    int cand[STRUCTURE_INDEX_CAP];
+    if (cx0 < 0) cx0 = 0;
+    if (cy0 < 0) cy0 = 0;
+    if (cx1 > f->w - 1) cx1 = f->w - 1;
+    if (cy1 > f->h - 1) cy1 = f->h - 1;
+    for (int cx = cx0; cx <= cx1; ++cx) {
+        const float x = f->origin_x + ((float)cx + 0.5f) * f->cell_size;
+        const int n = structure_index_query_x(si, x - f->reach, x + f->reach, cand, STRUCTURE_INDEX_CAP);
+        for (int cy = cy0; cy <= cy1; ++cy) {
+            const float y = f->origin_y + ((float)cy + 0.5f) * f->cell_size;
+            float d = f->reach;
+            for (int k = 0; k < n; ++k) {
+                d = fminf(d, box_signed_distance(si, cand[k], x, y));
+            }
+            f->dist[cy * f->w + cx] = d;
+        }
+    }
+}
+
+static int box_equal(const structure_index* a, int i, const structure_index* b, int j) {
+    return a->min_x[i] == b->min_x[j] && a->min_y[i] == b->min_y[j] &&
+           a->max_x[i] == b->max_x[j] && a->max_y[i] == b->max_y[j];
+}
+
+void structure_field_update(structure_field* f, const structure_index* prev, const structure_index* si, float cell_size) {
+    structure_field layout;
+    int dirty = 0;
+    float dx0 = 0.0f;
+    float dy0 = 0.0f;
+    float dx1 = 0.0f;
+    float dy1 = 0.0f;
+    if (!f || !si) {
+        return;
+    }
+    if (si->count <= 0) {
+        f->w = 0;
+        f->h = 0;
+        return;
+    }
+    field_layout(&layout, si, cell_size);
+    if (!prev || prev->count <= 0 || prev->count > STRUCTURE_INDEX_CAP || layout.w != f->w || layout.h != f->h ||
+        layout.origin_x != f->origin_x || layout.origin_y != f->origin_y || layout.cell_size != f->cell_size) {
+        f->w = layout.w;
+        f->h = layout.h;
+        f->origin_x = layout.origin_x;
+        f->origin_y = layout.origin_y;
+        f->cell_size = layout.cell_size;
+        f->inv_cell_size = layout.inv_cell_size;
+        f->reach = layout.reach;
+        f->error = layout.error;
+        field_fill(f, si, 0, 0, f->w - 1, f->h - 1);
+        return;
+    }
+    /* Positional diff is a superset of the changed boxes, which is all the refill needs. */
+    for (int i = 0; i < prev->count || i < si->count; ++i) {
+        for (int side = 0; side < 2; ++side) {
+            const structure_index* s = side ? si : prev;
+            if (i >= s->count || (i < prev->count && i < si->count && box_equal(prev, i, si, i))) {
+                continue;
+            }
+            if (!dirty) {
+                dx0 = s->min_x[i];
+                dy0 = s->min_y[i];
+                dx1 = s->max_x[i];
+                dy1 = s->max_y[i];
+                dirty = 1;
+            } else {
+                dx0 = fminf(dx0, s->min_x[i]);
+                dy0 = fminf(dy0, s->min_y[i]);
+                dx1 = fmaxf(dx1, s->max_x[i]);
+                dy1 = fmaxf(dy1, s->max_y[i]);
+            }
+        }
+    }
+    if (!dirty) {
+        return;
+    }
+    field_fill(
+        f,
+        si,
+        (int)floorf((dx0 - f->reach - f->origin_x) * f->inv_cell_size) - 1,
+        (int)floorf((dy0 - f->reach - f->origin_y) * f->inv_cell_size) - 1,
+        (int)floorf((dx1 + f->reach - f->origin_x) * f->inv_cell_size) + 1,
+        (int)floorf((dy1 + f->reach - f->origin_y) * f->inv_cell_size) + 1
+    );
+}
+
+float structure_field_sample(const structure_field* f, float x, float y) {
+    float fx;
+    float fy;
+    if (!f || f->w <= 0 || f->h <= 0) {
+        return 3.0e38f;
+    }
+    fx = floorf((x - f->origin_x) * f->inv_cell_size);
+    fy = floorf((y - f->origin_y) * f->inv_cell_size);
+    if (fx < 0.0f || fy < 0.0f || fx >= (float)f->w || fy >= (float)f->h) {
+        return f->reach;
+    }
+    return f->dist[(int)fy * f->w + (int)fx];
+}
@@ -0,0 +1,61 @@
+#ifndef V_TYPE_STRUCTURE_INDEX_H
+#define V_TYPE_STRUCTURE_INDEX_H
+
+#include <stdint.h>
+
+#define STRUCTURE_INDEX_CAP 512 /* Mirrors LEVELDEF_MAX_STRUCTURES; leveldef.h includes game.h. */
+#define STRUCTURE_INDEX_COLUMNS 128
+#define STRUCTURE_INDEX_WORDS ((STRUCTURE_INDEX_CAP + 63) / 64)
+
+/*
+ * Static broadphase for level structures, built when a level is applied.
+ * World AABBs are cached in level order and bucketed into x columns; each
+ * column is a bitset over entries so queries come back sorted and unique.
+ */
+typedef struct structure_index {
+    int count;
+    int column_count;
+    float origin_x;
+    float inv_column_w;
+    float max_diag;
+    float min_x[STRUCTURE_INDEX_CAP];
+    float min_y[STRUCTURE_INDEX_CAP];
+    float max_x[STRUCTURE_INDEX_CAP];
+    float max_y[STRUCTURE_INDEX_CAP];
+    uint64_t columns[STRUCTURE_INDEX_COLUMNS][STRUCTURE_INDEX_WORDS];
+} structure_index;
+
+#define STRUCTURE_FIELD_CAP 16384
+#define STRUCTURE_FIELD_REACH_CELLS 8
+
+/*
+ * Coarse signed distance to the nearest indexed box, sampled at cell centres
+ * and clamped to reach. The field is 1-Lipschitz, so a sample is within
+ * `error` of the true distance anywhere in its cell; beyond the domain every
+ * point is at least `reach` from any box.
+ */
+typedef struct structure_field {
+    int w;
+    int h;
+    float origin_x;
+    float origin_y;
+    float cell_size;
+    float inv_cell_size;
+    float reach;
+    float error;
+    float dist[STRUCTURE_FIELD_CAP];
+} structure_field;
+
+void structure_index_begin(structure_index* si);
+int structure_index_add(structure_index* si, float min_x, float min_y, float max_x, float max_y);
+void structure_index_finish(structure_index* si);
+int structure_index_query_x(const structure_index* si, float x0, float x1, int* out, int out_cap);
+/* Columns that structure_index_query_x would merge for [x0, x1]; 0 when the span misses the index. */
+int structure_index_columns_x(const structure_index* si, float x0, float x1, int* out_c0, int* out_c1);
+int structure_index_column_entries(const structure_index* si, int column, int* out, int out_cap);
+
+/* Rebuilds only cells near boxes that differ from prev when the domain is unchanged. */
+void structure_field_update(structure_field* f, const structure_index* prev, const structure_index* si, float cell_size);
+float structure_field_sample(const structure_field* f, float x, float y);
+
+#endif
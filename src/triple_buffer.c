@@ -0,0 +1,40 @@
+#include "triple_buffer.h"
+
+void triple_buffer_init(triple_buffer* tb) {
+    if (!tb) {
+        return;
+    }
+    tb->back = 0u;
+    atomic_init(&tb->middle, 1u);
+    tb->front = 2u;
+}
+
+int triple_buffer_write_slot(const triple_buffer* tb) {
+    return tb ? (int)tb->back : 0;
+}
+
+void triple_buffer_publish(triple_buffer* tb) {
+    unsigned int prev;
+    if (!tb) {
+        return;
+    }
+    prev = atomic_exchange_explicit(&tb->middle, tb->back | TRIPLE_BUFFER_FRESH, memory_order_acq_rel);
+    tb->back = prev & 3u;
+}
+
+/* Returns the reader's slot, swapping in the newest publish if there is one. */
+int triple_buffer_acquire(triple_buffer* tb, int* out_fresh) {
+    int fresh = 0;
+    if (!tb) {
+        return 0;
+    }
+    if (atomic_load_explicit(&tb->middle, memory_order_acquire) & TRIPLE_BUFFER_FRESH) {
+        const unsigned int prev = atomic_exchange_explicit(&tb->middle, tb->front, memory_order_acq_rel);
+        tb->front = prev & 3u;
+        fresh = 1;
+    }
+    if (out_fresh) {
+        *out_fresh = fresh;
+    }
+    return (int)tb->front;
+}
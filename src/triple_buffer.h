@@ -0,0 +1,25 @@
+#ifndef V_TYPE_TRIPLE_BUFFER_H
+#define V_TYPE_TRIPLE_BUFFER_H
+
+#include <stdatomic.h>
+
+/*
+ * Single-writer/single-reader handoff over three caller-owned slots.
+ * The writer fills triple_buffer_write_slot() and publishes it; the reader
+ * takes the newest published slot with triple_buffer_acquire(). Neither
+ * side ever blocks, and a slot is never visible to both at once.
+ */
+typedef struct triple_buffer {
+    atomic_uint middle; /* slot index, plus TRIPLE_BUFFER_FRESH when unread */
+    unsigned int back;  /* writer-owned */
+    unsigned int front; /* reader-owned */
+} triple_buffer;
+
+#define TRIPLE_BUFFER_FRESH 4u
+
+void triple_buffer_init(triple_buffer* tb);
+int triple_buffer_write_slot(const triple_buffer* tb);
+void triple_buffer_publish(triple_buffer* tb);
+int triple_buffer_acquire(triple_buffer* tb, int* out_fresh);
+
+#endif
@@ -0,0 +1,160 @@
+#include "worker_pool.h"
+
+#include <string.h>
+
+#if !defined(__STDC_NO_THREADS__)
+
+static void run_chunks(worker_pool* p) {
+    for (;;) {
+        const int begin = atomic_fetch_add_explicit(&p->next, p->chunk, memory_order_relaxed);
+        int end;
+        if (begin >= p->count) {
+            return;
+        }
+        end = begin + p->chunk;
+        if (end > p->count) {
+            end = p->count;
+        }
+        p->fn(p->ctx, begin, end);
+    }
+}
+
+static int worker_main(void* arg) {
+    worker_pool* p = (worker_pool*)arg;
+    unsigned int seen = 0u;
+    mtx_lock(&p->lock);
+    for (;;) {
+        while (!p->quit && p->generation == seen) {
+            cnd_wait(&p->wake, &p->lock);
+        }
+        if (p->quit) {
+            break;
+        }
+        seen = p->generation;
+        mtx_unlock(&p->lock);
+        run_chunks(p);
+        mtx_lock(&p->lock);
+        p->busy -= 1;
+        if (p->busy == 0) {
+            cnd_signal(&p->done);
+        }
+    }
+    mtx_unlock(&p->lock);
+    return 0;
+}
+
+int worker_pool_start(worker_pool* p, int threads) {
+    if (!p) {
+        return 0;
+    }
+    memset(p, 0, sizeof(*p));
+    atomic_init(&p->next, 0);
+    atomic_init(&p->claimed, 0);
+    if (threads <= 0) {
+        return 0;
+    }
+    if (threads > WORKER_POOL_MAX_THREADS) {
+        threads = WORKER_POOL_MAX_THREADS;
+    }
+    if (mtx_init(&p->lock, mtx_plain) != thrd_success) {
+        return 0;
+    }
+    if (cnd_init(&p->wake) != thrd_success) {
+        mtx_destroy(&p->lock);
+        return 0;
+    }
+    if (cnd_init(&p->done) != thrd_success) {
+        cnd_destroy(&p->wake);
+        mtx_destroy(&p->lock);
+        return 0;
+    }
+    for (int i = 0; i < threads; ++i) {
+        if (thrd_create(&p->threads[i], worker_main, p) != thrd_success) {
+            break;
+        }
+        p->thread_count += 1;
+    }
+    if (p->thread_count == 0) {
+        cnd_destroy(&p->done);
+        cnd_destroy(&p->wake);
+        mtx_destroy(&p->lock);
+    }
+    return p->thread_count;
+}
+
+void worker_pool_stop(worker_pool* p) {
+    if (!p || p->thread_count <= 0) {
+        return;
+    }
+    mtx_lock(&p->lock);
+    p->quit = 1;
+    cnd_broadcast(&p->wake);
+    mtx_unlock(&p->lock);
+    for (int i = 0; i < p->thread_count; ++i) {
+        thrd_join(p->threads[i], NULL);
+    }
+    cnd_destroy(&p->done);
+    cnd_destroy(&p->wake);
+    mtx_destroy(&p->lock);
+    p->thread_count = 0;
+}
+
+/* Returns once every chunk has run; the caller works through chunks too. */
+void worker_pool_run(worker_pool* p, worker_pool_fn fn, void* ctx, int count, int chunk) {
+    if (!fn || count <= 0) {
+        return;
+    }
+    if (chunk < 1) {
+        chunk = 1;
+    }
+    if (!p || p->thread_count <= 0 || count <= chunk ||
+        atomic_exchange_explicit(&p->claimed, 1, memory_order_acquire) != 0) {
+        fn(ctx, 0, count);
+        return;
+    }
+    mtx_lock(&p->lock);
+    p->fn = fn;
+    p->ctx = ctx;
+    p->count = count;
+    p->chunk = chunk;
+    atomic_store_explicit(&p->next, 0, memory_order_relaxed);
+    p->busy = p->thread_count;
+    p->generation += 1u;
+    cnd_broadcast(&p->wake);
+    mtx_unlock(&p->lock);
+
+    run_chunks(p);
+
+    mtx_lock(&p->lock);
+    while (p->busy > 0) {
+        cnd_wait(&p->done, &p->lock);
+    }
+    mtx_unlock(&p->lock);
+    atomic_store_explicit(&p->claimed, 0, memory_order_release);
+}
+
+#else
+
+int worker_pool_start(worker_pool* p, int threads) {
+    (void)threads;
+    if (p) {
+        memset(p, 0, sizeof(*p));
+        atomic_init(&p->next, 0);
+        atomic_init(&p->claimed, 0);
+    }
+    return 0;
+}
+
+void worker_pool_stop(worker_pool* p) {
+    (void)p;
+}
+
+void worker_pool_run(worker_pool* p, worker_pool_fn fn, void* ctx, int count, int chunk) {
+    (void)p;
+    (void)chunk;
+    if (fn && count > 0) {
+        fn(ctx, 0, count);
+    }
+}
+
+#endif
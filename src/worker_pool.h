@@ -0,0 +1,46 @@
+#ifndef V_TYPE_WORKER_POOL_H
+#define V_TYPE_WORKER_POOL_H
+
+#include <stdatomic.h>
+
+#if !defined(__STDC_NO_THREADS__)
+#include <threads.h>
+#endif
+
+#define WORKER_POOL_MAX_THREADS 15
+
+typedef void (*worker_pool_fn)(void* ctx, int begin, int end);
+
+/*
+ * Helper threads for data-parallel loops. worker_pool_run splits [0, count)
+ * into chunks that the caller and the helpers claim in any order, so fn must
+ * only write state owned by the indices it is given. With no helpers (or no
+ * C11 threads) everything runs inline on the caller. A pool serves one run at
+ * a time: a run entered while another is in flight, from another thread or
+ * from inside fn, goes inline on its own caller instead.
+ */
+typedef struct worker_pool {
+    int thread_count;
+#if !defined(__STDC_NO_THREADS__)
+    thrd_t threads[WORKER_POOL_MAX_THREADS];
+    mtx_t lock;
+    cnd_t wake;
+    cnd_t done;
+#endif
+    int quit;
+    unsigned int generation;
+    int busy;
+    worker_pool_fn fn;
+    void* ctx;
+    int count;
+    int chunk;
+    atomic_int next;
+    atomic_int claimed;
+} worker_pool;
+
+/* Starts up to `threads` helpers (clamped to WORKER_POOL_MAX_THREADS); returns how many started. */
+int worker_pool_start(worker_pool* p, int threads);
+void worker_pool_stop(worker_pool* p);
+void worker_pool_run(worker_pool* p, worker_pool_fn fn, void* ctx, int count, int chunk);
+
+#endif
@@ -413,6 +413,7 @@ static int compare_levels_semantic(const char* ctx, const leveldef_level* a, con
     }
 
     CMP_INT_FIELD(ctx, a, b, sine.count);
+    CMP_INT_FIELD(ctx, a, b, swarm_count);
     CMP_FLOAT_FIELD(ctx, a, b, sine.start_x01);
     CMP_FLOAT_FIELD(ctx, a, b, sine.spacing_x);
     CMP_FLOAT_FIELD(ctx, a, b, sine.home_y01);
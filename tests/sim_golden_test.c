@@ -0,0 +1,482 @@
+#include "enemy.h"
+#include "game.h"
+#include "sim_script.h"
+#include "snapshot.h"
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define GOLDEN_PATH "tests/golden/sim_hashes.txt"
+#define GOLDEN_MAX_LEVELS 64
+#define GOLDEN_LEVEL_NAME_CAP 64
+#define GOLDEN_TICKS 3600
+#define GOLDEN_INTERVAL 300
+#define GOLDEN_CHECKPOINTS (GOLDEN_TICKS / GOLDEN_INTERVAL)
+#define GOLDEN_ALT_SUFFIX "+alt"
+#define GOLDEN_ALT_HOLD_TICKS 600 /* Ticks per alt weapon in the alt-fire pass. */
+
+static const float kFixedDt = 1.0f / 120.0f;
+
+/* One pass over a level; the alt-fire pass is keyed "<level>+alt" in the golden file. */
+typedef struct golden_level {
+    char name[GOLDEN_LEVEL_NAME_CAP];
+    char level[GOLDEN_LEVEL_NAME_CAP];
+    int alt_fire;
+    uint64_t expected[GOLDEN_CHECKPOINTS];
+    uint64_t actual[GOLDEN_CHECKPOINTS];
+    int found; /* Bit k set once checkpoint k has a golden entry. */
+} golden_level;
+
+static void hash_bytes(uint64_t* h, const void* p, size_t n) {
+    const unsigned char* c = (const unsigned char*)p;
+    for (size_t i = 0; i < n; ++i) {
+        *h ^= c[i];
+        *h *= 1099511628211ULL;
+    }
+}
+
+static void hash_int(uint64_t* h, int v) {
+    const int32_t x = (int32_t)v;
+    hash_bytes(h, &x, sizeof(x));
+}
+
+static void hash_float(uint64_t* h, float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    hash_bytes(h, &bits, sizeof(bits));
+}
+
+static void hash_body(uint64_t* h, const body* b) {
+    hash_float(h, b->x);
+    hash_float(h, b->y);
+    hash_float(h, b->vx);
+    hash_float(h, b->vy);
+}
+
+/*
+ * Field by field rather than raw struct bytes, so reordering or adding
+ * fields leaves the goldens alone and only a change in behaviour moves them.
+ * Live entities are visited in slot order.
+ */
+static void hash_state(uint64_t* h, const game_state* g) {
+    hash_bytes(h, &g->rng.state, sizeof(g->rng.state));
+    hash_bytes(h, &g->rng.inc, sizeof(g->rng.inc));
+    hash_int(h, g->lives);
+    hash_int(h, g->kills);
+    hash_int(h, g->score);
+    hash_int(h, g->wave_index);
+    hash_int(h, g->curated_spawned_count);
+    hash_int(h, g->weapon_level);
+    hash_float(h, g->weapon_heat);
+    hash_float(h, g->camera_x);
+    hash_float(h, g->camera_y);
+    hash_body(h, &g->player.b);
+    hash_int(h, g->alt_weapon_equipped);
+    hash_int(h, g->shield_active);
+    hash_int(h, g->gating_bosses_remaining);
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const enemy* e = &g->enemies[i];
+        if (!e->active) {
+            continue;
+        }
+        hash_int(h, i);
+        hash_int(h, e->archetype);
+        hash_int(h, e->state);
+        hash_int(h, e->hp);
+        hash_body(h, &e->b);
+        hash_float(h, e->facing_x);
+        hash_float(h, e->facing_y);
+        if (g->boss_controllers[i].active) {
+            hash_int(h, g->boss_controllers[i].phase);
+            hash_int(h, g->boss_controllers[i].live_part_count);
+            hash_int(h, g->boss_controllers[i].telegraph_kind);
+        }
+    }
+    for (int i = 0; i < MAX_BULLETS; ++i) {
+        if (g->bullets[i].active) {
+            hash_body(h, &g->bullets[i].b);
+        }
+    }
+    for (int i = 0; i < MAX_ENEMY_BULLETS; ++i) {
+        if (g->enemy_bullets[i].active) {
+            hash_body(h, &g->enemy_bullets[i].b);
+        }
+    }
+    for (int i = 0; i < MAX_MISSILES; ++i) {
+        if (g->missiles[i].active) {
+            hash_int(h, g->missiles[i].owner);
+            hash_body(h, &g->missiles[i].b);
+        }
+    }
+    for (int i = 0; i < MAX_MINES; ++i) {
+        if (g->mines[i].active) {
+            hash_int(h, g->mines[i].hp);
+            hash_body(h, &g->mines[i].b);
+        }
+    }
+    for (int i = 0; i < MAX_ASTEROIDS; ++i) {
+        if (g->asteroids[i].active) {
+            hash_body(h, &g->asteroids[i].b);
+        }
+    }
+    for (int i = 0; i < MAX_POWERUPS; ++i) {
+        if (g->powerups[i].active) {
+            hash_int(h, g->powerups[i].type);
+            hash_body(h, &g->powerups[i].b);
+        }
+    }
+    hash_int(h, g->eel_arc_count);
+    hash_int(h, g->particles.count);
+}
+
+/*
+ * The alt-fire pass holds secondary fire and cycles through every alt weapon,
+ * refilling the new weapon's starting ammo on each switch, so missiles, EMP,
+ * rear gun and shield all run.
+ */
+static void run_level(game_state* g, const char* level_name, int alt_fire, uint64_t* out_hashes) {
+    uint64_t h = 1469598103934665603ULL;
+    int start_ammo[PLAYER_ALT_WEAPON_COUNT];
+    game_init(g, 1920.0f, 1080.0f);
+    (void)game_set_level_by_name(g, level_name);
+    game_set_rng_seed(g, 0u);
+    memcpy(start_ammo, g->alt_weapon_ammo, sizeof(start_ammo));
+    for (int tick = 0; tick < GOLDEN_TICKS; ++tick) {
+        game_input in;
+        sim_script_sweep_input(tick, &in);
+        if (alt_fire) {
+            if (tick % GOLDEN_ALT_HOLD_TICKS == 0) {
+                const int weapon = (tick / GOLDEN_ALT_HOLD_TICKS) % PLAYER_ALT_WEAPON_COUNT;
+                game_set_alt_weapon(g, weapon);
+                g->alt_weapon_ammo[weapon] = start_ammo[weapon];
+            }
+            in.secondary_fire = 1;
+        }
+        if (g->lives <= 0) {
+            in.restart = 1;
+        }
+        game_update(g, kFixedDt, &in);
+        if (strcmp(game_current_level_name(g), level_name) != 0) {
+            (void)game_set_level_by_name(g, level_name);
+        }
+        if (tick % GOLDEN_INTERVAL == GOLDEN_INTERVAL - 1) {
+            hash_state(&h, g);
+            out_hashes[tick / GOLDEN_INTERVAL] = h;
+        }
+    }
+}
+
+static int collect_level_names(game_state* g, golden_level* levels) {
+    int count = 0;
+    char first[GOLDEN_LEVEL_NAME_CAP];
+    game_init(g, 1920.0f, 1080.0f);
+    snprintf(first, sizeof(first), "%s", game_current_level_name(g));
+    do {
+        snprintf(levels[count].name, sizeof(levels[count].name), "%s", game_current_level_name(g));
+        memcpy(levels[count].level, levels[count].name, sizeof(levels[count].level));
+        count += 1;
+        game_cycle_level(g);
+    } while (count < GOLDEN_MAX_LEVELS && strcmp(game_current_level_name(g), first) != 0);
+    return count;
+}
+
+/* Lines are "<level> <tick> <hash>"; '#' starts a comment. */
+static int load_golden(golden_level* levels, int level_count) {
+    FILE* f = fopen(GOLDEN_PATH, "r");
+    char line[256];
+    if (!f) {
+        fprintf(stderr, "golden: cannot open %s (run with --update to create it)\n", GOLDEN_PATH);
+        return 0;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        char name[GOLDEN_LEVEL_NAME_CAP];
+        int tick = 0;
+        uint64_t hash = 0;
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        if (sscanf(line, "%63s %d %" SCNx64, name, &tick, &hash) != 3) {
+            fprintf(stderr, "golden: bad line in %s: %s", GOLDEN_PATH, line);
+            fclose(f);
+            return 0;
+        }
+        for (int i = 0; i < level_count; ++i) {
+            const int k = (tick + 1) / GOLDEN_INTERVAL - 1;
+            if (strcmp(levels[i].name, name) != 0) {
+                continue;
+            }
+            if (k < 0 || k >= GOLDEN_CHECKPOINTS || (tick + 1) % GOLDEN_INTERVAL != 0) {
+                fprintf(stderr, "golden: unexpected tick %d for %s\n", tick, name);
+                fclose(f);
+                return 0;
+            }
+            levels[i].expected[k] = hash;
+            levels[i].found |= 1 << k;
+        }
+    }
+    fclose(f);
+    return 1;
+}
+
+static int write_golden(const golden_level* levels, int level_count) {
+    FILE* f = fopen(GOLDEN_PATH, "w");
+    if (!f) {
+        fprintf(stderr, "golden: cannot write %s\n", GOLDEN_PATH);
+        return 0;
+    }
+    fprintf(f, "# Written by sim_golden_test --update: sweep input, seed 0, 1920x1080, 1/120 s ticks.\n");
+    fprintf(f, "# \"<level>" GOLDEN_ALT_SUFFIX "\" entries hold secondary fire and cycle every alt weapon.\n");
+    fprintf(f, "# <level> <tick> <running state hash>\n");
+    for (int i = 0; i < level_count; ++i) {
+        for (int k = 0; k < GOLDEN_CHECKPOINTS; ++k) {
+            fprintf(f, "%s %d %016" PRIx64 "\n", levels[i].name, (k + 1) * GOLDEN_INTERVAL - 1, levels[i].actual[k]);
+        }
+    }
+    fclose(f);
+    return 1;
+}
+
+static int locked_player_missile(const game_state* g) {
+    for (int i = 0; i < MAX_MISSILES; ++i) {
+        const homing_missile* m = &g->missiles[i];
+        if (m->active && m->owner == MISSILE_OWNER_PLAYER && m->arm_delay_s <= 0.0f && m->target_index >= 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Player missiles stay locked on an enemy until it dies. Fire missiles until
+ * one is locked, then stand a new enemy (fresh serial) in the target's slot
+ * behind the missile, out of its seek cone: the next tick must drop the slot
+ * rather than turn around and chase the new occupant.
+ */
+static int check_missile_slot_reuse(game_state* g) {
+    int ammo;
+    game_init(g, 1920.0f, 1080.0f);
+    game_set_rng_seed(g, 0u);
+    ammo = g->alt_weapon_ammo[PLAYER_ALT_WEAPON_MISSILE];
+    for (int attempt = 0; attempt < GOLDEN_MAX_LEVELS; ++attempt) {
+        for (int tick = 0; tick < GOLDEN_TICKS; ++tick) {
+            game_input in;
+            int mi;
+            sim_script_sweep_input(tick, &in);
+            in.secondary_fire = 1;
+            if (g->lives <= 0) {
+                in.restart = 1;
+            }
+            game_set_alt_weapon(g, PLAYER_ALT_WEAPON_MISSILE);
+            g->alt_weapon_ammo[PLAYER_ALT_WEAPON_MISSILE] = ammo;
+            game_update(g, kFixedDt, &in);
+            mi = locked_player_missile(g);
+            if (mi >= 0) {
+                homing_missile* m = &g->missiles[mi];
+                const int slot = m->target_index;
+                enemy* e = &g->enemies[slot];
+                e->serial = ++g->enemy_serial_alloc;
+                e->b.x = m->b.x - cosf(m->heading_rad) * 400.0f;
+                e->b.y = m->b.y - sinf(m->heading_rad) * 400.0f;
+                e->b.vx = 0.0f;
+                e->b.vy = 0.0f;
+                memset(&in, 0, sizeof(in));
+                game_update(g, kFixedDt, &in);
+                if (!m->active || !e->active) {
+                    continue;
+                }
+                if (m->target_index == slot) {
+                    fprintf(stderr, "golden: player missile %d followed a new enemy into slot %d\n", mi, slot);
+                    return 0;
+                }
+                return 1;
+            }
+        }
+        game_cycle_level(g);
+    }
+    fprintf(stderr, "golden: no level produced a locked player missile\n");
+    return 0;
+}
+
+/* Live entries must match src; dead ones must read as inactive even in a reused slot. */
+#define RENDER_COPY_SAME(dst, src, arr, cap)                                                            \
+    do {                                                                                                \
+        for (int i_ = 0; i_ < (cap); ++i_) {                                                            \
+            if ((dst)->arr[i_].active != (src)->arr[i_].active ||                                       \
+                ((src)->arr[i_].active && memcmp(&(dst)->arr[i_], &(src)->arr[i_], sizeof((src)->arr[i_])) != 0)) { \
+                fprintf(stderr, "golden: render copy differs in " #arr "[%d]\n", i_);                  \
+                return 0;                                                                               \
+            }                                                                                           \
+        }                                                                                               \
+    } while (0)
+
+static int render_copy_matches(const game_state* dst, const game_state* src) {
+    const particle_store* dp = &dst->particles;
+    const particle_store* sp = &src->particles;
+    const size_t n = (size_t)sp->count;
+    RENDER_COPY_SAME(dst, src, bullets, MAX_BULLETS);
+    RENDER_COPY_SAME(dst, src, enemy_bullets, MAX_ENEMY_BULLETS);
+    RENDER_COPY_SAME(dst, src, enemies, MAX_ENEMIES);
+    RENDER_COPY_SAME(dst, src, prev_enemies, MAX_ENEMIES);
+    RENDER_COPY_SAME(dst, src, debris, MAX_ENEMY_DEBRIS);
+    RENDER_COPY_SAME(dst, src, searchlights, MAX_SEARCHLIGHTS);
+    RENDER_COPY_SAME(dst, src, asteroids, MAX_ASTEROIDS);
+    RENDER_COPY_SAME(dst, src, mines, MAX_MINES);
+    RENDER_COPY_SAME(dst, src, missile_launchers, MAX_MISSILE_LAUNCHERS);
+    RENDER_COPY_SAME(dst, src, missiles, MAX_MISSILES);
+    RENDER_COPY_SAME(dst, src, arc_nodes, MAX_ARC_NODES);
+    RENDER_COPY_SAME(dst, src, powerups, MAX_POWERUPS);
+    RENDER_COPY_SAME(dst, src, eel_arcs, MAX_EEL_ARCS);
+    RENDER_COPY_SAME(dst, src, boss_attachments, MAX_ENEMIES);
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        const enemy_eel_spine* ds = &dst->eel_spines[i];
+        const enemy_eel_spine* ss = &src->eel_spines[i];
+        if (src->enemies[i].active &&
+            (ds->count != ss->count || memcmp(ds->x, ss->x, (size_t)ss->count * sizeof(ss->x[0])) != 0 ||
+             memcmp(ds->y, ss->y, (size_t)ss->count * sizeof(ss->y[0])) != 0)) {
+            fprintf(stderr, "golden: render copy differs in eel_spines[%d]\n", i);
+            return 0;
+        }
+    }
+    for (int i = slot_pool_next(&src->prev_missile_pool, 0); i >= 0; i = slot_pool_next(&src->prev_missile_pool, i + 1)) {
+        if (memcmp(&dst->prev_missiles[i], &src->prev_missiles[i], sizeof(src->prev_missiles[i])) != 0 ||
+            dst->prev_missile_heading[i] != src->prev_missile_heading[i]) {
+            fprintf(stderr, "golden: render copy differs in prev_missiles[%d]\n", i);
+            return 0;
+        }
+    }
+    if (dp->count != sp->count || memcmp(dp->x, sp->x, n * sizeof(sp->x[0])) != 0 ||
+        memcmp(dp->y, sp->y, n * sizeof(sp->y[0])) != 0 || memcmp(dp->type, sp->type, n * sizeof(sp->type[0])) != 0) {
+        fprintf(stderr, "golden: render copy differs in particles\n");
+        return 0;
+    }
+    if (memcmp(&dst->player, &src->player, sizeof(src->player)) != 0 ||
+        memcmp(&dst->prev_player, &src->prev_player, sizeof(src->prev_player)) != 0 ||
+        dst->camera_x != src->camera_x || dst->camera_y != src->camera_y || dst->score != src->score ||
+        dst->level_index != src->level_index) {
+        fprintf(stderr, "golden: render copy differs in scalars\n");
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * The sim thread publishes game_snapshot_copy_render into three reused
+ * slots. Do the same over an alt-fire run of every level, so slots freed
+ * between two copies into one slot are covered.
+ */
+static int check_render_copy(game_state* g, const golden_level* levels, int level_count) {
+    game_state* slots = (game_state*)calloc(3u, sizeof(*slots));
+    int ok = 1;
+    if (!slots) {
+        fprintf(stderr, "golden: out of memory\n");
+        return 0;
+    }
+    for (int l = 0; l < level_count && ok; ++l) {
+        game_init(g, 1920.0f, 1080.0f);
+        game_set_rng_seed(g, 0u);
+        if (!game_set_level_by_name(g, levels[l].level)) {
+            continue;
+        }
+        for (int tick = 0; tick < GOLDEN_TICKS && ok; ++tick) {
+            game_state* slot = &slots[tick % 3];
+            game_input in;
+            sim_script_sweep_input(tick, &in);
+            in.secondary_fire = 1;
+            if (g->lives <= 0) {
+                in.restart = 1;
+            }
+            game_set_alt_weapon(g, (tick / GOLDEN_ALT_HOLD_TICKS) % PLAYER_ALT_WEAPON_COUNT);
+            game_update(g, kFixedDt, &in);
+            game_snapshot_copy_render(slot, g);
+            if (!render_copy_matches(slot, g)) {
+                fprintf(stderr, "golden: %s render copy wrong at tick %d\n", levels[l].level, tick);
+                ok = 0;
+            }
+        }
+    }
+    free(slots);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    static golden_level levels[2 * GOLDEN_MAX_LEVELS];
+    game_state* g;
+    int update = 0;
+    int threads = 0;
+    int level_count;
+    int failures = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--update") == 0) {
+            update = 1;
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [--update] [--threads N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (chdir(VTYPE_SOURCE_DIR) != 0) {
+        fprintf(stderr, "golden: chdir to source root failed\n");
+        return 1;
+    }
+    g = (game_state*)calloc(1, sizeof(*g));
+    if (!g) {
+        fprintf(stderr, "golden: out of memory\n");
+        return 1;
+    }
+    (void)enemy_set_worker_threads(threads);
+    level_count = collect_level_names(g, levels);
+    for (int i = 0; i < level_count; ++i) {
+        golden_level* alt = &levels[level_count + i];
+        snprintf(alt->level, sizeof(alt->level), "%s", levels[i].level);
+        snprintf(alt->name, sizeof(alt->name), "%.*s%s", (int)(sizeof(alt->name) - sizeof(GOLDEN_ALT_SUFFIX)), levels[i].level, GOLDEN_ALT_SUFFIX);
+        alt->alt_fire = 1;
+    }
+    level_count *= 2;
+    for (int i = 0; i < level_count; ++i) {
+        run_level(g, levels[i].level, levels[i].alt_fire, levels[i].actual);
+    }
+    if (!check_missile_slot_reuse(g)) {
+        failures += 1;
+    }
+    if (!check_render_copy(g, levels, level_count / 2)) {
+        failures += 1;
+    }
+    (void)enemy_set_worker_threads(0);
+    free(g);
+
+    if (update) {
+        return (write_golden(levels, level_count) && failures == 0) ? 0 : 1;
+    }
+    if (!load_golden(levels, level_count)) {
+        return 1;
+    }
+    for (int i = 0; i < level_count; ++i) {
+        for (int k = 0; k < GOLDEN_CHECKPOINTS; ++k) {
+            const int tick = (k + 1) * GOLDEN_INTERVAL - 1;
+            if (!(levels[i].found & (1 << k))) {
+                fprintf(stderr, "golden: %s has no entry for tick %d\n", levels[i].name, tick);
+                failures += 1;
+                break;
+            }
+            if (levels[i].expected[k] != levels[i].actual[k]) {
+                fprintf(
+                    stderr,
+                    "golden: %s diverges by tick %d (expected %016" PRIx64 ", got %016" PRIx64 ")\n",
+                    levels[i].name,
+                    tick,
+                    levels[i].expected[k],
+                    levels[i].actual[k]
+                );
+                failures += 1;
+                break;
+            }
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}